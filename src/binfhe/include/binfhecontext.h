@@ -248,9 +248,7 @@ public:
    *
    * @param key struct with the bootstrapping keys
    */
-    void BTKeyLoad(const RingGSWEvalKey& key) {
-        m_BTKey = key;
-    }
+    void BTKeyLoad(const RingGSWEvalKey& key);
 
     /**
    * Loads a bootstrapping key map element in the context (typically after deserializing)
@@ -258,9 +256,7 @@ public:
    * @param baseG baseG corresponding to the given key
    * @param key struct with the bootstrapping keys
    */
-    void BTKeyMapLoadSingleElement(const uint32_t& baseG, const RingGSWEvalKey& key) {
-        m_BTKey_map[baseG] = key;
-    }
+    void BTKeyMapLoadSingleElement(const uint32_t& baseG, const RingGSWEvalKey& key);
 
     /**
    * Clear the bootstrapping keys in the current context
@@ -268,9 +264,28 @@ public:
     void ClearBTKeys() {
         m_BTKey.BSkey.reset();
         m_BTKey.KSkey.reset();
+        m_BTKey.BSkeyFFT.reset();
         m_BTKey_map.clear();
     }
 
+    /**
+   * Selects the backend for the external products in bootstrapping. With
+   * FFT_BACKEND, the refreshing keys are kept in the FFT domain and the
+   * accumulator uses double-precision negacyclic FFTs. The key coefficients
+   * are split into up to four pieces so that every product is exact in double
+   * precision, with a margin for the roundoff error of the transforms; this
+   * covers the predefined parameter sets except STD128Q and STD128Q_OPT, for
+   * which a config_error is thrown. Keys that are already loaded are
+   * converted; should be called after GenerateBinFHEContext.
+   *
+   * @param backend NTT_BACKEND (default) or FFT_BACKEND
+   */
+    void SetAccumulatorBackend(BINFHEACCBACKEND backend);
+
+    BINFHEACCBACKEND GetAccumulatorBackend() const {
+        return m_params->GetAccBackend();
+    }
+
     /**
    * Evaluates a binary gate (calls bootstrapping as a subroutine)
    *
@@ -298,6 +313,23 @@ public:
    */
     LWECiphertext EvalFunc(ConstLWECiphertext ct1, const std::vector<NativeInteger>& LUT) const;
 
+    /**
+   * Evaluate several arbitrary functions of the same ciphertext, sharing the
+   * blind rotation among all LUTs of the same kind. The test vector of LUT i
+   * is split into the shared rotated polynomial and a small polynomial v_i
+   * that the rotation result is multiplied by, so the bootstrapping error of
+   * LUT i grows by a factor of up to ||v_i||_1, the total variation of the LUT
+   * in units of the largest step common to the shared LUTs. A LUT for which this error would exceed
+   * the error bound beta is evaluated on its own, as in EvalFunc, so LUTs
+   * that change value often cost a blind rotation each.
+   *
+   * @param ct1 ciphertext to be bootstrapped
+   * @param LUTs the look-up tables of the to-be-evaluated functions
+   * @return a vector of resulting ciphertexts, one per LUT
+   */
+    std::vector<LWECiphertext> EvalFuncMulti(ConstLWECiphertext ct1,
+                                             const std::vector<std::vector<NativeInteger>>& LUTs) const;
+
     /**
    * Generate the LUT for the to-be-evaluated function
    *
@@ -0,0 +1,208 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Negacyclic double-precision FFT and FFT-domain refreshing keys for the
+  RingGSW accumulator
+ */
+
+#ifndef BINFHE_FFTCORE_H
+#define BINFHE_FFTCORE_H
+
+#include <memory>
+#include <vector>
+
+#include "ringcore.h"
+#include "utils/memory.h"
+
+namespace lbcrypto {
+
+/**
+ * @brief Negacyclic FFT over Z[X]/(X^N + 1) in double precision.
+ *
+ * A real polynomial a of degree < N is evaluated at the N/2 roots
+ * x_s = exp(i*pi*(4s+1)/N) of X^{N/2} - i, which determine a(X) since the
+ * remaining roots of X^N + 1 are their conjugates. The evaluation folds the
+ * two halves of a into a complex vector of length N/2, twists it by
+ * exp(i*pi*j/N) and runs a radix-2 FFT of size N/2. Complex vectors are kept
+ * as separate real and imaginary arrays so the butterflies vectorize.
+ */
+class NegacyclicFFT {
+public:
+    /**
+   * Precomputes the twiddle factors
+   *
+   * @param N ring dimension (a power of two)
+   */
+    explicit NegacyclicFFT(uint32_t N);
+
+    uint32_t GetRingDimension() const {
+        return m_N;
+    }
+
+    /**
+   * @return the number of complex values in the FFT domain, N/2
+   */
+    uint32_t GetSize() const {
+        return m_M;
+    }
+
+    /**
+   * Forward transform
+   *
+   * @param in N coefficients
+   * @param re real parts of the N/2 evaluations
+   * @param im imaginary parts of the N/2 evaluations
+   */
+    void Forward(const double* in, double* re, double* im) const;
+
+    /**
+   * Inverse transform; re and im are used as scratch space and overwritten
+   *
+   * @param re real parts of the N/2 evaluations
+   * @param im imaginary parts of the N/2 evaluations
+   * @param out N coefficients (not rounded)
+   */
+    void Inverse(double* re, double* im, double* out) const;
+
+    /**
+   * Evaluates X^m - 1 at all N/2 points
+   *
+   * @param m exponent in [0, 2N)
+   * @param re real parts of the N/2 evaluations
+   * @param im imaginary parts of the N/2 evaluations
+   */
+    void MonomialMinusOne(uint32_t m, double* re, double* im) const;
+
+private:
+    void Butterflies(double* re, double* im, bool inverse) const;
+
+    uint32_t m_N;
+    uint32_t m_M;
+    // bit-reversal permutation of [0, N/2)
+    std::vector<uint32_t> m_bitRev;
+    // exp(i*pi*j/N) for j in [0, N/2)
+    std::vector<double> m_twistRe;
+    std::vector<double> m_twistIm;
+    // exp(2*pi*i*j/(2h)) for j in [0, h) stored at offset h, for all stages h
+    std::vector<double> m_rootRe;
+    std::vector<double> m_rootIm;
+    // exp(i*pi*t/N) for t in [0, 2N)
+    std::vector<double> m_cycRe;
+    std::vector<double> m_cycIm;
+};
+
+/**
+ * @brief Refreshing key in the FFT domain, used by the FFT accumulator backend.
+ * Holds the same three-dimensional array of RingGSW ciphertexts as
+ * RingGSWBTKey, with every polynomial lifted to centered integers and
+ * transformed by NegacyclicFFT. When Q is too large for the external products
+ * to be exact in double precision, every centered coefficient c is split into
+ * balanced pieces c = sum_p c_p * 2^(pieceBits * p), each piece is transformed
+ * separately, and the accumulator recombines the rounded partial products
+ * mod Q with the factors returned by GetPieceFactor.
+ */
+class RingGSWBTKeyFFT {
+public:
+    /**
+   * Converts a refreshing key to the FFT domain
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param key the refreshing key
+   */
+    RingGSWBTKeyFFT(const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWBTKey& key);
+
+    const NegacyclicFFT& GetFFT() const {
+        return *m_fft;
+    }
+
+    /**
+   * @return the number of pieces each key coefficient is split into
+   */
+    uint32_t GetNumPieces() const {
+        return m_pieces;
+    }
+
+    /**
+   * @return 2^(pieceBits * piece) mod Q
+   */
+    const NativeInteger& GetPieceFactor(uint32_t piece) const {
+        return m_pieceFactors[piece];
+    }
+
+    /**
+   * @return real parts of the FFT of the given piece of element [row][col] of RingGSW ciphertext [i][j][k]
+   */
+    const double* GetRe(uint32_t i, uint32_t j, uint32_t k, uint32_t row, uint32_t col, uint32_t piece) const {
+        return &m_data[Offset(i, j, k, row, col, piece)];
+    }
+
+    /**
+   * @return imaginary parts of the FFT of the given piece of element [row][col] of RingGSW ciphertext [i][j][k]
+   */
+    const double* GetIm(uint32_t i, uint32_t j, uint32_t k, uint32_t row, uint32_t col, uint32_t piece) const {
+        return &m_data[Offset(i, j, k, row, col, piece) + m_fft->GetSize()];
+    }
+
+    /**
+   * Checks that double precision represents the external products of the
+   * given parameters exactly in the worst case: a sum over digitsG2 rows and
+   * N coefficients of a signed digit times a key piece, multiplied by the two
+   * GINX monomials X^m - 1, together with a further log2(N) bits for the
+   * roundoff error of the transforms and a safety margin, has to stay below
+   * 2^53. Key coefficients are split into at most four pieces to meet the
+   * bound; all predefined parameter sets except the STD128Q ones pass.
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @return true if the FFT backend can be used
+   */
+    static bool IsPrecisionSufficient(const std::shared_ptr<RingGSWCryptoParams> params);
+
+private:
+    size_t Offset(uint32_t i, uint32_t j, uint32_t k, uint32_t row, uint32_t col, uint32_t piece) const {
+        return ((((((static_cast<size_t>(i) * m_dim2 + j) * m_dim3 + k) * m_rows + row) * 2 + col) * m_pieces +
+                 piece) *
+                2) *
+               m_fft->GetSize();
+    }
+
+    std::shared_ptr<const NegacyclicFFT> m_fft;
+    uint32_t m_dim2;
+    uint32_t m_dim3;
+    uint32_t m_rows;
+    uint32_t m_pieces;
+    std::vector<NativeInteger> m_pieceFactors;
+    std::vector<double, AlignedAllocator<double>> m_data;
+};
+
+}  // namespace lbcrypto
+
+#endif
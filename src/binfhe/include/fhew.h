@@ -50,6 +50,7 @@
 #include <map>
 #include <vector>
 #include <memory>
+#include "fftcore.h"
 #include "lwe.h"
 #include "ringcore.h"
 
@@ -136,6 +137,25 @@ public:
                                                 const std::vector<NativeInteger>& LUT, const NativeInteger beta,
                                                 const NativeInteger bigger_q) const;
 
+    /**
+   * Evaluate several arbitrary functions of the same ciphertext. LUTs of the same
+   * kind (negacyclic, periodic or arbitrary) share a single blind rotation.
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param &EK a shared pointer to the bootstrapping keys
+   * @param ct1 input ciphertext
+   * @param lwescheme a shared pointer to additive LWE scheme
+   * @param LUTs the look-up tables of the to-be-evaluated functions
+   * @param beta the error bound
+   * @param bigger_q the ciphertext modulus
+   * @return a vector of resulting ciphertexts, one per LUT
+   */
+    std::vector<std::shared_ptr<LWECiphertextImpl>> EvalFuncMulti(
+        const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK,
+        const std::shared_ptr<const LWECiphertextImpl> ct1, const std::shared_ptr<LWEEncryptionScheme> LWEscheme,
+        const std::vector<std::vector<NativeInteger>>& LUTs, const NativeInteger beta,
+        const NativeInteger bigger_q) const;
+
     /**
    * Evaluate a round down function
    *
@@ -265,6 +285,53 @@ private:
                       const RingGSWCiphertext& input2, const NativeInteger& a,
                       std::shared_ptr<RingGSWCiphertext> acc) const;
 
+    /**
+   * Main accumulator function used in bootstrapping - AP variant with the FFT
+   * backend
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param &key refreshing key in the FFT domain
+   * @param i, j, k index of the RingGSW ciphertext in the refreshing key
+   * @param acc previous value of the accumulator (in COEFFICIENT format)
+   */
+    void AddToACCAPFFT(const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWBTKeyFFT& key, uint32_t i,
+                       uint32_t j, uint32_t k, std::shared_ptr<RingGSWCiphertext> acc) const;
+
+    /**
+   * Main accumulator function used in bootstrapping - GINX variant with the FFT
+   * backend
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param &key refreshing key in the FFT domain
+   * @param i index of the secret key element
+   * @param &a integer a in each step of GINX accumulation
+   * @param acc previous value of the accumulator (in COEFFICIENT format)
+   */
+    void AddToACCGINXFFT(const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWBTKeyFFT& key, uint32_t i,
+                         const NativeInteger& a, std::shared_ptr<RingGSWCiphertext> acc) const;
+
+    /**
+   * Blind rotation of the accumulator; dispatches to the NTT or FFT backend
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param &EK the bootstrapping keys
+   * @param &a first part of the input LWE ciphertext
+   * @param acc the accumulator, initialized with the test vector
+   */
+    void EvalAcc(const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK, const NativeVector& a,
+                 std::shared_ptr<RingGSWCiphertext> acc) const;
+
+    /**
+   * Signed digit decomposition of an RLWE ciphertext into doubles, used by the
+   * FFT backend
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param &input input RLWE ciphertext
+   * @param *output digitsG2 rows of N digits each
+   */
+    void SignedDigitDecompose(const std::shared_ptr<RingGSWCryptoParams> params, const std::vector<NativePoly>& input,
+                              std::vector<double>* output) const;
+
     /**
    * Takes an RLWE ciphertext input and outputs a vector of its digits, i.e., an
    * RLWE' ciphertext
@@ -327,6 +394,28 @@ private:
                                                  const std::shared_ptr<const LWECiphertextImpl> ct1,
                                                  const std::shared_ptr<LWEEncryptionScheme> LWEscheme, const Func f,
                                                  const NativeInteger bigger_q) const;
+
+    /**
+   * Bootstraps a ciphertext for several functions with a single blind rotation
+   * (multi-value bootstrapping, https://eprint.iacr.org/2018/622)
+   *
+   * @param params a shared pointer to RingGSW scheme parameters
+   * @param &EK a shared pointer to the bootstrapping keys
+   * @param ct1 input ciphertext
+   * @param lwescheme a shared pointer to additive LWE scheme
+   * @param LUTs the look-up tables passed to f
+   * @param f maps a LUT and a phase to the test vector entry
+   * @param beta the error bound; LUTs whose error would exceed it are
+   * bootstrapped on their own
+   * @param bigger_q the ciphertext modulus
+   * @return a vector of resulting ciphertexts, one per LUT
+   */
+    template <typename Func>
+    std::vector<std::shared_ptr<LWECiphertextImpl>> BootstrapMulti(
+        const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK,
+        const std::shared_ptr<const LWECiphertextImpl> ct1, const std::shared_ptr<LWEEncryptionScheme> LWEscheme,
+        const std::vector<std::vector<NativeInteger>>& LUTs, const Func f, const NativeInteger beta,
+        const NativeInteger bigger_q) const;
 };
 
 }  // namespace lbcrypto
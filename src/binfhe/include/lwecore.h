@@ -36,12 +36,15 @@
 #ifndef BINFHE_LWECORE_H
 #define BINFHE_LWECORE_H
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "math/hal.h"
 #include "math/discretegaussiangenerator.h"
+#include "utils/memory.h"
 #include "utils/serializable.h"
 
 namespace lbcrypto {
@@ -425,41 +428,117 @@ private:
 
 /**
  * @brief Class that stores the LWE scheme switching key
+ *
+ * The key consists of N * baseKS * expKS LWE ciphertexts indexed by the
+ * position i in the old secret key, the digit value and the digit index j.
+ * The "a" parts are kept in one contiguous table whose rows are padded to a
+ * cache line, so key switching streams through aligned memory instead of
+ * chasing a pointer per ciphertext. When the "a" parts were expanded from a
+ * seed, only the seed is serialized.
  */
 class LWESwitchingKey : public Serializable {
 public:
     LWESwitchingKey() {}
 
-    explicit LWESwitchingKey(const std::vector<std::vector<std::vector<LWECiphertextImpl>>>& key) : m_key(key) {}
+    /**
+   * Allocates a zero key
+   *
+   * @param n dimension of the new LWE secret key
+   * @param N dimension of the old LWE secret key
+   * @param baseKS the base used for key switching
+   * @param expKS the number of digits
+   * @param &Q modulus for key switching
+   */
+    LWESwitchingKey(uint32_t n, uint32_t N, uint32_t baseKS, uint32_t expKS, const NativeInteger& Q);
 
-    explicit LWESwitchingKey(const LWESwitchingKey& rhs) {
-        this->m_key = rhs.m_key;
+    explicit LWESwitchingKey(const std::vector<std::vector<std::vector<LWECiphertextImpl>>>& key) {
+        SetElements(key);
     }
 
-    explicit LWESwitchingKey(const LWESwitchingKey&& rhs) {
-        this->m_key = std::move(rhs.m_key);
+    LWESwitchingKey(const LWESwitchingKey& rhs) = default;
+
+    LWESwitchingKey(LWESwitchingKey&& rhs) = default;
+
+    LWESwitchingKey& operator=(const LWESwitchingKey& rhs) = default;
+
+    LWESwitchingKey& operator=(LWESwitchingKey&& rhs) = default;
+
+    uint32_t Getn() const {
+        return m_n;
     }
 
-    const LWESwitchingKey& operator=(const LWESwitchingKey& rhs) {
-        this->m_key = rhs.m_key;
-        return *this;
+    uint32_t GetN() const {
+        return m_N;
     }
 
-    const LWESwitchingKey& operator=(const LWESwitchingKey&& rhs) {
-        this->m_key = std::move(rhs.m_key);
-        return *this;
+    uint32_t GetBaseKS() const {
+        return m_baseKS;
+    }
+
+    uint32_t GetExpKS() const {
+        return m_expKS;
+    }
+
+    const NativeInteger& GetModulus() const {
+        return m_Q;
+    }
+
+    /**
+   * Gets the "a" part of a key element as a pointer to n contiguous values,
+   * aligned to 64 bytes
+   *
+   * @param i position in the old secret key
+   * @param digit value of the digit
+   * @param j index of the digit
+   */
+    const BasicInteger* GetA(uint32_t i, uint32_t digit, uint32_t j) const {
+        return m_a.data() + RowIndex(i, digit, j) * m_stride;
+    }
+
+    BasicInteger* GetA(uint32_t i, uint32_t digit, uint32_t j) {
+        return m_a.data() + RowIndex(i, digit, j) * m_stride;
     }
 
-    const std::vector<std::vector<std::vector<LWECiphertextImpl>>>& GetElements() const {
-        return m_key;
+    const BasicInteger& GetB(uint32_t i, uint32_t digit, uint32_t j) const {
+        return m_b[RowIndex(i, digit, j)];
     }
 
-    void SetElements(const std::vector<std::vector<std::vector<LWECiphertextImpl>>>& key) {
-        m_key = key;
+    BasicInteger& GetB(uint32_t i, uint32_t digit, uint32_t j) {
+        return m_b[RowIndex(i, digit, j)];
     }
 
+    /**
+   * Fills the "a" parts with values uniform modulo Q derived from a seed.
+   * The expansion is deterministic and platform independent, so the key can
+   * be stored and transferred with the seed in place of the "a" parts.
+   *
+   * @param &seed the seed; the last word is replaced by the position in the
+   * old secret key to obtain an independent stream per position
+   */
+    void ExpandA(const std::array<uint32_t, 16>& seed);
+
+    /**
+   * @return true if the "a" parts were expanded from a seed
+   */
+    bool IsSeeded() const {
+        return m_seeded;
+    }
+
+    const std::array<uint32_t, 16>& GetSeed() const {
+        return m_seed;
+    }
+
+    /**
+   * Gets the key as LWE ciphertexts indexed by [i][digit][j]. This builds a
+   * copy of the key and is meant for inspection, not for computation.
+   */
+    std::vector<std::vector<std::vector<LWECiphertextImpl>>> GetElements() const;
+
+    void SetElements(const std::vector<std::vector<std::vector<LWECiphertextImpl>>>& key);
+
     bool operator==(const LWESwitchingKey& other) const {
-        return m_key == other.m_key;
+        return m_n == other.m_n && m_N == other.m_N && m_baseKS == other.m_baseKS && m_expKS == other.m_expKS &&
+               m_Q == other.m_Q && m_b == other.m_b && m_a == other.m_a;
     }
 
     bool operator!=(const LWESwitchingKey& other) const {
@@ -468,7 +547,20 @@ public:
 
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
-        ar(::cereal::make_nvp("k", m_key));
+        ar(::cereal::make_nvp("n", m_n));
+        ar(::cereal::make_nvp("N", m_N));
+        ar(::cereal::make_nvp("bk", m_baseKS));
+        ar(::cereal::make_nvp("ek", m_expKS));
+        ar(::cereal::make_nvp("Q", m_Q));
+        ar(::cereal::make_nvp("sd", m_seeded));
+        if (m_seeded) {
+            std::vector<uint32_t> seed(m_seed.begin(), m_seed.end());
+            ar(::cereal::make_nvp("s", seed));
+        }
+        else {
+            ar(::cereal::make_nvp("a", PackA()));
+        }
+        ar(::cereal::make_nvp("b", PackB()));
     }
 
     template <class Archive>
@@ -478,18 +570,73 @@ public:
                                                  " is from a later version of the library");
         }
 
-        ar(::cereal::make_nvp("k", m_key));
+        if (version < 2) {
+            std::vector<std::vector<std::vector<LWECiphertextImpl>>> key;
+            ar(::cereal::make_nvp("k", key));
+            SetElements(key);
+            return;
+        }
+
+        uint32_t n, N, baseKS, expKS;
+        NativeInteger Q;
+        ar(::cereal::make_nvp("n", n));
+        ar(::cereal::make_nvp("N", N));
+        ar(::cereal::make_nvp("bk", baseKS));
+        ar(::cereal::make_nvp("ek", expKS));
+        ar(::cereal::make_nvp("Q", Q));
+        *this = LWESwitchingKey(n, N, baseKS, expKS, Q);
+
+        bool seeded;
+        ar(::cereal::make_nvp("sd", seeded));
+        if (seeded) {
+            std::vector<uint32_t> seed;
+            ar(::cereal::make_nvp("s", seed));
+            if (seed.size() != m_seed.size())
+                OPENFHE_THROW(deserialize_error, "invalid seed size for the key switching key");
+            std::array<uint32_t, 16> seedArray;
+            std::copy(seed.begin(), seed.end(), seedArray.begin());
+            ExpandA(seedArray);
+        }
+        else {
+            NativeVector a;
+            ar(::cereal::make_nvp("a", a));
+            UnpackA(a);
+        }
+
+        NativeVector b;
+        ar(::cereal::make_nvp("b", b));
+        UnpackB(b);
     }
 
     std::string SerializedObjectName() const {
         return "LWEPrivateKey";
     }
     static uint32_t SerializedVersion() {
-        return 1;
+        return 2;
     }
 
 private:
-    std::vector<std::vector<std::vector<LWECiphertextImpl>>> m_key;
+    // the tables are serialized as NativeVectors, without the row padding
+    NativeVector PackA() const;
+    NativeVector PackB() const;
+    void UnpackA(const NativeVector& a);
+    void UnpackB(const NativeVector& b);
+
+    size_t RowIndex(uint32_t i, uint32_t digit, uint32_t j) const {
+        return (static_cast<size_t>(i) * m_baseKS + digit) * m_expKS + j;
+    }
+
+    uint32_t m_n      = 0;
+    uint32_t m_N      = 0;
+    uint32_t m_baseKS = 0;
+    uint32_t m_expKS  = 0;
+    // row length of the "a" table, n rounded up to a multiple of a cache line
+    size_t m_stride = 0;
+    NativeInteger m_Q;
+    bool m_seeded = false;
+    std::array<uint32_t, 16> m_seed{};
+    std::vector<BasicInteger, AlignedAllocator<BasicInteger>> m_a;
+    std::vector<BasicInteger> m_b;
 };
 
 }  // namespace lbcrypto
@@ -59,13 +59,21 @@ enum BINGATE { OR, AND, NOR, NAND, XOR_FAST, XNOR_FAST, XOR, XNOR };
 // on both bootstrapping techniques
 enum BINFHEMETHOD { AP, GINX };
 
+// Two backends are supported for the external products in the accumulator:
+// NTT over Z_Q (exact) and negacyclic FFT in double precision, which keeps
+// the refreshing key in the FFT domain (see fftcore.h)
+enum BINFHEACCBACKEND { NTT_BACKEND, FFT_BACKEND };
+
+class RingGSWBTKeyFFT;
+
 /**
  * @brief Class that stores all parameters for the RingGSW scheme used in
  * bootstrapping
  */
 class RingGSWCryptoParams : public Serializable {
 public:
-    RingGSWCryptoParams() : m_baseG(0), m_digitsG(0), m_digitsG2(0), m_baseR(0), m_method(GINX) {}
+    RingGSWCryptoParams()
+        : m_baseG(0), m_digitsG(0), m_digitsG2(0), m_baseR(0), m_method(GINX), m_accBackend(NTT_BACKEND) {}
 
     /**
    * Main constructor for RingGSWCryptoParams
@@ -77,7 +85,7 @@ public:
    */
     explicit RingGSWCryptoParams(const std::shared_ptr<LWECryptoParams> lweparams, uint32_t baseG, uint32_t baseR,
                                  BINFHEMETHOD method, bool signEval = false)
-        : m_LWEParams(lweparams), m_baseG(baseG), m_baseR(baseR), m_method(method) {
+        : m_LWEParams(lweparams), m_baseG(baseG), m_baseR(baseR), m_method(method), m_accBackend(NTT_BACKEND) {
         if (!IsPowerOfTwo(baseG)) {
             OPENFHE_THROW(config_error, "Gadget base should be a power of two.");
         }
@@ -237,6 +245,14 @@ public:
         return m_method;
     }
 
+    BINFHEACCBACKEND GetAccBackend() const {
+        return m_accBackend;
+    }
+
+    void SetAccBackend(BINFHEACCBACKEND backend) {
+        m_accBackend = backend;
+    }
+
     bool operator==(const RingGSWCryptoParams& other) const {
         return *m_LWEParams == *other.m_LWEParams && m_baseR == other.m_baseR && m_baseG == other.m_baseG &&
                m_method == other.m_method;
@@ -252,6 +268,7 @@ public:
         ar(::cereal::make_nvp("bR", m_baseR));
         ar(::cereal::make_nvp("bG", m_baseG));
         ar(::cereal::make_nvp("method", m_method));
+        ar(::cereal::make_nvp("backend", m_accBackend));
     }
 
     template <class Archive>
@@ -264,6 +281,8 @@ public:
         ar(::cereal::make_nvp("bR", m_baseR));
         ar(::cereal::make_nvp("bG", m_baseG));
         ar(::cereal::make_nvp("method", m_method));
+        if (version > 1)
+            ar(::cereal::make_nvp("backend", m_accBackend));
 
         this->PreCompute();
     }
@@ -272,7 +291,7 @@ public:
         return "RingGSWCryptoParams";
     }
     static uint32_t SerializedVersion() {
-        return 1;
+        return 2;
     }
 
     void SetQ(NativeInteger q) {
@@ -326,6 +345,9 @@ private:
 
     // Bootstrapping method (AP or GINX)
     BINFHEMETHOD m_method;
+
+    // Backend for the external products in the accumulator (NTT or FFT)
+    BINFHEACCBACKEND m_accBackend;
 };
 
 /**
@@ -514,6 +536,8 @@ typedef struct {
     std::shared_ptr<RingGSWBTKey> BSkey;
     // switching key
     std::shared_ptr<LWESwitchingKey> KSkey;
+    // refreshing key in the FFT domain (only for the FFT accumulator backend)
+    std::shared_ptr<RingGSWBTKeyFFT> BSkeyFFT;
 } RingGSWEvalKey;
 
 }  // namespace lbcrypto
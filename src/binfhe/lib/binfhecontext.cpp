@@ -257,6 +257,50 @@ void BinFHEContext::BTKeyGen(ConstLWEPrivateKey sk, NativeInteger DiffQ) {
     }
 }
 
+void BinFHEContext::BTKeyLoad(const RingGSWEvalKey& key) {
+    m_BTKey = key;
+    if ((m_params->GetAccBackend() == FFT_BACKEND) && (m_BTKey.BSkey != nullptr) && (m_BTKey.BSkeyFFT == nullptr))
+        m_BTKey.BSkeyFFT = std::make_shared<RingGSWBTKeyFFT>(m_params, *m_BTKey.BSkey);
+}
+
+void BinFHEContext::BTKeyMapLoadSingleElement(const uint32_t& baseG, const RingGSWEvalKey& key) {
+    m_BTKey_map[baseG] = key;
+    if ((m_params->GetAccBackend() == FFT_BACKEND) && (key.BSkey != nullptr) && (key.BSkeyFFT == nullptr)) {
+        auto params = m_params;
+        if (baseG != m_params->GetBaseG()) {
+            params = std::make_shared<RingGSWCryptoParams>(*m_params);
+            params->Change_BaseG(baseG);
+        }
+        m_BTKey_map[baseG].BSkeyFFT = std::make_shared<RingGSWBTKeyFFT>(params, *key.BSkey);
+    }
+}
+
+void BinFHEContext::SetAccumulatorBackend(BINFHEACCBACKEND backend) {
+    if ((backend == FFT_BACKEND) && !RingGSWBTKeyFFT::IsPrecisionSufficient(m_params)) {
+        std::string errMsg(
+            "ERROR: the gadget base and the modulus Q are too large for the FFT accumulator backend; "
+            "please use the NTT backend for these parameters.");
+        OPENFHE_THROW(config_error, errMsg);
+    }
+    m_params->SetAccBackend(backend);
+
+    // convert (or release) the FFT-domain copies of the keys already loaded
+    auto mapCopy = m_BTKey_map;
+    for (auto& element : mapCopy) {
+        element.second.BSkeyFFT.reset();
+        BTKeyMapLoadSingleElement(element.first, element.second);
+    }
+    auto search = m_BTKey_map.find(m_params->GetBaseG());
+    if ((search != m_BTKey_map.end()) && (search->second.BSkey == m_BTKey.BSkey)) {
+        m_BTKey = search->second;
+    }
+    else {
+        RingGSWEvalKey key = m_BTKey;
+        key.BSkeyFFT.reset();
+        BTKeyLoad(key);
+    }
+}
+
 LWECiphertext BinFHEContext::EvalBinGate(const BINGATE gate, ConstLWECiphertext ct1, ConstLWECiphertext ct2) const {
     return m_RingGSWscheme->EvalBinGate(m_params, gate, m_BTKey, ct1, ct2, m_LWEscheme);
 }
@@ -278,6 +322,12 @@ LWECiphertext BinFHEContext::EvalFunc(ConstLWECiphertext ct1, const std::vector<
     return m_RingGSWscheme->EvalFunc(m_params, m_BTKey, ct1, m_LWEscheme, LUT, beta, 0);
 }
 
+std::vector<LWECiphertext> BinFHEContext::EvalFuncMulti(ConstLWECiphertext ct1,
+                                                        const std::vector<std::vector<NativeInteger>>& LUTs) const {
+    NativeInteger beta = GetBeta();
+    return m_RingGSWscheme->EvalFuncMulti(m_params, m_BTKey, ct1, m_LWEscheme, LUTs, beta, 0);
+}
+
 LWECiphertext BinFHEContext::EvalFloor(ConstLWECiphertext ct1, const uint32_t roundbits) const {
     auto q = m_params->GetLWEParams()->Getq().ConvertToInt();
     if (roundbits != 0) {
@@ -0,0 +1,282 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Negacyclic double-precision FFT and FFT-domain refreshing keys
+ */
+
+#include "fftcore.h"
+
+#include <cmath>
+#include <string>
+
+namespace lbcrypto {
+
+// headroom, in bits, between the FFT roundoff error and the rounding threshold of 1/2
+constexpr double FFT_ROUNDOFF_MARGIN_BITS = 2;
+// bounds the size of the FFT-domain refreshing key, which grows linearly with the number of key pieces
+constexpr uint32_t FFT_MAX_KEY_PIECES = 4;
+
+NegacyclicFFT::NegacyclicFFT(uint32_t N) : m_N(N), m_M(N >> 1) {
+    if (N < 2 || !IsPowerOfTwo(N)) {
+        OPENFHE_THROW(config_error, "The ring dimension for the negacyclic FFT should be a power of two.");
+    }
+
+    uint32_t logM = 0;
+    while ((1u << logM) < m_M)
+        logM++;
+    m_bitRev.resize(m_M);
+    for (uint32_t j = 0; j < m_M; j++) {
+        uint32_t r = 0;
+        for (uint32_t b = 0; b < logM; b++)
+            r |= ((j >> b) & 1) << (logM - 1 - b);
+        m_bitRev[j] = r;
+    }
+
+    const double pi = std::acos(-1.0);
+
+    m_twistRe.resize(m_M);
+    m_twistIm.resize(m_M);
+    for (uint32_t j = 0; j < m_M; j++) {
+        m_twistRe[j] = std::cos(pi * j / N);
+        m_twistIm[j] = std::sin(pi * j / N);
+    }
+
+    m_rootRe.resize(m_M > 1 ? m_M : 1);
+    m_rootIm.resize(m_M > 1 ? m_M : 1);
+    for (uint32_t h = 1; h < m_M; h <<= 1) {
+        for (uint32_t j = 0; j < h; j++) {
+            m_rootRe[h + j] = std::cos(pi * j / h);
+            m_rootIm[h + j] = std::sin(pi * j / h);
+        }
+    }
+
+    m_cycRe.resize(2 * N);
+    m_cycIm.resize(2 * N);
+    for (uint32_t t = 0; t < 2 * N; t++) {
+        m_cycRe[t] = std::cos(pi * t / N);
+        m_cycIm[t] = std::sin(pi * t / N);
+    }
+}
+
+// iterative radix-2 decimation in time on bit-reversed input
+void NegacyclicFFT::Butterflies(double* re, double* im, bool inverse) const {
+    const double sign = inverse ? -1.0 : 1.0;
+    for (uint32_t h = 1; h < m_M; h <<= 1) {
+        const double* wRe = &m_rootRe[h];
+        const double* wIm = &m_rootIm[h];
+        for (uint32_t i = 0; i < m_M; i += 2 * h) {
+            double* uRe = re + i;
+            double* uIm = im + i;
+            double* vRe = re + i + h;
+            double* vIm = im + i + h;
+            for (uint32_t j = 0; j < h; j++) {
+                double wi = sign * wIm[j];
+                double xr = vRe[j] * wRe[j] - vIm[j] * wi;
+                double xi = vRe[j] * wi + vIm[j] * wRe[j];
+                vRe[j]    = uRe[j] - xr;
+                vIm[j]    = uIm[j] - xi;
+                uRe[j] += xr;
+                uIm[j] += xi;
+            }
+        }
+    }
+}
+
+void NegacyclicFFT::Forward(const double* in, double* re, double* im) const {
+    // fold a_j + i*a_{j+N/2}, twist and permute in one pass
+    for (uint32_t j = 0; j < m_M; j++) {
+        double r       = in[j];
+        double s       = in[j + m_M];
+        uint32_t k     = m_bitRev[j];
+        re[k]          = r * m_twistRe[j] - s * m_twistIm[j];
+        im[k]          = r * m_twistIm[j] + s * m_twistRe[j];
+    }
+    Butterflies(re, im, false);
+}
+
+void NegacyclicFFT::Inverse(double* re, double* im, double* out) const {
+    for (uint32_t j = 0; j < m_M; j++) {
+        uint32_t k = m_bitRev[j];
+        if (j < k) {
+            std::swap(re[j], re[k]);
+            std::swap(im[j], im[k]);
+        }
+    }
+    Butterflies(re, im, true);
+
+    // untwist, scale and unfold
+    const double scale = 1.0 / m_M;
+    for (uint32_t j = 0; j < m_M; j++) {
+        double r     = re[j] * scale;
+        double s     = im[j] * scale;
+        out[j]       = r * m_twistRe[j] + s * m_twistIm[j];
+        out[j + m_M] = s * m_twistRe[j] - r * m_twistIm[j];
+    }
+}
+
+void NegacyclicFFT::MonomialMinusOne(uint32_t m, double* re, double* im) const {
+    // X^m at x_s = exp(i*pi*(4s+1)/N) is exp(i*pi*(4s+1)*m/N)
+    const uint64_t twoN = 2 * static_cast<uint64_t>(m_N);
+    const uint64_t step = (4 * static_cast<uint64_t>(m)) % twoN;
+    uint64_t t          = m % twoN;
+    for (uint32_t s = 0; s < m_M; s++) {
+        re[s] = m_cycRe[t] - 1.0;
+        im[s] = m_cycIm[t];
+        t += step;
+        if (t >= twoN)
+            t -= twoN;
+    }
+}
+
+// Chooses how many signed pieces of pieceBits bits each element of Z_Q of the
+// refreshing key is split into, so that the external product of a gadget digit
+// polynomial with every piece is exact in double precision; returns false if
+// more than FFT_MAX_KEY_PIECES pieces would be needed
+static bool SplitKeyCoefficients(const std::shared_ptr<RingGSWCryptoParams> params, uint32_t* pieceBits,
+                                 uint32_t* pieces) {
+    const double logN    = std::log2(static_cast<double>(params->GetLWEParams()->GetN()));
+    const NativeInteger Q = params->GetLWEParams()->GetQ();
+    // bit size of the largest coefficient of an external product without the key factor:
+    // digitsG2 rows of N products of a signed digit, and the two GINX monomials X^m - 1
+    const double digitBits = std::log2(static_cast<double>(params->GetDigitsG2())) + logN +
+                             std::log2(static_cast<double>(params->GetBaseG()) / 2) + 2;
+    // the roundoff error of the transforms grows with N; it has to stay well below 1/2
+    // for the rounded result to be exact
+    const double budget = 53 - logN - FFT_ROUNDOFF_MARGIN_BITS - digitBits;
+
+    const uint32_t QBits = Q.GetMSB();
+    if (std::log2(Q.ConvertToDouble() / 2) <= budget) {
+        *pieceBits = QBits;
+        *pieces    = 1;
+        return true;
+    }
+    // balanced pieces are below 2^(pieceBits - 1) in absolute value, except the
+    // most significant one, which is at most 2^(pieceBits - 1) + 1; 2^pieceBits
+    // bounds all of them
+    if (budget < 1)
+        return false;
+    *pieceBits = static_cast<uint32_t>(budget);
+    *pieces    = (QBits + *pieceBits - 1) / *pieceBits;
+    return *pieces <= FFT_MAX_KEY_PIECES;
+}
+
+bool RingGSWBTKeyFFT::IsPrecisionSufficient(const std::shared_ptr<RingGSWCryptoParams> params) {
+    uint32_t pieceBits, pieces;
+    return SplitKeyCoefficients(params, &pieceBits, &pieces);
+}
+
+RingGSWBTKeyFFT::RingGSWBTKeyFFT(const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWBTKey& key) {
+    uint32_t pieceBits;
+    if (!SplitKeyCoefficients(params, &pieceBits, &m_pieces)) {
+        std::string errMsg =
+            "ERROR: the gadget base and the modulus Q are too large for the FFT accumulator backend; "
+            "please use the NTT backend for these parameters.";
+        OPENFHE_THROW(config_error, errMsg);
+    }
+
+    const uint32_t N = params->GetLWEParams()->GetN();
+    m_fft            = std::make_shared<NegacyclicFFT>(N);
+
+    const auto& elements = key.GetElements();
+    const uint32_t dim1  = elements.size();
+    m_dim2               = (dim1 > 0) ? elements[0].size() : 0;
+    m_dim3               = (m_dim2 > 0) ? elements[0][0].size() : 0;
+    m_rows               = params->GetDigitsG2();
+
+    const uint32_t M = m_fft->GetSize();
+    m_data.assign(static_cast<size_t>(dim1) * m_dim2 * m_dim3 * m_rows * 2 * m_pieces * 2 * M, 0.0);
+
+    const NativeInteger Q       = params->GetLWEParams()->GetQ();
+    const int64_t QInt          = Q.ConvertToInt<int64_t>();
+    const int64_t QHalf         = QInt >> 1;
+    const int64_t pieceMod      = int64_t(1) << pieceBits;
+    const int64_t pieceHalf     = pieceMod >> 1;
+
+    // 2^(pieceBits * p) mod Q recombines the partial products
+    m_pieceFactors.resize(m_pieces);
+    NativeInteger factor(1);
+    for (uint32_t p = 0; p < m_pieces; p++) {
+        m_pieceFactors[p] = factor;
+        if (p + 1 < m_pieces)
+            factor = factor.ModMul(NativeInteger(pieceMod).Mod(Q), Q);
+    }
+
+    // entries that are never used by the accumulator (e.g., the zero digit in
+    // AP) are left empty by the key generation
+    for (uint32_t i = 0; i < dim1; i++)
+        for (uint32_t j = 0; j < m_dim2; j++)
+            for (uint32_t k = 0; k < m_dim3; k++) {
+                size_t rows = elements[i][j][k].GetElements().size();
+                if ((rows != 0) && (rows != m_rows))
+                    OPENFHE_THROW(config_error, "The refreshing key does not match the gadget decomposition");
+            }
+
+#pragma omp parallel for
+    for (uint32_t i = 0; i < dim1; i++) {
+        std::vector<int64_t> centered(N);
+        std::vector<double> coeffs(N);
+        for (uint32_t j = 0; j < m_dim2; j++) {
+            for (uint32_t k = 0; k < m_dim3; k++) {
+                const auto& ct = elements[i][j][k].GetElements();
+                if (ct.empty())
+                    continue;
+                for (uint32_t row = 0; row < m_rows; row++) {
+                    for (uint32_t col = 0; col < 2; col++) {
+                        NativePoly poly = ct[row][col];
+                        poly.SetFormat(Format::COEFFICIENT);
+                        for (uint32_t l = 0; l < N; l++) {
+                            int64_t c   = poly[l].ConvertToInt<int64_t>();
+                            centered[l] = (c > QHalf) ? c - QInt : c;
+                        }
+                        // balanced digits in base 2^pieceBits, the last piece takes the rest
+                        for (uint32_t p = 0; p < m_pieces; p++) {
+                            for (uint32_t l = 0; l < N; l++) {
+                                int64_t r = centered[l];
+                                if (p + 1 < m_pieces) {
+                                    r = ((r % pieceMod) + pieceMod) % pieceMod;
+                                    if (r >= pieceHalf)
+                                        r -= pieceMod;
+                                    centered[l] = (centered[l] - r) >> pieceBits;
+                                }
+                                coeffs[l] = static_cast<double>(r);
+                            }
+                            size_t offset = Offset(i, j, k, row, col, p);
+                            m_fft->Forward(coeffs.data(), &m_data[offset], &m_data[offset + M]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+}  // namespace lbcrypto
@@ -45,6 +45,9 @@
  */
 
 #include "fhew.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <string>
 
 namespace lbcrypto {
@@ -154,10 +157,11 @@ std::shared_ptr<RingGSWCiphertext> RingGSWAccumulatorScheme::EncryptGINX(
 RingGSWEvalKey RingGSWAccumulatorScheme::KeyGen(const std::shared_ptr<RingGSWCryptoParams> params,
                                                 const std::shared_ptr<LWEEncryptionScheme> lwescheme,
                                                 const std::shared_ptr<const LWEPrivateKeyImpl> LWEsk) const {
-    if (params->GetMethod() == AP)
-        return KeyGenAP(params, lwescheme, LWEsk);
-    else  // GINX
-        return KeyGenGINX(params, lwescheme, LWEsk);
+    RingGSWEvalKey ek =
+        (params->GetMethod() == AP) ? KeyGenAP(params, lwescheme, LWEsk) : KeyGenGINX(params, lwescheme, LWEsk);
+    if (params->GetAccBackend() == FFT_BACKEND)
+        ek.BSkeyFFT = std::make_shared<RingGSWBTKeyFFT>(params, *ek.BSkey);
+    return ek;
 }
 
 // Key generation as described in Section 4 of https://eprint.iacr.org/2014/816
@@ -418,6 +422,218 @@ void RingGSWAccumulatorScheme::AddToACCGINX(const std::shared_ptr<RingGSWCryptoP
     }
 }
 
+// Signed digit decomposition for the FFT backend; same digits as above, but
+// stored as doubles in a single buffer of digitsG2 rows of N coefficients
+void RingGSWAccumulatorScheme::SignedDigitDecompose(const std::shared_ptr<RingGSWCryptoParams> params,
+                                                    const std::vector<NativePoly>& input,
+                                                    std::vector<double>* output) const {
+    uint32_t N                           = params->GetLWEParams()->GetN();
+    uint32_t digitsG                     = params->GetDigitsG();
+    NativeInteger Q                      = params->GetLWEParams()->GetQ();
+    NativeInteger QHalf                  = Q >> 1;
+    NativeInteger::SignedNativeInt Q_int = Q.ConvertToInt();
+
+    NativeInteger::SignedNativeInt baseG        = NativeInteger(params->GetBaseG()).ConvertToInt();
+    NativeInteger::SignedNativeInt gBits        = (NativeInteger::SignedNativeInt)std::log2(baseG);
+    NativeInteger::SignedNativeInt gBitsMaxBits = NativeInteger::MaxBits() - gBits;
+
+    for (uint32_t j = 0; j < 2; j++) {
+        for (uint32_t k = 0; k < N; k++) {
+            NativeInteger t                  = input[j][k];
+            NativeInteger::SignedNativeInt d = (t < QHalf) ? (NativeInteger::SignedNativeInt)t.ConvertToInt() :
+                                                             (NativeInteger::SignedNativeInt)t.ConvertToInt() - Q_int;
+
+            for (uint32_t l = 0; l < digitsG; l++) {
+                NativeInteger::SignedNativeInt r = d << gBitsMaxBits;
+                r >>= gBitsMaxBits;
+                d -= r;
+                d >>= gBits;
+                (*output)[(j + 2 * l) * N + k] = static_cast<double>(r);
+            }
+        }
+    }
+}
+
+// Adds the rounded coefficients of res, multiplied by factor, to poly (or
+// overwrites poly) mod Q
+static void AddRoundedToPoly(const std::vector<double>& res, const NativeInteger& Q, const NativeInteger& factor,
+                             bool overwrite, NativePoly* poly) {
+    int64_t Q_int = Q.ConvertToInt<int64_t>();
+    bool scale    = (factor != NativeInteger(1));
+    for (uint32_t k = 0; k < res.size(); k++) {
+        int64_t v = std::llround(res[k]) % Q_int;
+        if (v < 0)
+            v += Q_int;
+        NativeInteger t(v);
+        if (scale)
+            t.ModMulEq(factor, Q);
+        if (overwrite)
+            (*poly)[k] = t;
+        else
+            (*poly)[k].ModAddFastEq(t, Q);
+    }
+}
+
+// AP Accumulation with the FFT backend; acc is in COEFFICIENT format
+void RingGSWAccumulatorScheme::AddToACCAPFFT(const std::shared_ptr<RingGSWCryptoParams> params,
+                                             const RingGSWBTKeyFFT& key, uint32_t i, uint32_t j, uint32_t k,
+                                             std::shared_ptr<RingGSWCiphertext> acc) const {
+    uint32_t N               = params->GetLWEParams()->GetN();
+    uint32_t digitsG2        = params->GetDigitsG2();
+    NativeInteger Q          = params->GetLWEParams()->GetQ();
+    const NegacyclicFFT& fft = key.GetFFT();
+    uint32_t M               = fft.GetSize();
+
+    std::vector<double> dct(digitsG2 * N);
+    SignedDigitDecompose(params, acc->GetElements()[0], &dct);
+
+    // calls digitsG2 FFTs of size N/2
+    std::vector<double> dctFFT(2 * digitsG2 * M);
+    for (uint32_t l = 0; l < digitsG2; l++)
+        fft.Forward(&dct[l * N], &dctFFT[2 * l * M], &dctFFT[(2 * l + 1) * M]);
+
+    // acc = dct * input (matrix product), one exact product per key piece
+    std::vector<double> sumRe(M), sumIm(M), res(N);
+    for (uint32_t col = 0; col < 2; col++) {
+        for (uint32_t p = 0; p < key.GetNumPieces(); p++) {
+            std::fill(sumRe.begin(), sumRe.end(), 0.0);
+            std::fill(sumIm.begin(), sumIm.end(), 0.0);
+            for (uint32_t l = 0; l < digitsG2; l++) {
+                const double* dRe = &dctFFT[2 * l * M];
+                const double* dIm = &dctFFT[(2 * l + 1) * M];
+                const double* kRe = key.GetRe(i, j, k, l, col, p);
+                const double* kIm = key.GetIm(i, j, k, l, col, p);
+                for (uint32_t s = 0; s < M; s++) {
+                    sumRe[s] += dRe[s] * kRe[s] - dIm[s] * kIm[s];
+                    sumIm[s] += dRe[s] * kIm[s] + dIm[s] * kRe[s];
+                }
+            }
+            fft.Inverse(sumRe.data(), sumIm.data(), res.data());
+            AddRoundedToPoly(res, Q, key.GetPieceFactor(p), p == 0, &(*acc)[0][col]);
+        }
+    }
+}
+
+// GINX Accumulation with the FFT backend; acc is in COEFFICIENT format
+void RingGSWAccumulatorScheme::AddToACCGINXFFT(const std::shared_ptr<RingGSWCryptoParams> params,
+                                               const RingGSWBTKeyFFT& key, uint32_t i, const NativeInteger& a,
+                                               std::shared_ptr<RingGSWCiphertext> acc) const {
+    // cycltomic order
+    uint32_t m               = 2 * params->GetLWEParams()->GetN();
+    uint32_t N               = params->GetLWEParams()->GetN();
+    uint32_t digitsG2        = params->GetDigitsG2();
+    int64_t q                = params->GetLWEParams()->Getq().ConvertToInt();
+    NativeInteger Q          = params->GetLWEParams()->GetQ();
+    const NegacyclicFFT& fft = key.GetFFT();
+    uint32_t M               = fft.GetSize();
+
+    std::vector<double> dct(digitsG2 * N);
+    SignedDigitDecompose(params, acc->GetElements()[0], &dct);
+
+    // calls digitsG2 FFTs of size N/2
+    std::vector<double> dctFFT(2 * digitsG2 * M);
+    for (uint32_t l = 0; l < digitsG2; l++)
+        fft.Forward(&dct[l * N], &dctFFT[2 * l * M], &dctFFT[(2 * l + 1) * M]);
+
+    // First obtain both monomial(index) for sk = 1 and monomial(-index) for sk = -1
+    auto aNeg         = params->GetLWEParams()->Getq().ModSub(a, q);
+    uint64_t index    = a.ConvertToInt() * (m / q);
+    uint64_t indexNeg = aNeg.ConvertToInt() * (m / q);
+    std::vector<double> monoRe(M), monoIm(M), monoNegRe(M), monoNegIm(M);
+    fft.MonomialMinusOne(index % m, monoRe.data(), monoIm.data());
+    fft.MonomialMinusOne(indexNeg % m, monoNegRe.data(), monoNegIm.data());
+
+    // acc = acc + dct * input1 * monomial + dct * input2 * negative_monomial;
+    // both products are summed in the FFT domain, so only one inverse FFT is
+    // needed per accumulator element and key piece
+    std::vector<double> tRe(M), tIm(M), sumRe(M), sumIm(M), res(N);
+    for (uint32_t col = 0; col < 2; col++) {
+        for (uint32_t p = 0; p < key.GetNumPieces(); p++) {
+            std::fill(sumRe.begin(), sumRe.end(), 0.0);
+            std::fill(sumIm.begin(), sumIm.end(), 0.0);
+            for (uint32_t input = 0; input < 2; input++) {
+                const double* mRe = (input == 0) ? monoRe.data() : monoNegRe.data();
+                const double* mIm = (input == 0) ? monoIm.data() : monoNegIm.data();
+                std::fill(tRe.begin(), tRe.end(), 0.0);
+                std::fill(tIm.begin(), tIm.end(), 0.0);
+                for (uint32_t l = 0; l < digitsG2; l++) {
+                    const double* dRe = &dctFFT[2 * l * M];
+                    const double* dIm = &dctFFT[(2 * l + 1) * M];
+                    const double* kRe = key.GetRe(0, input, i, l, col, p);
+                    const double* kIm = key.GetIm(0, input, i, l, col, p);
+                    for (uint32_t s = 0; s < M; s++) {
+                        tRe[s] += dRe[s] * kRe[s] - dIm[s] * kIm[s];
+                        tIm[s] += dRe[s] * kIm[s] + dIm[s] * kRe[s];
+                    }
+                }
+                for (uint32_t s = 0; s < M; s++) {
+                    sumRe[s] += tRe[s] * mRe[s] - tIm[s] * mIm[s];
+                    sumIm[s] += tRe[s] * mIm[s] + tIm[s] * mRe[s];
+                }
+            }
+            fft.Inverse(sumRe.data(), sumIm.data(), res.data());
+            AddRoundedToPoly(res, Q, key.GetPieceFactor(p), false, &(*acc)[0][col]);
+        }
+    }
+}
+
+// Blind rotation of the accumulator by the LWE mask "a" using the refreshing key
+void RingGSWAccumulatorScheme::EvalAcc(const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK,
+                                       const NativeVector& a, std::shared_ptr<RingGSWCiphertext> acc) const {
+    NativeInteger q                    = params->GetLWEParams()->Getq();
+    uint32_t baseR                     = params->GetBaseR();
+    uint32_t n                         = params->GetLWEParams()->Getn();
+    std::vector<NativeInteger> digitsR = params->GetDigitsR();
+
+    if (params->GetAccBackend() == FFT_BACKEND) {
+        if (EK.BSkeyFFT == nullptr) {
+            std::string errMsg =
+                "The refreshing key in the FFT domain has not been generated. Please call BTKeyGen "
+                "or BTKeyLoad after selecting the FFT backend.";
+            OPENFHE_THROW(config_error, errMsg);
+        }
+        const RingGSWBTKeyFFT& key = *EK.BSkeyFFT;
+
+        // the FFT backend updates the accumulator in COEFFICIENT format
+        acc->SetFormat(Format::COEFFICIENT);
+        if (params->GetMethod() == AP) {
+            for (uint32_t i = 0; i < n; i++) {
+                NativeInteger aI = q.ModSub(a[i], q);
+                for (uint32_t k = 0; k < digitsR.size(); k++, aI /= NativeInteger(baseR)) {
+                    uint32_t a0 = (aI.Mod(baseR)).ConvertToInt();
+                    if (a0)
+                        this->AddToACCAPFFT(params, key, i, a0, k, acc);
+                }
+            }
+        }
+        else {  // if GINX
+            for (uint32_t i = 0; i < n; i++) {
+                // handles -a*E(1) and handles -a*E(-1) = a*E(1)
+                this->AddToACCGINXFFT(params, key, i, q.ModSub(a[i], q), acc);
+            }
+        }
+        acc->SetFormat(Format::EVALUATION);
+        return;
+    }
+
+    if (params->GetMethod() == AP) {
+        for (uint32_t i = 0; i < n; i++) {
+            NativeInteger aI = q.ModSub(a[i], q);
+            for (uint32_t k = 0; k < digitsR.size(); k++, aI /= NativeInteger(baseR)) {
+                uint32_t a0 = (aI.Mod(baseR)).ConvertToInt();
+                if (a0)
+                    this->AddToACCAP(params, (*EK.BSkey)[i][a0][k], acc);
+            }
+        }
+    }
+    else {  // if GINX
+        for (uint32_t i = 0; i < n; i++) {
+            // handles -a*E(1) and handles -a*E(-1) = a*E(1)
+            this->AddToACCGINX(params, (*EK.BSkey)[0][0][i], (*EK.BSkey)[0][1][i], q.ModSub(a[i], q), acc);
+        }
+    }
+}
+
 std::shared_ptr<RingGSWCiphertext> RingGSWAccumulatorScheme::BootstrapCore(
     const std::shared_ptr<RingGSWCryptoParams> params, const BINGATE gate, const RingGSWEvalKey& EK,
     const NativeVector& a, const NativeInteger& b, const std::shared_ptr<LWEEncryptionScheme> LWEscheme) const {
@@ -432,9 +648,6 @@ std::shared_ptr<RingGSWCiphertext> RingGSWAccumulatorScheme::BootstrapCore(
     NativeInteger q                                  = params->GetLWEParams()->Getq();
     NativeInteger Q                                  = params->GetLWEParams()->GetQ();
     uint32_t N                                       = params->GetLWEParams()->GetN();
-    uint32_t baseR                                   = params->GetBaseR();
-    uint32_t n                                       = params->GetLWEParams()->Getn();
-    std::vector<NativeInteger> digitsR               = params->GetDigitsR();
 
     // Specifies the range [q1,q2) that will be used for mapping
     uint32_t qHalf   = q.ConvertToInt() >> 1;
@@ -471,22 +684,7 @@ std::shared_ptr<RingGSWCiphertext> RingGSWAccumulatorScheme::BootstrapCore(
     auto acc  = std::make_shared<RingGSWCiphertext>(1, 2);
     (*acc)[0] = std::move(res);
 
-    if (params->GetMethod() == AP) {
-        for (uint32_t i = 0; i < n; i++) {
-            NativeInteger aI = q.ModSub(a[i], q);
-            for (uint32_t k = 0; k < digitsR.size(); k++, aI /= NativeInteger(baseR)) {
-                uint32_t a0 = (aI.Mod(baseR)).ConvertToInt();
-                if (a0)
-                    this->AddToACCAP(params, (*EK.BSkey)[i][a0][k], acc);
-            }
-        }
-    }
-    else {  // if GINX
-        for (uint32_t i = 0; i < n; i++) {
-            // handles -a*E(1) and handles -a*E(-1) = a*E(1)
-            this->AddToACCGINX(params, (*EK.BSkey)[0][0][i], (*EK.BSkey)[0][1][i], q.ModSub(a[i], q), acc);
-        }
-    }
+    EvalAcc(params, EK, a, acc);
 
     return acc;
 }
@@ -650,9 +848,6 @@ std::shared_ptr<RingGSWCiphertext> RingGSWAccumulatorScheme::BootstrapCore(
     NativeInteger q                                  = params->GetLWEParams()->Getq();
     NativeInteger Q                                  = params->GetLWEParams()->GetQ();
     uint32_t N                                       = params->GetLWEParams()->GetN();
-    uint32_t baseR                                   = params->GetBaseR();
-    uint32_t n                                       = params->GetLWEParams()->Getn();
-    std::vector<NativeInteger> digitsR               = params->GetDigitsR();
 
     NativeVector m(params->GetLWEParams()->GetN(), params->GetLWEParams()->GetQ());
     // For specific function evaluation instead of general bootstrapping
@@ -675,22 +870,7 @@ std::shared_ptr<RingGSWCiphertext> RingGSWAccumulatorScheme::BootstrapCore(
     auto acc  = std::make_shared<RingGSWCiphertext>(1, 2);
     (*acc)[0] = std::move(res);
 
-    if (params->GetMethod() == AP) {
-        for (uint32_t i = 0; i < n; i++) {
-            NativeInteger aI = q.ModSub(a[i], q);
-            for (uint32_t k = 0; k < digitsR.size(); k++, aI /= NativeInteger(baseR)) {
-                uint32_t a0 = (aI.Mod(baseR)).ConvertToInt();
-                if (a0)
-                    this->AddToACCAP(params, (*EK.BSkey)[i][a0][k], acc);
-            }
-        }
-    }
-    else {  // if GINX
-        for (uint32_t i = 0; i < n; i++) {
-            // handles -a*E(1) and handles -a*E(-1) = a*E(1)
-            this->AddToACCGINX(params, (*EK.BSkey)[0][0][i], (*EK.BSkey)[0][1][i], q.ModSub(a[i], q), acc);
-        }
-    }
+    EvalAcc(params, EK, a, acc);
 
     return acc;
 }
@@ -739,6 +919,163 @@ std::shared_ptr<LWECiphertextImpl> RingGSWAccumulatorScheme::Bootstrap(
     return LWEscheme->ModSwitch(bigger_q, eQ);
 }
 
+// Multi-value bootstrapping as described in https://eprint.iacr.org/2018/622:
+// every test vector is factored as TV_i = v_0 * v_i mod X^N + 1, where the
+// shared v_0 = unit/2 * (1 + X + ... + X^{N-1}) is the only polynomial that goes
+// through the blind rotation, and v_i = (1 - X) * t_i has small coefficients
+// since t_i is constant on runs of 2N/q coefficients.
+//
+// Multiplying the accumulator by v_i also multiplies its error e by v_i, so the
+// error of LUT i is bounded by ||v_i||_1 * |e| instead of |e|. A LUT shares the
+// blind rotation only while ||v_i||_1 * |e| * q/Q <= beta/4, where |e| is taken
+// as 4 standard deviations of the error of 2n external products with d digits
+// of base B, i.e. 4 * sigma * B * sqrt(2 * n * d * N / 12). The other LUTs are
+// bootstrapped one at a time, exactly as EvalFunc does.
+template <typename Func>
+std::vector<std::shared_ptr<LWECiphertextImpl>> RingGSWAccumulatorScheme::BootstrapMulti(
+    const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK,
+    const std::shared_ptr<const LWECiphertextImpl> ct1, const std::shared_ptr<LWEEncryptionScheme> LWEscheme,
+    const std::vector<std::vector<NativeInteger>>& LUTs, const Func f, const NativeInteger beta,
+    const NativeInteger bigger_q) const {
+    if ((EK.BSkey == nullptr) || (EK.KSkey == nullptr)) {
+        std::string errMsg =
+            "Bootstrapping keys have not been generated. Please call BTKeyGen "
+            "before calling bootstrapping.";
+        OPENFHE_THROW(config_error, errMsg);
+    }
+
+    const std::shared_ptr<ILNativeParams> polyParams = params->GetPolyParams();
+    NativeInteger q                                  = params->GetLWEParams()->Getq();
+    NativeInteger Q                                  = params->GetLWEParams()->GetQ();
+    uint32_t N                                       = params->GetLWEParams()->GetN();
+    uint32_t factor                                  = (2 * N / q.ConvertToInt());
+    uint32_t qHalf                                   = q.ConvertToInt() >> 1;
+
+    const NativeVector& a = ct1->GetA();
+    const NativeInteger& b = ct1->GetB();
+
+    // tables[i][j] = f(LUTs[i], b - j) for j in [0, q/2), reduced mod bigger_q;
+    // steps[i] is the largest step of the entries of LUT i, and norms[i] is
+    // ||(1 - X) * tables[i]||_1 for the centered entries
+    const uint64_t bigQ = bigger_q.ConvertToInt<uint64_t>();
+    auto centered       = [bigQ](const NativeInteger& x) -> int64_t {
+        uint64_t t = x.ConvertToInt<uint64_t>();
+        return (2 * t > bigQ) ? static_cast<int64_t>(t) - static_cast<int64_t>(bigQ) : static_cast<int64_t>(t);
+    };
+    std::vector<std::vector<NativeInteger>> tables(LUTs.size(), std::vector<NativeInteger>(qHalf));
+    std::vector<uint64_t> steps(LUTs.size(), bigQ);
+    std::vector<uint64_t> norms(LUTs.size(), 0);
+    for (size_t i = 0; i < LUTs.size(); i++) {
+        for (uint32_t j = 0; j < qHalf; j++) {
+            tables[i][j] = f(LUTs[i], b.ModSub(j, q), q, bigger_q).Mod(bigger_q);
+            steps[i]     = std::gcd(steps[i], tables[i][j].ConvertToInt<uint64_t>());
+        }
+        norms[i] = std::abs(centered(tables[i][0]) + centered(tables[i][qHalf - 1]));
+        for (uint32_t j = 1; j < qHalf; j++)
+            norms[i] += std::abs(centered(tables[i][j]) - centered(tables[i][j - 1]));
+    }
+
+    // ||v_i||_1 = norms[i] / unit, where unit is the largest common step of the
+    // shared LUTs; dropping a LUT over the budget can only increase the unit,
+    // so this converges to the LUTs that can share the blind rotation
+    const auto& lweParams = params->GetLWEParams();
+    const double errAcc   = 4 * lweParams->GetDgg().GetStd() * params->GetBaseG() *
+                          std::sqrt(2.0 * lweParams->Getn() * params->GetDigitsG() * N / 12.0);
+    const double budget   = beta.ConvertToDouble() / 4 * Q.ConvertToDouble() / (errAcc * q.ConvertToDouble());
+    std::vector<bool> shared(LUTs.size(), true);
+    uint64_t unit = bigQ;
+    for (bool changed = true; changed;) {
+        unit = bigQ;
+        for (size_t i = 0; i < LUTs.size(); i++) {
+            if (shared[i])
+                unit = std::gcd(unit, steps[i]);
+        }
+        changed = false;
+        for (size_t i = 0; i < LUTs.size(); i++) {
+            if (shared[i] && static_cast<double>(norms[i] / unit) > budget) {
+                shared[i] = false;
+                changed   = true;
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<LWECiphertextImpl>> result(LUTs.size());
+    for (size_t i = 0; i < LUTs.size(); i++) {
+        if (!shared[i]) {
+            const auto& LUT = LUTs[i];
+            auto fi         = [&f, &LUT](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+                return f(LUT, x, q, Q);
+            };
+            result[i] = Bootstrap(params, EK, ct1, LWEscheme, fi, bigger_q);
+        }
+    }
+    if (std::find(shared.begin(), shared.end(), true) == shared.end())
+        return result;
+
+    // v_0 = (Q/bigger_q) * unit * 2^{-1} * (1 + X + ... + X^{N-1}); 2 is invertible as Q is an odd prime
+    NativeInteger scale = Q / bigger_q;
+    scale               = scale.ModMul(NativeInteger(unit), Q).ModMul(NativeInteger(2).ModInverse(Q), Q);
+    NativeVector m(N, Q);
+    for (uint32_t k = 0; k < N; k++)
+        m[k] = scale;
+
+    std::vector<NativePoly> res(2);
+    // no need to do NTT as all coefficients of this poly are zero
+    res[0] = NativePoly(polyParams, Format::EVALUATION, true);
+    res[1] = NativePoly(polyParams, Format::COEFFICIENT, false);
+    res[1].SetValues(std::move(m), Format::COEFFICIENT);
+    res[1].SetFormat(Format::EVALUATION);
+
+    // main accumulation computation, shared by all LUTs
+    auto acc  = std::make_shared<RingGSWCiphertext>(1, 2);
+    (*acc)[0] = std::move(res);
+
+    EvalAcc(params, EK, a, acc);
+
+    // centered lift of tables[i][j] / unit; unit divides both the entry and bigger_q
+    auto lift = [&centered, unit](const NativeInteger& x) -> int64_t {
+        return centered(x) / static_cast<int64_t>(unit);
+    };
+
+    for (size_t i = 0; i < LUTs.size(); i++) {
+        if (!shared[i])
+            continue;
+        // v_i = (1 - X) * t_i is nonzero only where t_i changes value
+        NativeVector v(N, Q);
+        for (uint32_t j = 0; j < qHalf; j++) {
+            int64_t diff   = (j == 0) ? lift(tables[i][0]) + lift(tables[i][qHalf - 1]) :
+                                        lift(tables[i][j]) - lift(tables[i][j - 1]);
+            v[j * factor] = (diff >= 0) ? NativeInteger(diff) : Q - NativeInteger(-diff);
+        }
+        NativePoly vPoly(polyParams, Format::COEFFICIENT, false);
+        vPoly.SetValues(std::move(v), Format::COEFFICIENT);
+        vPoly.SetFormat(Format::EVALUATION);
+
+        // the accumulator result is encrypted w.r.t. the transposed secret key
+        // we can transpose "a" to get an encryption under the original secret key
+        NativePoly temp = (*acc)[0][0] * vPoly;
+        temp            = temp.Transpose();
+        temp.SetFormat(Format::COEFFICIENT);
+        NativeVector aNew = temp.GetValues();
+
+        temp = (*acc)[0][1] * vPoly;
+        temp.SetFormat(Format::COEFFICIENT);
+        NativeInteger bNew = temp[0];
+
+        // Modulus switching to a middle step Q'
+        auto eQN =
+            LWEscheme->ModSwitch(params->GetLWEParams()->GetqKS(), std::make_shared<LWECiphertextImpl>(aNew, bNew));
+
+        // Key switching
+        const std::shared_ptr<const LWECiphertextImpl> eQ = LWEscheme->KeySwitch(params->GetLWEParams(), EK.KSkey, eQN);
+
+        // Modulus switching
+        result[i] = LWEscheme->ModSwitch(bigger_q, eQ);
+    }
+
+    return result;
+}
+
 // Check what type of function the input function is.
 int checkInputFunction(std::vector<NativeInteger> lut, NativeInteger bigger_q) {
     int ret = 0;  // 0 for negacyclic, 1 for periodic, 2 for arbitrary
@@ -847,6 +1184,116 @@ std::shared_ptr<LWECiphertextImpl> RingGSWAccumulatorScheme::EvalFunc(
     return Bootstrap(params, EK, ct2_adj, LWEscheme, f_neg, bigger_q_local);
 }
 
+// Evaluate several arbitrary functions homomorphically; LUTs are grouped by
+// their type and each group is evaluated with the same number of blind
+// rotations as a single EvalFunc call
+std::vector<std::shared_ptr<LWECiphertextImpl>> RingGSWAccumulatorScheme::EvalFuncMulti(
+    const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK,
+    const std::shared_ptr<const LWECiphertextImpl> ct1, const std::shared_ptr<LWEEncryptionScheme> LWEscheme,
+    const std::vector<std::vector<NativeInteger>>& LUTs, const NativeInteger beta, const NativeInteger bigger_q) const {
+    NativeInteger q              = params->GetLWEParams()->Getq();
+    NativeInteger bigger_q_local = bigger_q;
+    if (bigger_q == 0)
+        bigger_q_local = q;
+
+    std::vector<std::shared_ptr<LWECiphertextImpl>> result(LUTs.size());
+    if (LUTs.empty())
+        return result;
+
+    // Sort the LUTs by function type
+    std::vector<size_t> indices[3];
+    for (size_t i = 0; i < LUTs.size(); i++) {
+        if (LUTs[i].size() != q.ConvertToInt()) {
+            std::string errMsg = "ERROR: the size of each LUT should be equal to the ciphertext modulus q";
+            OPENFHE_THROW(config_error, errMsg);
+        }
+        indices[checkInputFunction(LUTs[i], bigger_q_local)].push_back(i);
+    }
+    auto select = [&LUTs](const std::vector<size_t>& idx) {
+        std::vector<std::vector<NativeInteger>> selected;
+        selected.reserve(idx.size());
+        for (auto i : idx)
+            selected.push_back(LUTs[i]);
+        return selected;
+    };
+
+    auto a1  = ct1->GetA();
+    auto b1  = ct1->GetB();
+    b1       = b1.ModAddFast(beta, q);
+    auto ct0 = std::make_shared<LWECiphertextImpl>(std::move(a1), std::move(b1));
+
+    if (!indices[0].empty()) {  // negacyclic functions only need one bootstrap
+        auto f_neg = [](const std::vector<NativeInteger>& LUT, NativeInteger x, NativeInteger q,
+                        NativeInteger Q) -> NativeInteger { return LUT[x.ConvertToInt()]; };
+
+        auto cts = BootstrapMulti(params, EK, ct0, LWEscheme, select(indices[0]), f_neg, beta, q);
+        for (size_t i = 0; i < cts.size(); i++)
+            result[indices[0][i]] = std::move(cts[i]);
+    }
+
+    if (!indices[1].empty()) {  // periodic functions share both bootstraps
+        auto f1 = [](NativeInteger x, NativeInteger q, NativeInteger Q) -> NativeInteger {
+            if (x < q / 2)
+                return Q - q / 4;
+            else
+                return q / 4;
+        };
+
+        auto ct2 = Bootstrap(params, EK, ct0, LWEscheme, f1, q);  // this is 1/4q_small or -1/4q_small mod q
+        auto a2  = ct1->GetA() - ct2->GetA();
+        auto b2  = ct1->GetB().ModAddFast(beta, q).ModSubFast(ct2->GetB(), q);
+        b2       = b2.ModSubFast(q / 4, q);
+
+        auto ct2_adj = std::make_shared<LWECiphertextImpl>(std::move(a2), std::move(b2));
+
+        auto f_neg = [](const std::vector<NativeInteger>& LUT, NativeInteger x, NativeInteger q,
+                        NativeInteger Q) -> NativeInteger {
+            if (x < q / 2)
+                return LUT[x.ConvertToInt()];
+            else
+                return Q - LUT[x.ConvertToInt() - q.ConvertToInt() / 2];
+        };
+
+        // Now the input is within the range [0, q/2).
+        auto cts = BootstrapMulti(params, EK, ct2_adj, LWEscheme, select(indices[1]), f_neg, beta, bigger_q_local);
+        for (size_t i = 0; i < cts.size(); i++)
+            result[indices[1][i]] = std::move(cts[i]);
+    }
+
+    if (!indices[2].empty()) {  // arbitrary functions
+        uint32_t N = params->GetLWEParams()->GetN();
+        if (q > N) {  // need q to be at most = N for arbitary function
+            std::string errMsg =
+                "ERROR: ciphertext modulus q needs to be <= ring dimension for arbitrary function evaluation";
+            OPENFHE_THROW(not_implemented_error, errMsg);
+        }
+
+        a1 = ct1->GetA();
+        // mod up to 2q, so the encryption of m is then encryption of m or encryption of m+q (both with prob roughly 1/2)
+        a1.SetModulus(q * 2);
+        b1  = ct1->GetB();
+        ct0 = std::make_shared<LWECiphertextImpl>(std::move(a1), std::move(b1));
+        params->SetQ(q * 2);
+
+        auto LUTs_local = select(indices[2]);
+        for (size_t i = 0; i < LUTs_local.size(); i++) {
+            const auto& LUT = LUTs[indices[2][i]];
+            LUTs_local[i].insert(LUTs_local[i].end(), LUT.begin(), LUT.end());  // repeat the LUT to make it periodic
+        }
+        // re-evaluate since they are now periodic
+        auto cts = EvalFuncMulti(params, EK, ct0, LWEscheme, LUTs_local, beta, bigger_q_local * 2);
+        params->SetQ(q);
+
+        for (size_t i = 0; i < cts.size(); i++) {
+            auto a2               = cts[i]->GetA().Mod(bigger_q_local);
+            auto b2               = cts[i]->GetB().Mod(bigger_q_local);
+            result[indices[2][i]] = std::make_shared<LWECiphertextImpl>(std::move(a2), std::move(b2));
+        }
+    }
+
+    return result;
+}
+
 // Evaluate Homomorphic Flooring
 std::shared_ptr<LWECiphertextImpl> RingGSWAccumulatorScheme::EvalFloor(
     const std::shared_ptr<RingGSWCryptoParams> params, const RingGSWEvalKey& EK,
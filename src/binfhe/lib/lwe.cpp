@@ -193,43 +193,44 @@ std::shared_ptr<LWESwitchingKey> LWEEncryptionScheme::KeySwitchGen(
         }
     }
 
-    DiscreteUniformGeneratorImpl<NativeVector> dug;
-    dug.SetModulus(Q);
-
     NativeInteger mu = Q.ComputeMu();
 
-    std::vector<std::vector<std::vector<LWECiphertextImpl>>> resultVec(N);
+    auto K = std::make_shared<LWESwitchingKey>(n, N, baseKS, expKS, Q);
+
+    // the "a" parts are expanded from a seed, so that the key can be stored
+    // and transferred as the seed and the "b" parts only
+    std::array<uint32_t, 16> seed{};
+    PRNG& prng = PseudoRandomNumberGenerator::GetPRNG();
+    for (uint32_t i = 0; i + 1 < seed.size(); ++i)
+        seed[i] = prng();
+    K->ExpandA(seed);
 
 #pragma omp parallel for
     for (uint32_t i = 0; i < N; ++i) {
-        std::vector<std::vector<LWECiphertextImpl>> vector1(baseKS);
         for (uint32_t j = 0; j < baseKS; ++j) {
-            std::vector<LWECiphertextImpl> vector2(expKS);
             for (uint32_t k = 0; k < expKS; ++k) {
                 NativeInteger b =
                     (params->GetDggKS().GenerateInteger(Q)).ModAdd(oldSK[i].ModMul(j * digitsKS[k], Q), Q);
 
-                NativeVector a = dug.GenerateVector(n);
+                const BasicInteger* a = K->GetA(i, j, k);
 
 #if NATIVEINT == 32
-                for (uint32_t i = 0; i < n; ++i) {
-                    b.ModAddFastEq(a[i].ModMulFast(newSK[i], Q, mu), Q);
+                for (uint32_t l = 0; l < n; ++l) {
+                    b.ModAddFastEq(NativeInteger(a[l]).ModMulFast(newSK[l], Q, mu), Q);
                 }
 #else
-                for (uint32_t i = 0; i < n; ++i) {
-                    b += a[i].ModMulFast(newSK[i], Q, mu);
+                for (uint32_t l = 0; l < n; ++l) {
+                    b += NativeInteger(a[l]).ModMulFast(newSK[l], Q, mu);
                 }
                 b.ModEq(Q);
 #endif
 
-                vector2[k] = LWECiphertextImpl(a, b);
+                K->GetB(i, j, k) = b.ConvertToInt<BasicInteger>();
             }
-            vector1[j] = std::move(vector2);
         }
-        resultVec[i] = std::move(vector1);
     }
 
-    return std::make_shared<LWESwitchingKey>(LWESwitchingKey(resultVec));
+    return K;
 }
 
 // the key switching operation as described in Section 3 of
@@ -244,22 +245,38 @@ std::shared_ptr<LWECiphertextImpl> LWEEncryptionScheme::KeySwitch(
     std::vector<NativeInteger> digitsKS = params->GetDigitsKS();
     uint32_t expKS                      = digitsKS.size();
 
-    // creates an empty vector
-    NativeVector a(n, Q);
-    NativeInteger b   = ctQN->GetB();
-    NativeVector aOld = ctQN->GetA();
+    if (K->Getn() != n || K->GetN() != N || K->GetBaseKS() != baseKS || K->GetExpKS() != expKS ||
+        K->GetModulus() != Q)
+        OPENFHE_THROW(config_error, "The key switching key does not match the LWE parameters");
+
+    const BasicInteger Qv = Q.ConvertToInt<BasicInteger>();
+
+    std::vector<BasicInteger, AlignedAllocator<BasicInteger>> acc(n, 0);
+    BasicInteger b          = ctQN->GetB().ConvertToInt<BasicInteger>();
+    const NativeVector& aOld = ctQN->GetA();
 
     for (uint32_t i = 0; i < N; ++i) {
-        NativeInteger atmp = aOld[i];
+        BasicInteger atmp = aOld[i].ConvertToInt<BasicInteger>();
         for (uint32_t j = 0; j < expKS; ++j, atmp /= baseKS) {
-            uint64_t a0 = (atmp % baseKS).ConvertToInt();
-            for (uint32_t k = 0; k < n; ++k)
-                a[k].ModSubFastEq((K->GetElements()[i][a0][j]).GetA()[k], Q);
-            b.ModSubFastEq((K->GetElements()[i][a0][j]).GetB(), Q);
+            const uint32_t a0       = static_cast<uint32_t>(atmp % baseKS);
+            const BasicInteger* row = K->GetA(i, a0, j);
+            BasicInteger* accData   = acc.data();
+            // branch-free modular subtraction over contiguous rows, so that the
+            // compiler can vectorize the loop
+            for (uint32_t k = 0; k < n; ++k) {
+                BasicInteger diff = accData[k] - row[k];
+                accData[k]        = (accData[k] < row[k]) ? diff + Qv : diff;
+            }
+            const BasicInteger kb = K->GetB(i, a0, j);
+            b                     = (b < kb) ? b + Qv - kb : b - kb;
         }
     }
 
-    return std::make_shared<LWECiphertextImpl>(LWECiphertextImpl(a, b));
+    NativeVector a(n, Q);
+    for (uint32_t k = 0; k < n; ++k)
+        a[k] = acc[k];
+
+    return std::make_shared<LWECiphertextImpl>(LWECiphertextImpl(std::move(a), NativeInteger(b)));
 }
 
 // noiseless LWE embedding
@@ -0,0 +1,166 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Out-of-line members of the LWE key switching key
+ */
+
+#include "lwecore.h"
+#include "math/distributiongenerator.h"
+
+namespace lbcrypto {
+
+LWESwitchingKey::LWESwitchingKey(uint32_t n, uint32_t N, uint32_t baseKS, uint32_t expKS, const NativeInteger& Q)
+    : m_n(n), m_N(N), m_baseKS(baseKS), m_expKS(expKS), m_Q(Q) {
+    // pad each row of "a" to a cache line so that every row starts aligned
+    const size_t rowAlign = 64 / sizeof(BasicInteger);
+    m_stride              = (n + rowAlign - 1) / rowAlign * rowAlign;
+
+    const size_t rows = static_cast<size_t>(N) * baseKS * expKS;
+    m_a.assign(rows * m_stride, 0);
+    m_b.assign(rows, 0);
+}
+
+void LWESwitchingKey::ExpandA(const std::array<uint32_t, 16>& seed) {
+    m_seed   = seed;
+    m_seeded = true;
+
+    // rejection sampling on the bit length of Q keeps the values uniform and
+    // does not depend on the standard library's distributions
+    const BasicInteger Q  = m_Q.ConvertToInt<BasicInteger>();
+    const uint32_t bits   = m_Q.GetMSB();
+    const uint64_t mask   = (bits >= 64) ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+
+#pragma omp parallel for
+    for (uint32_t i = 0; i < m_N; ++i) {
+        std::array<uint32_t, 16> seedI = seed;
+        seedI[15]                      = i;
+        PRNG engine(seedI);
+        for (uint32_t digit = 0; digit < m_baseKS; ++digit) {
+            for (uint32_t j = 0; j < m_expKS; ++j) {
+                BasicInteger* a = GetA(i, digit, j);
+                for (uint32_t k = 0; k < m_n; ++k) {
+                    uint64_t value;
+                    do {
+                        // the two draws are sequenced explicitly so that the expansion does not
+                        // depend on the compiler's evaluation order
+                        const uint64_t hi = engine();
+                        const uint64_t lo = engine();
+                        value             = ((hi << 32) | lo) & mask;
+                    } while (value >= Q);
+                    a[k] = value;
+                }
+            }
+        }
+    }
+}
+
+std::vector<std::vector<std::vector<LWECiphertextImpl>>> LWESwitchingKey::GetElements() const {
+    std::vector<std::vector<std::vector<LWECiphertextImpl>>> key(m_N);
+    for (uint32_t i = 0; i < m_N; ++i) {
+        key[i].resize(m_baseKS);
+        for (uint32_t digit = 0; digit < m_baseKS; ++digit) {
+            key[i][digit].resize(m_expKS);
+            for (uint32_t j = 0; j < m_expKS; ++j) {
+                const BasicInteger* a = GetA(i, digit, j);
+                NativeVector aVec(m_n, m_Q);
+                for (uint32_t k = 0; k < m_n; ++k)
+                    aVec[k] = a[k];
+                key[i][digit][j] = LWECiphertextImpl(std::move(aVec), NativeInteger(GetB(i, digit, j)));
+            }
+        }
+    }
+    return key;
+}
+
+void LWESwitchingKey::SetElements(const std::vector<std::vector<std::vector<LWECiphertextImpl>>>& key) {
+    if (key.empty() || key[0].empty() || key[0][0].empty()) {
+        *this = LWESwitchingKey();
+        return;
+    }
+
+    const auto& first = key[0][0][0].GetA();
+    *this             = LWESwitchingKey(first.GetLength(), key.size(), key[0].size(), key[0][0].size(), first.GetModulus());
+
+    for (uint32_t i = 0; i < m_N; ++i) {
+        if (key[i].size() != m_baseKS)
+            OPENFHE_THROW(config_error, "the key switching key has rows of different sizes");
+        for (uint32_t digit = 0; digit < m_baseKS; ++digit) {
+            if (key[i][digit].size() != m_expKS)
+                OPENFHE_THROW(config_error, "the key switching key has rows of different sizes");
+            for (uint32_t j = 0; j < m_expKS; ++j) {
+                const NativeVector& aVec = key[i][digit][j].GetA();
+                if (aVec.GetLength() != m_n)
+                    OPENFHE_THROW(config_error, "the key switching key has ciphertexts of different dimensions");
+                BasicInteger* a = GetA(i, digit, j);
+                for (uint32_t k = 0; k < m_n; ++k)
+                    a[k] = aVec[k].ConvertToInt<BasicInteger>();
+                GetB(i, digit, j) = key[i][digit][j].GetB().ConvertToInt<BasicInteger>();
+            }
+        }
+    }
+}
+
+NativeVector LWESwitchingKey::PackA() const {
+    const size_t rows = m_b.size();
+    NativeVector a(rows * m_n, m_Q);
+    for (size_t r = 0; r < rows; ++r) {
+        for (uint32_t k = 0; k < m_n; ++k)
+            a[r * m_n + k] = m_a[r * m_stride + k];
+    }
+    return a;
+}
+
+NativeVector LWESwitchingKey::PackB() const {
+    NativeVector b(m_b.size(), m_Q);
+    for (size_t r = 0; r < m_b.size(); ++r)
+        b[r] = m_b[r];
+    return b;
+}
+
+void LWESwitchingKey::UnpackA(const NativeVector& a) {
+    const size_t rows = m_b.size();
+    if (a.GetLength() != rows * m_n)
+        OPENFHE_THROW(deserialize_error, "invalid size of the key switching key");
+    for (size_t r = 0; r < rows; ++r) {
+        for (uint32_t k = 0; k < m_n; ++k)
+            m_a[r * m_stride + k] = a[r * m_n + k].ConvertToInt<BasicInteger>();
+    }
+}
+
+void LWESwitchingKey::UnpackB(const NativeVector& b) {
+    if (b.GetLength() != m_b.size())
+        OPENFHE_THROW(deserialize_error, "invalid size of the key switching key");
+    for (size_t r = 0; r < m_b.size(); ++r)
+        m_b[r] = b[r].ConvertToInt<BasicInteger>();
+}
+
+};  // namespace lbcrypto
@@ -76,6 +76,71 @@ TEST(UnitTestFHEWAP, KeySwitch) {
     EXPECT_EQ(0, resultAfterKeySwitch0) << "Failed key switching test";
 }
 
+// Checks the contiguous layout and the seeded "a" parts of the key switching key
+TEST(UnitTestFHEWGINX, KeySwitchKeyLayout) {
+    auto cc = BinFHEContext();
+
+    cc.GenerateBinFHEContext(TOY, GINX);
+
+    auto sk  = cc.KeyGen();
+    auto skN = cc.KeyGenN();
+
+    auto keySwitchHint = cc.KeySwitchGen(sk, skN);
+    EXPECT_TRUE(keySwitchHint->IsSeeded()) << "Key switching key was not expanded from a seed";
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        const BasicInteger* a = keySwitchHint->GetA(i, 1, 0);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a) % 64) << "Key switching key row is not aligned";
+    }
+
+    // the same seed gives the same "a" parts
+    LWESwitchingKey expanded(keySwitchHint->Getn(), keySwitchHint->GetN(), keySwitchHint->GetBaseKS(),
+                             keySwitchHint->GetExpKS(), keySwitchHint->GetModulus());
+    expanded.ExpandA(keySwitchHint->GetSeed());
+    bool sameA = true;
+    for (uint32_t i = 0; i < keySwitchHint->GetN() && sameA; ++i) {
+        for (uint32_t digit = 0; digit < keySwitchHint->GetBaseKS(); ++digit) {
+            for (uint32_t j = 0; j < keySwitchHint->GetExpKS(); ++j) {
+                sameA = sameA && std::equal(expanded.GetA(i, digit, j), expanded.GetA(i, digit, j) + expanded.Getn(),
+                                            keySwitchHint->GetA(i, digit, j));
+            }
+        }
+    }
+    EXPECT_TRUE(sameA) << "Seed expansion is not deterministic";
+
+    // the nested representation round-trips and switches keys identically
+    auto rebuilt = std::make_shared<LWESwitchingKey>(keySwitchHint->GetElements());
+    EXPECT_TRUE(*rebuilt == *keySwitchHint) << "Key switching key does not round-trip through GetElements";
+    EXPECT_FALSE(rebuilt->IsSeeded());
+
+    auto ctQN = cc.Encrypt(skN, 1, FRESH);
+    auto eQ   = cc.GetLWEScheme()->KeySwitch(cc.GetParams()->GetLWEParams(), keySwitchHint, ctQN);
+    auto eQr  = cc.GetLWEScheme()->KeySwitch(cc.GetParams()->GetLWEParams(), rebuilt, ctQN);
+    EXPECT_EQ(*eQ, *eQr) << "Key switching differs for the rebuilt key";
+}
+
+// Pins the first expanded words of the key switching key for a fixed seed
+TEST(UnitTestFHEWGINX, KeySwitchKeyExpansionKnownAnswer) {
+    std::array<uint32_t, 16> seed;
+    for (uint32_t i = 0; i < seed.size(); ++i)
+        seed[i] = i + 1;
+
+    LWESwitchingKey key(8, 2, 2, 1, NativeInteger(1 << 14));
+    key.ExpandA(seed);
+    const std::vector<BasicInteger> expected = {1711, 2836, 9665, 334, 13323, 14762, 70, 3483};
+    std::vector<BasicInteger> words(key.GetA(0, 0, 0), key.GetA(0, 0, 0) + 4);
+    words.insert(words.end(), key.GetA(1, 1, 0), key.GetA(1, 1, 0) + 4);
+    EXPECT_EQ(expected, words) << "Key switching key expansion changed";
+
+    // a wide modulus also pins the order of the two 32-bit draws that make up a word
+    LWESwitchingKey keyWide(8, 2, 2, 1, NativeInteger((uint64_t(1) << 59) + 1));
+    keyWide.ExpandA(seed);
+    const std::vector<BasicInteger> expectedWide = {99094761377199678, 41076044107614996, 452078236054520142,
+                                                    107709818938542579};
+    EXPECT_EQ(expectedWide, std::vector<BasicInteger>(keyWide.GetA(0, 0, 0), keyWide.GetA(0, 0, 0) + 4))
+        << "Key switching key expansion changed";
+}
+
 // Checks the key switching operation
 TEST(UnitTestFHEWGINX, KeySwitch) {
     auto cc = BinFHEContext();
@@ -891,3 +956,97 @@ TEST(UnitTestFHEWGINX, XNOR_FAST) {
     EXPECT_EQ(0, result10) << failed;
     EXPECT_EQ(1, result00) << failed;
 }
+
+// Checks the FFT accumulator backend against the NTT one: with parameters
+// that pass the precision check, both backends give identical ciphertexts
+static void CheckFFTBackend(BinFHEContext& cc) {
+    auto sk = cc.KeyGen();
+    cc.BTKeyGen(sk);
+
+    auto ct1    = cc.Encrypt(sk, 1);
+    auto ct0    = cc.Encrypt(sk, 0);
+    auto ct1Alt = cc.Encrypt(sk, 1);
+
+    const std::vector<BINGATE> gates = {OR, AND, NOR, NAND, XOR_FAST, XNOR_FAST, XOR, XNOR};
+    std::vector<LWECiphertext> ctNTT;
+    for (auto gate : gates) {
+        ctNTT.push_back(cc.EvalBinGate(gate, ct1, ct0));
+        ctNTT.push_back(cc.EvalBinGate(gate, ct1, ct1Alt));
+    }
+
+    cc.SetAccumulatorBackend(FFT_BACKEND);
+    EXPECT_EQ(FFT_BACKEND, cc.GetAccumulatorBackend());
+
+    std::string failed = "FFT accumulator backend failed";
+    for (size_t i = 0; i < gates.size(); i++) {
+        auto ct10 = cc.EvalBinGate(gates[i], ct1, ct0);
+        auto ct11 = cc.EvalBinGate(gates[i], ct1, ct1Alt);
+        EXPECT_TRUE(*ct10 == *ctNTT[2 * i]) << failed;
+        EXPECT_TRUE(*ct11 == *ctNTT[2 * i + 1]) << failed;
+    }
+
+    // keys generated directly with the FFT backend
+    cc.BTKeyGen(sk);
+    auto ctAnd = cc.EvalBinGate(AND, ct1, ct1Alt);
+    auto ctNor = cc.EvalBinGate(NOR, ct1, ct0);
+    LWEPlaintext resultAnd;
+    cc.Decrypt(sk, ctAnd, &resultAnd);
+    LWEPlaintext resultNor;
+    cc.Decrypt(sk, ctNor, &resultNor);
+    EXPECT_EQ(1, resultAnd) << failed;
+    EXPECT_EQ(0, resultNor) << failed;
+}
+
+// a 23-bit Q and a gadget base of 16, for which the key does not need to be split
+TEST(UnitTestFHEWAP, FFTBackend) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(64, 512, NativeInteger(512), NativeInteger(8383489), 3.19, 25, 16, 23, AP);
+    CheckFFTBackend(cc);
+}
+
+TEST(UnitTestFHEWGINX, FFTBackend) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(64, 512, NativeInteger(512), NativeInteger(8383489), 3.19, 25, 16, 23, GINX);
+    CheckFFTBackend(cc);
+}
+
+// predefined sets, for which the key coefficients are split in two
+TEST(UnitTestFHEWAP, FFTBackendTOY) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(TOY, AP);
+    CheckFFTBackend(cc);
+}
+
+TEST(UnitTestFHEWGINX, FFTBackendSTD128) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(STD128, GINX);
+    CheckFFTBackend(cc);
+}
+
+// Checks that the FFT backend is rejected when double precision is not enough
+// even with the key coefficients split into the maximum number of pieces
+TEST(UnitTestFHEWGINX, FFTBackendPrecision) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(STD128Q, GINX);
+
+    EXPECT_THROW(cc.SetAccumulatorBackend(FFT_BACKEND), config_error);
+    EXPECT_EQ(NTT_BACKEND, cc.GetAccumulatorBackend());
+}
+
+// Checks the precision bound of the FFT backend: for N = 1024 and a 23-bit Q,
+// the key is used as is with a gadget base of 16 and split with a base of 32,
+// and the predefined sets other than STD128Q are accepted
+TEST(UnitTestFHEWGINX, FFTBackendPrecisionBoundary) {
+    for (uint32_t baseG : {16, 32}) {
+        auto cc = BinFHEContext();
+        cc.GenerateBinFHEContext(64, 1024, NativeInteger(512), NativeInteger(8380417), 3.19, 25, baseG, 23, GINX);
+        EXPECT_NO_THROW(cc.SetAccumulatorBackend(FFT_BACKEND));
+        EXPECT_EQ(FFT_BACKEND, cc.GetAccumulatorBackend());
+    }
+
+    for (auto set : {TOY, MEDIUM, STD128, STD128_AP, STD192, STD256, STD192Q, STD256Q}) {
+        auto cc = BinFHEContext();
+        cc.GenerateBinFHEContext(set, GINX);
+        EXPECT_NO_THROW(cc.SetAccumulatorBackend(FFT_BACKEND)) << "parameter set " << set;
+    }
+}
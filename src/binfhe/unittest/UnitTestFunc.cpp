@@ -70,6 +70,127 @@ TEST(UnitTestFHEWGINX, EvalArbFunc) {
     }
 }
 
+// Checks that several functions evaluated with one shared blind rotation
+// agree with the corresponding single-function evaluations
+TEST(UnitTestFHEWGINX, EvalArbFuncMulti) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(TOY, true, 12);
+
+    auto sk = cc.KeyGen();
+    cc.BTKeyGen(sk);
+    int p = cc.GetMaxPlaintextSpace().ConvertToInt();
+
+    // an arbitrary function, a periodic one and a negacyclic one
+    auto fcube = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m * m * m) % p1;
+    };
+    auto fhalf = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m * 3 + 1) % (p1 / 2);
+    };
+    auto fneg = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m < p1 / 2) ? m + 1 : p1 - (m - p1 / 2 + 1);
+    };
+    std::vector<NativeInteger (*)(NativeInteger, NativeInteger)> fs = {fcube, fhalf, fneg, fcube};
+
+    std::vector<std::vector<NativeInteger>> luts;
+    for (auto f : fs)
+        luts.push_back(cc.GenerateLUTviaFunction(f, p));
+
+    std::string failed = "Multi-Value Function Evaluation failed";
+    for (int i = 0; i < p; i++) {
+        auto ct1 = cc.Encrypt(sk, i % p, FRESH, p);
+
+        auto cts = cc.EvalFuncMulti(ct1, luts);
+        ASSERT_EQ(fs.size(), cts.size()) << failed;
+
+        for (size_t j = 0; j < fs.size(); j++) {
+            LWEPlaintext result;
+            cc.Decrypt(sk, cts[j], &result, p);
+            EXPECT_EQ(usint(fs[j](i, p).ConvertToInt()), result) << failed << " for LUT " << j;
+        }
+    }
+}
+
+// Checks multi-value evaluation of non-monotone functions with the standard
+// parameters and a plaintext space of at least 8, including a function that
+// changes value at every step
+TEST(UnitTestFHEWGINX, EvalArbFuncMultiSTD128) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(STD128, true, 12);
+
+    auto sk = cc.KeyGen();
+    cc.BTKeyGen(sk);
+    int p = cc.GetMaxPlaintextSpace().ConvertToInt();
+    ASSERT_GE(p, 8) << "the test needs a plaintext space of at least 8";
+
+    auto fcube = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m * m * m) % p1;
+    };
+    auto fzigzag = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m % 2 == 0) ? p1 / 2 : p1 / 2 - 1;
+    };
+    auto ftent = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m < p1 / 2) ? m : p1 - 1 - m;
+    };
+    std::vector<NativeInteger (*)(NativeInteger, NativeInteger)> fs = {fcube, fzigzag, ftent};
+
+    std::vector<std::vector<NativeInteger>> luts;
+    for (auto f : fs)
+        luts.push_back(cc.GenerateLUTviaFunction(f, p));
+
+    std::string failed = "Multi-Value Function Evaluation failed";
+    for (int i = 0; i < p; i++) {
+        auto ct1 = cc.Encrypt(sk, i % p, FRESH, p);
+
+        auto cts = cc.EvalFuncMulti(ct1, luts);
+        ASSERT_EQ(fs.size(), cts.size()) << failed;
+
+        for (size_t j = 0; j < fs.size(); j++) {
+            LWEPlaintext result;
+            cc.Decrypt(sk, cts[j], &result, p);
+            EXPECT_EQ(usint(fs[j](i, p).ConvertToInt()), result) << failed << " for LUT " << j;
+        }
+    }
+}
+
+// Checks multi-value evaluation with parameters whose bootstrapping error
+// leaves no room for a shared blind rotation, so that every LUT is
+// evaluated on its own
+TEST(UnitTestFHEWGINX, EvalArbFuncMultiFallback) {
+    auto cc = BinFHEContext();
+    cc.GenerateBinFHEContext(STD128);
+
+    auto sk = cc.KeyGen();
+    cc.BTKeyGen(sk);
+    int p = cc.GetMaxPlaintextSpace().ConvertToInt();
+
+    auto fcube = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m * m * m) % p1;
+    };
+    auto fzigzag = [](NativeInteger m, NativeInteger p1) -> NativeInteger {
+        return (m % 2 == 0) ? p1 / 2 : p1 / 2 - 1;
+    };
+    std::vector<NativeInteger (*)(NativeInteger, NativeInteger)> fs = {fcube, fzigzag};
+
+    std::vector<std::vector<NativeInteger>> luts;
+    for (auto f : fs)
+        luts.push_back(cc.GenerateLUTviaFunction(f, p));
+
+    std::string failed = "Multi-Value Function Evaluation failed";
+    for (int i = 0; i < p; i++) {
+        auto ct1 = cc.Encrypt(sk, i % p, FRESH, p);
+
+        auto cts = cc.EvalFuncMulti(ct1, luts);
+        ASSERT_EQ(fs.size(), cts.size()) << failed;
+
+        for (size_t j = 0; j < fs.size(); j++) {
+            LWEPlaintext result;
+            cc.Decrypt(sk, cts[j], &result, p);
+            EXPECT_EQ(usint(fs[j](i, p).ConvertToInt()), result) << failed << " for LUT " << j;
+        }
+    }
+}
+
 // Checks the rounding down evaluation
 TEST(UnitTestFHEWGINX, EvalFloorFunc) {
     auto cc = BinFHEContext();
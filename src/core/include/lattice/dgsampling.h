@@ -158,19 +158,19 @@ private:
     // Discrete sampling variant
     // As described in Figure 2 of https://eprint.iacr.org/2017/308.pdf
     static void Perturb(double sigma, size_t k, size_t n, const std::vector<double>& l, const std::vector<double>& h,
-                        int64_t base, typename Element::DggType& dgg, std::vector<int64_t>* p);
+                        int64_t base, typename Element::DggType& dgg, int64_t* p);
 
     // subroutine used by GaussSampGqArbBase
     // Continuous sampling variant
     // As described in Algorithm 3 of https://eprint.iacr.org/2017/844.pdf
     static void PerturbFloat(double sigma, size_t k, size_t n, const std::vector<double>& l,
-                             const std::vector<double>& h, int64_t base, typename Element::DggType& dgg,
-                             std::vector<double>* p);
+                             const std::vector<double>& h, int64_t base, typename Element::DggType& dgg, double* p);
 
     // subroutine used by GaussSampGq
     // As described in Algorithm 3 of https://eprint.iacr.org/2017/844.pdf
-    static void SampleC(const Matrix<double>& c, size_t k, size_t n, double sigma, typename Element::DggType& dgg,
-                        Matrix<double>* a, std::vector<int64_t>* z);
+    // a (k entries) is updated in place and z receives the k sampled integers
+    static void SampleC(const std::vector<double>& c, size_t k, size_t n, double sigma, typename Element::DggType& dgg,
+                        double* a, int64_t* z);
 
     // subroutine earlier used by ZSampleF
     // Algorithm utilizes the same permutation algorithm as discussed in
@@ -861,6 +861,17 @@ public:
    */
     virtual PolyLargeType CRTInterpolateIndex(usint i) const = 0;
 
+    /**
+   * @brief Computes the centered representatives in (-Q/2, Q/2] of the
+   * coefficients at the given indices, where Q is the product of the current
+   * moduli, and returns them in floating point. Uses mixed-radix (Garner)
+   * conversion in native arithmetic, so no multiprecision integers are built.
+   *
+   * @param &indices indices of the coefficients to reconstruct
+   * @return the reconstructed values, in the order of indices
+   */
+    virtual std::vector<double> CRTInterpolateCentered(const std::vector<usint>& indices) const = 0;
+
     /**
    * @brief Computes and returns the product of primes in the current moduli
    * chain. Compared to GetModulus, which always returns the product of all
@@ -1140,6 +1151,41 @@ public:
                                       const std::vector<double>& tOSHatInvModsDivsFrac,
                                       const std::vector<DoubleNativeInt>& modoBarretMu) const = 0;
 
+    /**
+   * @brief Computes scale and round followed by a CRT basis switch, fused into
+   * a single pass over the coefficients:
+   * {X}_{Q,P} -> {t/Q * X}_{P} -> {t/Q * X}_{Q}
+   * {Q} = {q_1,...,q_l}
+   * {P} = {p_1,...,p_k}
+   *
+   * Gives the same result as ScaleAndRound to P followed by SwitchCRTBasis to
+   * Q, but the residues modulo P of each coefficient are only kept in a small
+   * per-thread buffer instead of an intermediate polynomial.
+   *
+   * @param &paramsP parameters for the CRT basis {p_1,...,p_k}
+   * @param &paramsQ parameters for the CRT basis {q_1,...,q_l}
+   * @param &tPSHatInvModsDivsModp precomputed values for
+   * [\floor[t*P*[[SHatInv_k]_{s_k}/s_k]]_{p_j}
+   * @param &tPSHatInvModsDivsFrac precomputed values for
+   * {t*P*[[SHatInv_k]_{s_k}/s_k}
+   * @param &modpBarrettMu 128-bit Barrett reduction precomputed values for p_j
+   * @param &PHatInvModp [(P/p_j)^{-1}]_{p_j}
+   * @param &PHatInvModpPrecon NTL-specific precomputations
+   * @param &PHatModq [P/p_j]_{q_i}
+   * @param &alphaPModq [alpha*P]_{q_i} for 0 <= alpha <= sizeP
+   * @param &modqBarrettMu 128-bit Barrett reduction precomputed values for q_i
+   * @param &pInv 1/p_j for 0 <= j <= sizeP
+   * @return the result {t/Q * X}_{Q}
+   */
+    virtual DerivedType ScaleAndRoundSwitchCRTBasis(
+        const std::shared_ptr<Params> paramsP, const std::shared_ptr<Params> paramsQ,
+        const std::vector<std::vector<NativeInteger>>& tPSHatInvModsDivsModp,
+        const std::vector<double>& tPSHatInvModsDivsFrac, const std::vector<DoubleNativeInt>& modpBarrettMu,
+        const std::vector<NativeInteger>& PHatInvModp, const std::vector<NativeInteger>& PHatInvModpPrecon,
+        const std::vector<std::vector<NativeInteger>>& PHatModq,
+        const std::vector<std::vector<NativeInteger>>& alphaPModq, const std::vector<DoubleNativeInt>& modqBarrettMu,
+        const std::vector<double>& pInv) const = 0;
+
     /**
    * @brief Computes scale and round for fast rounding:
    * {X}_{Q} -> {\round(t/Q * X)}_t
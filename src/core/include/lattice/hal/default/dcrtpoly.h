@@ -481,7 +481,18 @@ public:
    * @return is the result of the automorphism transform.
    */
     DCRTPolyType AutomorphismTransform(usint i, const std::vector<usint>& vec) const override {
-        DCRTPolyType result(*this);
+        // validated here rather than in the towers, as the loop below is parallel
+        if ((this->m_format != Format::EVALUATION) || !this->m_params->OrderIsPowerOfTwo()) {
+            OPENFHE_THROW(not_implemented_error,
+                          "Precomputed automorphism is implemented only for power-of-two polynomials in the "
+                          "EVALUATION representation");
+        }
+        if (i % 2 == 0) {
+            OPENFHE_THROW(math_error, "automorphism index should be odd\n");
+        }
+        // the towers of the result are written directly by the permutation, so they are not copied first
+        DCRTPolyType result(this->m_params, this->m_format);
+#pragma omp parallel for
         for (usint k = 0; k < m_vectors.size(); k++) {
             result.m_vectors[k] = m_vectors[k].AutomorphismTransform(i, vec);
         }
@@ -790,6 +801,8 @@ public:
    */
     PolyLargeType CRTInterpolateIndex(usint i) const override;
 
+    std::vector<double> CRTInterpolateCentered(const std::vector<usint>& indices) const override;
+
     /**
    * @brief Computes and returns the product of primes in the current moduli
    * chain. Compared to GetModulus, which always returns the product of all
@@ -1118,6 +1131,41 @@ public:
                                const std::vector<double>& tOSHatInvModsDivsFrac,
                                const std::vector<DoubleNativeInt>& modoBarretMu) const override;
 
+    /**
+   * @brief Computes scale and round followed by a CRT basis switch, fused into
+   * a single pass over the coefficients:
+   * {X}_{Q,P} -> {t/Q * X}_{P} -> {t/Q * X}_{Q}
+   * {Q} = {q_1,...,q_l}
+   * {P} = {p_1,...,p_k}
+   *
+   * Gives the same result as ScaleAndRound to P followed by SwitchCRTBasis to
+   * Q, but the residues modulo P of each coefficient are only kept in a small
+   * per-thread buffer instead of an intermediate polynomial.
+   *
+   * @param &paramsP parameters for the CRT basis {p_1,...,p_k}
+   * @param &paramsQ parameters for the CRT basis {q_1,...,q_l}
+   * @param &tPSHatInvModsDivsModp precomputed values for
+   * [\floor[t*P*[[SHatInv_k]_{s_k}/s_k]]_{p_j}
+   * @param &tPSHatInvModsDivsFrac precomputed values for
+   * {t*P*[[SHatInv_k]_{s_k}/s_k}
+   * @param &modpBarrettMu 128-bit Barrett reduction precomputed values for p_j
+   * @param &PHatInvModp [(P/p_j)^{-1}]_{p_j}
+   * @param &PHatInvModpPrecon NTL-specific precomputations
+   * @param &PHatModq [P/p_j]_{q_i}
+   * @param &alphaPModq [alpha*P]_{q_i} for 0 <= alpha <= sizeP
+   * @param &modqBarrettMu 128-bit Barrett reduction precomputed values for q_i
+   * @param &pInv 1/p_j for 0 <= j <= sizeP
+   * @return the result {t/Q * X}_{Q}
+   */
+    DCRTPolyType ScaleAndRoundSwitchCRTBasis(
+        const std::shared_ptr<Params> paramsP, const std::shared_ptr<Params> paramsQ,
+        const std::vector<std::vector<NativeInteger>>& tPSHatInvModsDivsModp,
+        const std::vector<double>& tPSHatInvModsDivsFrac, const std::vector<DoubleNativeInt>& modpBarrettMu,
+        const std::vector<NativeInteger>& PHatInvModp, const std::vector<NativeInteger>& PHatInvModpPrecon,
+        const std::vector<std::vector<NativeInteger>>& PHatModq,
+        const std::vector<std::vector<NativeInteger>>& alphaPModq, const std::vector<DoubleNativeInt>& modqBarrettMu,
+        const std::vector<double>& pInv) const override;
+
     /**
    * @brief Computes scale and round for fast rounding:
    * {X}_{Q} -> {\round(t/Q * X)}_t
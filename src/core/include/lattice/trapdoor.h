@@ -38,8 +38,14 @@
 #ifndef LBCRYPTO_LATTICE_TRAPDOOR_H
 #define LBCRYPTO_LATTICE_TRAPDOOR_H
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "math/matrix.h"
 
@@ -475,6 +481,113 @@ public:
     }
 };
 
+/**
+ * @brief Counters reported by PerturbationPool
+ */
+struct PerturbationPoolStats {
+    // perturbations generated by the background workers
+    uint64_t produced = 0;
+    // perturbations handed out by Pop()
+    uint64_t consumed = 0;
+    // calls to Pop() that found the pool empty and sampled on the caller's thread
+    uint64_t misses = 0;
+    // perturbations currently waiting in the pool
+    size_t size = 0;
+};
+
+/**
+ * @brief Bounded pool of precomputed perturbation vectors for pre-image sampling.
+ *
+ * The offline stage of GaussSamp (RLWETrapdoorUtility::GaussSampOffline) does not
+ * depend on the syndrome, so it is run ahead of time by background worker threads.
+ * Pop() hands out each perturbation exactly once, to be passed to GaussSampOnline.
+ * The workers fill the pool up to depth and then sleep until the number of queued
+ * perturbations drops below the refill watermark. If the pool is empty, Pop()
+ * samples the perturbation on the caller's thread instead of waiting.
+ */
+template <class Element>
+class PerturbationPool {
+    using DggType = typename Element::DggType;
+
+public:
+    /**
+   * Creates the pool and starts the workers
+   *
+   * @param n ring dimension
+   * @param k matrix sample dimension; k = logq + 2
+   * @param &T trapdoor itself
+   * @param &dgg discrete Gaussian generator for integers
+   * @param &dggLargeSigma discrete Gaussian generator for perturbation vector sampling
+   * @param base base for G-lattice
+   * @param depth maximum number of queued perturbations
+   * @param watermark the workers resume refilling when fewer perturbations are queued
+   * @param numWorkers number of background threads
+   */
+    PerturbationPool(size_t n, size_t k, const RLWETrapdoorPair<Element>& T, const DggType& dgg,
+                     const DggType& dggLargeSigma, int64_t base = 2, size_t depth = 16, size_t watermark = 8,
+                     size_t numWorkers = 1);
+
+    /**
+   * Stops the workers and discards the queued perturbations
+   */
+    ~PerturbationPool();
+
+    PerturbationPool(const PerturbationPool&) = delete;
+    PerturbationPool& operator=(const PerturbationPool&) = delete;
+
+    /**
+   * Removes one perturbation from the pool. Rethrows the exception if a worker failed.
+   *
+   * @return perturbation vector for GaussSampOnline
+   */
+    std::shared_ptr<Matrix<Element>> Pop();
+
+    /**
+   * Pre-image sampling using a perturbation from the pool; the output matches GaussSamp
+   *
+   * @param &A public key of the trapdoor pair
+   * @param &u syndrome vector where gaussian that Gaussian sampling is centered around
+   * @param &dgg discrete Gaussian generator for integers
+   * @return the sampled vector (matrix)
+   */
+    Matrix<Element> GaussSamp(const Matrix<Element>& A, const Element& u, DggType& dgg) {
+        return RLWETrapdoorUtility<Element>::GaussSampOnline(m_n, m_k, A, m_T, u, dgg, Pop(), m_base);
+    }
+
+    /**
+   * Stops the workers; Pop() keeps working, sampling on the caller's thread once the pool is empty
+   */
+    void Stop();
+
+    /**
+   * @return a snapshot of the pool counters
+   */
+    PerturbationPoolStats GetStats() const;
+
+private:
+    void Worker();
+
+    const size_t m_n;
+    const size_t m_k;
+    const RLWETrapdoorPair<Element> m_T;
+    const DggType m_dgg;
+    const DggType m_dggLargeSigma;
+    const int64_t m_base;
+    const size_t m_depth;
+    const size_t m_watermark;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_refillCv;
+    std::deque<std::shared_ptr<Matrix<Element>>> m_queue;
+    // perturbations being sampled by the workers, counted against depth
+    size_t m_inFlight = 0;
+    bool m_refilling  = true;
+    bool m_stop       = false;
+    std::exception_ptr m_error;
+    PerturbationPoolStats m_stats;
+    std::vector<std::thread> m_workers;
+};
+
 }  // namespace lbcrypto
 
 #endif
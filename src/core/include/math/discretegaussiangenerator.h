@@ -61,7 +61,12 @@
  * kept, which are precalculated in constructor. The method is not prone to
  * timing attacks but it is usable for single center, single deviation only.
  * It should be also noted that the memory requirement grows with the standard
- * deviation, therefore it is advised to use it with smaller deviations.   */
+ * deviation, therefore it is advised to use it with smaller deviations.
+ * The CDF is kept as an integer cumulative distribution table (CDT) over
+ * 63-bit words. For small deviations (up to DGG_CDT_SCAN_MAX_STD) each sample
+ * scans the whole table, so its running time does not depend on the value
+ * drawn, and GenerateIntVector compares blocks of PRNG words against the
+ * table at once; larger tables are binary-searched.   */
 
 #ifndef LBCRYPTO_MATH_DISCRETEGAUSSIANGENERATOR_H_
 #define LBCRYPTO_MATH_DISCRETEGAUSSIANGENERATOR_H_
@@ -69,6 +74,8 @@
 #define _USE_MATH_DEFINES  // added for Visual Studio support
 
 #include <math.h>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <random>
 #include <vector>
@@ -80,6 +87,13 @@ namespace lbcrypto {
 
 const double KARNEY_THRESHOLD = 300;
 
+// number of samples drawn together by GenerateIntVector for the CDT scan
+const usint DGG_CDT_BLOCK = 64;
+
+// largest deviation for which the whole CDT is scanned for every sample; the
+// table grows linearly with the deviation, so larger ones use a binary search
+const double DGG_CDT_SCAN_MAX_STD = 10;
+
 template <typename VecType>
 class DiscreteGaussianGeneratorImpl;
 
@@ -201,7 +215,34 @@ public:
     static int64_t GenerateIntegerKarney(double mean, double stddev);
 
 private:
-    usint FindInVector(const std::vector<double>& S, double search) const;
+    /**
+   * @brief Maps a uniform 64-bit word to a sample: the low bit is the sign
+   * and the magnitude is the number of CDT entries below the remaining 63
+   * bits. Small tables are scanned completely regardless of the value,
+   * larger ones are binary-searched.
+   * @param word uniform random word
+   * @return the signed sample
+   */
+    int32_t SampleCDT(uint64_t word) const {
+        const int64_t u = static_cast<int64_t>(word >> 1);
+        int32_t val     = 0;
+        if (m_scanCDT) {
+            for (auto c : m_cdt) {
+                val += (c < u);
+            }
+        }
+        else {
+            val = std::lower_bound(m_cdt.begin(), m_cdt.end(), u) - m_cdt.begin();
+        }
+        const int32_t negative = static_cast<int32_t>(word & 1);
+        return (val ^ -negative) + negative;
+    }
+
+    static uint64_t DrawWord(PRNG& g) {
+        const uint64_t hi = g();
+        const uint64_t lo = g();
+        return (hi << 32) | lo;
+    }
 
     static double UnnormalizedGaussianPDF(const double& mean, const double& sigma, int32_t x) {
         return pow(M_E, -pow(x - mean, 2) / (2. * sigma * sigma));
@@ -265,6 +306,13 @@ private:
 
     std::vector<double> m_vals;
 
+    // m_cdt[k] = floor(2^64 * (m_a / 2 + m_vals[k - 1])) with m_cdt[0] = floor(2^64 * m_a / 2),
+    // i.e., Pr[|x| <= k] / 2 scaled to 64 bits; the last entry saturates at INT64_MAX
+    std::vector<int64_t> m_cdt;
+
+    // whether SampleCDT scans the whole table (see DGG_CDT_SCAN_MAX_STD)
+    bool m_scanCDT = true;
+
     /**
    * The standard deviation of the distribution.
    */
@@ -36,9 +36,14 @@
 #ifndef LBCRYPTO_MATH_HAL_INTNAT_MUBINTVECNAT_H
 #define LBCRYPTO_MATH_HAL_INTNAT_MUBINTVECNAT_H
 
+#include <cstdint>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <new>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "math/hal/intnat/ubintnat.h"
@@ -112,6 +117,77 @@ template <class T, class U>
 bool operator!=(const NAlloc<T>&, const NAlloc<U>&) { return false; }
 #endif
 
+/**
+ * @brief Allocator for the storage of NativeVectorT. By default it allocates from the heap. An
+ * allocator made for an external buffer hands that buffer out for allocations that fit in it,
+ * leaves the values found there as they are and keeps the buffer alive through its owner. Copies
+ * of a vector always get heap storage.
+ */
+template <typename T>
+class NativeVectorAllocator {
+public:
+    using value_type                             = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    NativeVectorAllocator() noexcept = default;
+
+    NativeVectorAllocator(T* buffer, size_t size, std::shared_ptr<void> owner) noexcept
+        : m_buffer(buffer), m_size(size), m_owner(std::move(owner)) {}
+
+    // rebound allocators only allocate from the heap
+    template <typename U>
+    NativeVectorAllocator(const NativeVectorAllocator<U>&) noexcept {}  // NOLINT
+
+    T* allocate(size_t n) {
+        if (m_buffer != nullptr && n <= m_size)
+            return m_buffer;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (p != m_buffer)
+            std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    void construct(U* p) {
+        if (m_buffer == nullptr || !InBuffer(p))
+            ::new (static_cast<void*>(p)) U();
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    NativeVectorAllocator select_on_container_copy_construction() const {
+        return NativeVectorAllocator();
+    }
+
+    bool operator==(const NativeVectorAllocator& other) const noexcept {
+        return m_buffer == other.m_buffer;
+    }
+
+    bool operator!=(const NativeVectorAllocator& other) const noexcept {
+        return m_buffer != other.m_buffer;
+    }
+
+private:
+    template <typename U>
+    bool InBuffer(const U* p) const {
+        auto addr  = reinterpret_cast<uintptr_t>(p);
+        auto begin = reinterpret_cast<uintptr_t>(m_buffer);
+        return addr >= begin && addr < begin + m_size * sizeof(T);
+    }
+
+    T* m_buffer   = nullptr;
+    size_t m_size = 0;
+    std::shared_ptr<void> m_owner;
+};
+
 template <class IntegerType>
 class NativeVectorT : public lbcrypto::BigVectorInterface<NativeVectorT<IntegerType>, IntegerType>,
                       public lbcrypto::Serializable {
@@ -162,6 +238,20 @@ public:
    */
     NativeVectorT(NativeVectorT&& bigVector);  // move copy constructor
 
+    /**
+   * Constructor for a vector that uses length values stored at data in place
+   * instead of copying them, e.g. limbs in a mapped file shared by several
+   * processes. owner keeps the memory alive for as long as the vector uses it.
+   * The memory has to stay writable, as the vector may be modified in place;
+   * copies of the vector get their own storage.
+   *
+   * @param data points to the values.
+   * @param length is the number of values.
+   * @param modulus is the modulus of the ring.
+   * @param owner keeps data alive.
+   */
+    NativeVectorT(IntegerType* data, usint length, const IntegerType& modulus, std::shared_ptr<void> owner);
+
     /**
    * Basic constructor for specifying the length of the vector
    * the modulus and an initializer list.
@@ -645,7 +735,7 @@ private:
     // m_data is a pointer to the vector
 
 #if BLOCK_VECTOR_ALLOCATION != 1
-    std::vector<IntegerType> m_data;
+    std::vector<IntegerType, NativeVectorAllocator<IntegerType>> m_data;
 #else
     xvector<IntegerType> m_data;
 #endif
@@ -36,6 +36,7 @@
 #ifndef LBCRYPTO_MATH_MATRIX_H
 #define LBCRYPTO_MATH_MATRIX_H
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <iostream>
@@ -71,11 +72,9 @@ public:
    * @param &rows number of columns.
    */
     Matrix(alloc_func allocZero, size_t rows, size_t cols) : data(), rows(rows), cols(cols), allocZero(allocZero) {
-        data.resize(rows);
-        for (auto row = data.begin(); row != data.end(); ++row) {
-            for (size_t col = 0; col < cols; ++col) {
-                row->push_back(allocZero());
-            }
+        data.reserve(rows * cols);
+        for (size_t i = 0; i < rows * cols; ++i) {
+            data.push_back(allocZero());
         }
     }
 
@@ -119,11 +118,9 @@ public:
         this->rows = rows;
         this->cols = cols;
 
-        data.resize(rows);
-        for (auto row = data.begin(); row != data.end(); ++row) {
-            for (size_t col = 0; col < cols; ++col) {
-                row->push_back(allocZero());
-            }
+        data.reserve(rows * cols);
+        for (size_t i = 0; i < rows * cols; ++i) {
+            data.push_back(allocZero());
         }
     }
 
@@ -142,9 +139,8 @@ public:
    *
    * @param &other the matrix object to be copied
    */
-    Matrix(const Matrix<Element>& other) : data(), rows(other.rows), cols(other.cols), allocZero(other.allocZero) {
-        deepCopyData(other.data);
-    }
+    Matrix(const Matrix<Element>& other)
+        : data(other.data), rows(other.rows), cols(other.cols), allocZero(other.allocZero) {}
 
     /**
    * Assignment operator
@@ -160,10 +156,8 @@ public:
    * @return the resulting matrix
    */
     Matrix<Element>& Ones() {
-        for (size_t row = 0; row < rows; ++row) {
-            for (size_t col = 0; col < cols; ++col) {
-                data[row][col] = 1;
-            }
+        for (auto& elem : data) {
+            elem = 1;
         }
         return *this;
     }
@@ -200,10 +194,10 @@ public:
         for (size_t row = 0; row < rows; ++row) {
             for (size_t col = 0; col < cols; ++col) {
                 if (row == col) {
-                    data[row][col] = 1;
+                    (*this)(row, col) = 1;
                 }
                 else {
-                    data[row][col] = 0;
+                    (*this)(row, col) = 0;
                 }
             }
         }
@@ -289,12 +283,10 @@ public:
     double Norm() const {
         double retVal = 0.0;
         double locVal = 0.0;
-        for (size_t row = 0; row < rows; ++row) {
-            for (size_t col = 0; col < cols; ++col) {
-                locVal = data[row][col].Norm();
-                if (locVal > retVal) {
-                    retVal = locVal;
-                }
+        for (auto& elem : data) {
+            locVal = elem.Norm();
+            if (locVal > retVal) {
+                retVal = locVal;
             }
         }
         return retVal;
@@ -327,10 +319,8 @@ public:
     Matrix<Element> ScalarMult(Element const& other) const {
         Matrix<Element> result(*this);
 #pragma omp parallel for
-        for (size_t col = 0; col < result.cols; ++col) {
-            for (size_t row = 0; row < result.rows; ++row) {
-                result.data[row][col] = result.data[row][col] * other;
-            }
+        for (size_t i = 0; i < result.data.size(); ++i) {
+            result.data[i] = result.data[i] * other;
         }
 
         return result;
@@ -357,11 +347,9 @@ public:
             return false;
         }
 
-        for (size_t i = 0; i < rows; ++i) {
-            for (size_t j = 0; j < cols; ++j) {
-                if (data[i][j] != other.data[i][j]) {
-                    return false;
-                }
+        for (size_t i = 0; i < data.size(); ++i) {
+            if (data[i] != other.data[i]) {
+                return false;
             }
         }
         return true;
@@ -388,12 +376,28 @@ public:
     }
 
     /**
-   * Get property to access the data as a vector of vectors
+   * Get a copy of the data as a vector of row vectors; the matrix itself is
+   * stored contiguously in row-major order, so use GetRow or operator() to
+   * read entries without copying
    *
    * @return the data as vector of vectors
    */
-    const data_t& GetData() const {
-        return data;
+    data_t GetData() const {
+        data_t result(rows);
+        for (size_t row = 0; row < rows; ++row) {
+            result[row].assign(data.begin() + row * cols, data.begin() + (row + 1) * cols);
+        }
+        return result;
+    }
+
+    /**
+   * Get a pointer to the contiguous entries of a row without copying
+   *
+   * @param row the row index
+   * @return pointer to the first of the GetCols() entries of the row
+   */
+    const Element* GetRow(size_t row) const {
+        return data.data() + row * cols;
     }
 
     /**
@@ -444,10 +448,8 @@ public:
         }
         Matrix<Element> result(*this);
 #pragma omp parallel for
-        for (size_t j = 0; j < cols; ++j) {
-            for (size_t i = 0; i < rows; ++i) {
-                result.data[i][j] += other.data[i][j];
-            }
+        for (size_t i = 0; i < data.size(); ++i) {
+            result.data[i] += other.data[i];
         }
         return result;
     }
@@ -482,10 +484,8 @@ public:
         }
         Matrix<Element> result(allocZero, rows, other.cols);
 #pragma omp parallel for
-        for (size_t j = 0; j < cols; ++j) {
-            for (size_t i = 0; i < rows; ++i) {
-                result.data[i][j] = data[i][j] - other.data[i][j];
-            }
+        for (size_t i = 0; i < data.size(); ++i) {
+            result.data[i] = data[i] - other.data[i];
         }
 
         return result;
@@ -518,14 +518,27 @@ public:
 
     // YSP The signature of this method needs to be changed in the future
     /**
-   * Matrix determinant - found using Laplace formula with complexity O(d!),
-   * where d is the dimension
+   * Matrix determinant - found using LU decomposition (double, Field2n) or
+   * fraction-free Bareiss elimination (int, int64_t) with complexity O(d^3),
+   * where d is the dimension; other element types, and Field2n matrices with a
+   * pivot that is not a unit, fall back to the Laplace formula with complexity
+   * O(d!)
    *
    * @param *result where the result is stored
    */
     void Determinant(Element* result) const;
     // Element Determinant() const;
 
+    /**
+   * Matrix inverse - found using Gauss-Jordan elimination with complexity
+   * O(d^3); supported for double (with partial pivoting) and Field2n, where
+   * the leading principal minors must be invertible (e.g., positive-definite
+   * matrices); throws math_error for singular matrices
+   *
+   * @return the inverse of the given matrix
+   */
+    Matrix<Element> Inverse() const;
+
     /**
    * Cofactor matrix - the matrix of determinants of the minors A_{ij}
    * multiplied by -1^{i+j}
@@ -558,7 +571,7 @@ public:
    * @return the element at the index
    */
     Element& operator()(size_t row, size_t col) {
-        return data[row][col];
+        return data[row * cols + col];
     }
 
     /**
@@ -569,7 +582,7 @@ public:
    * @return the element at the index
    */
     Element const& operator()(size_t row, size_t col) const {
-        return data[row][col];
+        return data[row * cols + col];
     }
 
     /**
@@ -580,10 +593,8 @@ public:
    */
     Matrix<Element> ExtractRow(size_t row) const {
         Matrix<Element> result(this->allocZero, 1, this->cols);
-        int i = 0;
-        for (auto& elem : this->GetData()[row]) {
-            result(0, i) = elem;
-            i++;
+        for (size_t i = 0; i < this->cols; i++) {
+            result(0, i) = (*this)(row, i);
         }
         return result;
         // return *this;
@@ -598,7 +609,7 @@ public:
     Matrix<Element> ExtractCol(size_t col) const {
         Matrix<Element> result(this->allocZero, this->rows, 1);
         for (size_t i = 0; i < this->rows; i++) {
-            result(i, 0) = data[i][col];
+            result(i, 0) = (*this)(i, col);
         }
         return result;
         // return *this;
@@ -614,11 +625,8 @@ public:
         Matrix<Element> result(this->allocZero, row_end - row_start + 1, this->cols);
 
         for (usint row = row_start; row < row_end + 1; row++) {
-            int i = 0;
-
-            for (auto elem = this->GetData()[row].begin(); elem != this->GetData()[row].end(); ++elem) {
-                result(row - row_start, i) = *elem;
-                i++;
+            for (size_t i = 0; i < this->cols; i++) {
+                result(row - row_start, i) = (*this)(row, i);
             }
         }
 
@@ -665,7 +673,8 @@ public:
 
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
-        ar(::cereal::make_nvp("d", data));
+        // the serialized layout stays a vector of rows
+        ar(::cereal::make_nvp("d", GetData()));
         ar(::cereal::make_nvp("r", rows));
         ar(::cereal::make_nvp("c", cols));
     }
@@ -676,10 +685,19 @@ public:
             OPENFHE_THROW(deserialize_error, "serialized object version " + std::to_string(version) +
                                                  " is from a later version of the library");
         }
-        ar(::cereal::make_nvp("d", data));
+        data_t rowData;
+        ar(::cereal::make_nvp("d", rowData));
         ar(::cereal::make_nvp("r", rows));
         ar(::cereal::make_nvp("c", cols));
 
+        data.clear();
+        data.reserve(rows * cols);
+        for (auto& row : rowData) {
+            for (auto& elem : row) {
+                data.push_back(std::move(elem));
+            }
+        }
+
         // users will need to SetAllocator for any newly deserialized matrix
     }
 
@@ -691,22 +709,21 @@ public:
     }
 
 private:
-    data_t data;
+    // row-major contiguous storage: element (row, col) is data[row * cols + col]
+    data_row_t data;
     uint32_t rows;
     uint32_t cols;
     alloc_func allocZero;
     // mutable int NUM_THREADS = 1;
 
-    // deep copy of data - used for copy constructor
-    void deepCopyData(data_t const& src) {
-        data.clear();
-        data.resize(src.size());
-        for (size_t row = 0; row < src.size(); ++row) {
-            for (auto elem = src[row].begin(); elem != src[row].end(); ++elem) {
-                data[row].push_back(*elem);
-            }
+    void SwapRows(size_t a, size_t b) {
+        if (a != b) {
+            std::swap_ranges(data.begin() + a * cols, data.begin() + (a + 1) * cols, data.begin() + b * cols);
         }
     }
+
+    bool DeterminantLU(Element* determinant) const;
+    void DeterminantBareiss(Element* determinant) const;
 };
 
 /**
@@ -495,6 +495,16 @@ uint32_t FindAutomorphismIndexCyclic(int32_t i, uint32_t m, uint32_t g);
  */
 void PrecomputeAutoMap(uint32_t n, uint32_t k, std::vector<uint32_t>* precomp);
 
+/**
+ * Returns the bit reversal map for a specific automorphism (see PrecomputeAutoMap).
+ * The maps are computed once per (n, k mod 2n) and cached for all threads; the
+ * returned reference stays valid for the lifetime of the program.
+ * @param n ring dimension
+ * @param k automorphism index
+ * @return the precomputed table
+ */
+const std::vector<uint32_t>& GetAutoMap(uint32_t n, uint32_t k);
+
 }  // namespace lbcrypto
 
 #endif
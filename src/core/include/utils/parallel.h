@@ -39,11 +39,27 @@
 #ifdef PARALLEL
     #include <omp.h>
 #endif
+#include <vector>
 // #include <iostream>
 namespace lbcrypto {
 
+/**
+ * @brief Placement of the OpenMP threads on the CPUs of the NUMA nodes
+ * THREAD_PLACEMENT_NONE lets threads run on any usable CPU (default)
+ * THREAD_PLACEMENT_COMPACT pins thread i to the i-th usable CPU, filling a
+ * node before moving to the next one
+ * THREAD_PLACEMENT_SCATTER pins consecutive threads to different nodes
+ */
+enum ThreadPlacement {
+    THREAD_PLACEMENT_NONE = 0,
+    THREAD_PLACEMENT_COMPACT,
+    THREAD_PLACEMENT_SCATTER,
+};
+
 class ParallelControls {
     int machineThreads;
+    ThreadPlacement threadPlacement = THREAD_PLACEMENT_NONE;
+    bool firstTouchAllocation       = false;
 
 public:
     // @Brief CTOR, enables parallel operations as default
@@ -57,6 +73,9 @@ public:
 #else
         machineThreads = 1;
 #endif
+        // discover the NUMA nodes while the CPU affinity of the process is
+        // still the one it was started with
+        GetNumaNodes();
     }
     // @Brief Enable() enables parallel operation
     void Enable() {
@@ -121,6 +140,44 @@ public:
         omp_set_num_threads(nthreads);
 #endif
     }
+
+    // @Brief returns the number of NUMA nodes that have CPUs usable by the
+    // process (read from sysfs on Linux, 1 elsewhere)
+    static int GetNumaNodes();
+
+    // @Brief returns the usable CPUs of a NUMA node
+    static const std::vector<int>& GetNumaNodeCpus(int node);
+
+    // @Brief returns the NUMA node of the CPU the calling thread runs on
+    static int GetCurrentNumaNode();
+
+    // @Brief pins the calling thread to the CPUs of a NUMA node
+    static void PinCurrentThreadToNumaNode(int node);
+
+    // @Brief pins the current team of OpenMP threads according to placement;
+    // call it again after SetNumThreads, as new threads are not pinned
+    void SetThreadPlacement(ThreadPlacement placement);
+
+    ThreadPlacement GetThreadPlacement() const {
+        return threadPlacement;
+    }
+
+    // @Brief EnableFirstTouchAllocation() makes new DCRTPoly objects allocate
+    // their towers in a statically scheduled parallel loop, so that each tower
+    // lands on the NUMA node of the thread that processes it in limb-parallel
+    // loops; use it together with a thread placement
+    void EnableFirstTouchAllocation() {
+        firstTouchAllocation = true;
+    }
+
+    // @Brief DisableFirstTouchAllocation() allocates towers serially (default)
+    void DisableFirstTouchAllocation() {
+        firstTouchAllocation = false;
+    }
+
+    bool IsFirstTouchAllocationEnabled() const {
+        return firstTouchAllocation;
+    }
 };
 
 extern ParallelControls OpenFHEParallelControls;
@@ -187,6 +187,13 @@ int blake2xs(void *out, size_t outlen, const void *in, size_t inlen,
 int blake2xb(void *out, size_t outlen, const void *in, size_t inlen,
              const void *key, size_t keylen);
 
+/* Number of BLAKE2Xb output blocks blake2xb_mb computes per compression */
+#define BLAKE2XB_LANES 4
+
+/* Same output as blake2xb, computing BLAKE2XB_LANES output blocks at a time */
+int blake2xb_mb(void *out, size_t outlen, const void *in, size_t inlen,
+                const void *key, size_t keylen);
+
 /* This is simply an alias for blake2b */
 int blake2(void *out, size_t outlen, const void *in, size_t inlen,
            const void *key, size_t keylen);
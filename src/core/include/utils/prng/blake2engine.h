@@ -135,12 +135,13 @@ class Blake2Engine {
 
  private:
   /**
-   * @brief The main call to blake2xb function
+   * @brief The main call to blake2xb function; the multi-buffer variant
+   * fills BLAKE2XB_LANES 64-byte blocks of the buffer per compression
    */
   void Generate() {
     // m_counter is the input to the hash function
     // m_buffer is the output
-    if (blake2xb(m_buffer.begin(), m_buffer.size() * sizeof(result_type),
+    if (blake2xb_mb(m_buffer.begin(), m_buffer.size() * sizeof(result_type),
                  &m_counter, sizeof(m_counter), m_seed.cbegin(),
                  m_seed.size() * sizeof(result_type)) != 0) {
       OPENFHE_THROW(math_error, "PRNG: blake2xb failed");
@@ -38,10 +38,62 @@
 #ifndef _SRC_LIB_TRAPDOOR_DGSAMPLING_CPP
 #define _SRC_LIB_TRAPDOOR_DGSAMPLING_CPP
 
+#include <algorithm>
+
 #include "lattice/dgsampling.h"
 
 namespace lbcrypto {
 
+// Number of coefficients processed together by one thread in GaussSampGq and
+// GaussSampGqArbBase; the k digits of a block are kept in contiguous scratch
+// buffers and written to z row by row
+static constexpr size_t GQ_BLOCK_SIZE = 64;
+
+// Extracts the k base-2^baseDigits digits of every coefficient of u in [begin, end) into
+// digits[(j - begin) * k + t]; the digits of values below 2^64 are computed with native shifts
+template <typename PolyType>
+static void GetDigitsBlock(const PolyType& u, size_t begin, size_t end, int64_t base, size_t k, bool nativeDigits,
+                           int64_t* digits) {
+    if (nativeDigits) {
+        const uint32_t baseDigits = static_cast<uint32_t>(std::round(log2(base)));
+        const uint64_t mask       = (uint64_t(1) << baseDigits) - 1;
+        for (size_t j = begin; j < end; j++) {
+            uint64_t v = u.at(j).ConvertToInt();
+            int64_t* d = digits + (j - begin) * k;
+            for (size_t t = 0; t < k; t++) {
+                d[t] = static_cast<int64_t>(v & mask);
+                v >>= baseDigits;
+            }
+        }
+    }
+    else {
+        for (size_t j = begin; j < end; j++) {
+            std::vector<int64_t> v_digits = *(GetDigits(u.at(j), base, k));
+            std::copy(v_digits.begin(), v_digits.end(), digits + (j - begin) * k);
+        }
+    }
+}
+
+// Writes z(t, j) for the coefficients of one block, row by row
+static void WriteGqBlock(size_t begin, size_t end, size_t k, int64_t base, const std::vector<int64_t>& m_digits,
+                         const int64_t* zj, const int64_t* v_digits, Matrix<int64_t>* z) {
+    for (size_t j = begin; j < end; j++) {
+        const int64_t* zb = zj + (j - begin) * k;
+        const int64_t* vb = v_digits + (j - begin) * k;
+        (*z)(0, j)        = base * zb[0] + m_digits[0] * zb[k - 1] + vb[0];
+    }
+    for (size_t t = 1; t < k - 1; t++) {
+        for (size_t j = begin; j < end; j++) {
+            const int64_t* zb = zj + (j - begin) * k;
+            (*z)(t, j)        = base * zb[t] - zb[t - 1] + m_digits[t] * zb[k - 1] + v_digits[(j - begin) * k + t];
+        }
+    }
+    for (size_t j = begin; j < end; j++) {
+        const int64_t* zb = zj + (j - begin) * k;
+        (*z)(k - 1, j)    = m_digits[k - 1] * zb[k - 1] - zb[k - 2] + v_digits[(j - begin) * k + k - 1];
+    }
+}
+
 // Gaussian sampling from lattice for gagdet matrix G, syndrome u, and arbitrary
 // modulus q Discrete sampling variant As described in Figure 2 of
 // https://eprint.iacr.org/2017/308.pdf
@@ -64,8 +116,7 @@ void LatticeGaussSampUtility<Element>::GaussSampGq(const Element& syndrome, doub
     // upper diagonal of matrix L
     std::vector<double> h(k);
 
-    // Matrix<double> a([]() { return 0.0; }, k, 1);
-    Matrix<double> c([]() { return 0.0; }, k, 1);
+    std::vector<double> c(k);
 
     //  set the values of matrix L
     // (double) is added to avoid integer division
@@ -80,41 +131,42 @@ void LatticeGaussSampUtility<Element>::GaussSampGq(const Element& syndrome, doub
 
     // c can be pre-computed as it only depends on the modulus
     // (double) is added to avoid integer division
-    c(0, 0) = m_digits[0] / static_cast<double>(base);
+    c[0] = m_digits[0] / static_cast<double>(base);
 
     for (size_t i = 1; i < k; i++)
-        c(i, 0) = (c(i - 1, 0) + m_digits[i]) / base;
+        c[i] = (c[i - 1] + m_digits[i]) / base;
+
+    const size_t n          = u.GetLength();
+    const size_t numBlocks  = (n + GQ_BLOCK_SIZE - 1) / GQ_BLOCK_SIZE;
+    const bool nativeDigits = modulus.GetMSB() <= 64;
 
-#pragma omp parallel for
-    for (size_t j = 0; j < u.GetLength(); j++) {
-        typename Element::Integer v(u.at(j));
+    // every thread draws from its own PRNG (see PseudoRandomNumberGenerator::GetPRNG)
+#pragma omp parallel for schedule(static)
+    for (size_t blk = 0; blk < numBlocks; blk++) {
+        const size_t begin = blk * GQ_BLOCK_SIZE;
+        const size_t end   = std::min(n, begin + GQ_BLOCK_SIZE);
 
+        std::vector<int64_t> v_digits(GQ_BLOCK_SIZE * k);
+        std::vector<int64_t> zj(GQ_BLOCK_SIZE * k);
         std::vector<int64_t> p(k);
+        std::vector<double> a(k);
 
-        LatticeGaussSampUtility<Element>::Perturb(sigma, k, u.GetLength(), l, h, base, dgg, &p);
+        GetDigitsBlock(u, begin, end, base, k, nativeDigits, v_digits.data());
 
-        Matrix<double> a([]() { return 0.0; }, k, 1);
+        for (size_t j = begin; j < end; j++) {
+            const int64_t* vb = v_digits.data() + (j - begin) * k;
 
-        std::vector<int64_t> v_digits = *(GetDigits(v, base, k));
+            LatticeGaussSampUtility<Element>::Perturb(sigma, k, n, l, h, base, dgg, p.data());
 
-        // int64_t cast is needed here as GetDigitAtIndexForBase returns an unsigned
-        // int when the result is negative, a(0,0) gets values close to 2^64 if the
-        // cast is not used (double) is added to avoid integer division
-        a(0, 0) = ((int64_t)(v_digits[0]) - p[0]) / static_cast<double>(base);
+            // (double) is added to avoid integer division
+            a[0] = (vb[0] - p[0]) / static_cast<double>(base);
+            for (size_t t = 1; t < k; t++)
+                a[t] = (a[t - 1] + vb[t] - p[t]) / base;
 
-        for (size_t t = 1; t < k; t++) {
-            a(t, 0) = (a(t - 1, 0) + (int64_t)(v_digits[t]) - p[t]) / base;
+            LatticeGaussSampUtility<Element>::SampleC(c, k, n, sigma, dgg, a.data(), zj.data() + (j - begin) * k);
         }
-        std::vector<int64_t> zj(k);
-
-        LatticeGaussSampUtility<Element>::SampleC(c, k, u.GetLength(), sigma, dgg, &a, &zj);
 
-        (*z)(0, j) = base * zj[0] + (int64_t)(m_digits[0]) * zj[k - 1] + (int64_t)(v_digits[0]);
-
-        for (size_t t = 1; t < k - 1; t++) {
-            (*z)(t, j) = base * zj[t] - zj[t - 1] + (int64_t)(m_digits[t]) * zj[k - 1] + (int64_t)(v_digits[t]);
-        }
-        (*z)(k - 1, j) = (int64_t)(m_digits[k - 1]) * zj[k - 1] - zj[k - 2] + (int64_t)(v_digits[k - 1]);
+        WriteGqBlock(begin, end, k, base, m_digits, zj.data(), v_digits.data(), z);
     }
 }
 
@@ -140,8 +192,7 @@ void LatticeGaussSampUtility<Element>::GaussSampGqArbBase(const Element& syndrom
     // upper diagonal of matrix L
     std::vector<double> h(k);
 
-    // Matrix<double> a([]() { return 0.0; }, k, 1);
-    Matrix<double> c([]() { return 0.0; }, k, 1);
+    std::vector<double> c(k);
 
     //  set the values of matrix L
     // (double) is added to avoid integer division
@@ -156,41 +207,42 @@ void LatticeGaussSampUtility<Element>::GaussSampGqArbBase(const Element& syndrom
 
     // c can be pre-computed as it only depends on the modulus
     // (double) is added to avoid integer division
-    c(0, 0) = ((int64_t)m_digits[0]) / static_cast<double>(base);
+    c[0] = m_digits[0] / static_cast<double>(base);
 
     for (size_t i = 1; i < k; i++)
-        c(i, 0) = (c(i - 1, 0) + (int64_t)m_digits[i]) / static_cast<double>(base);
+        c[i] = (c[i - 1] + m_digits[i]) / static_cast<double>(base);
 
-#pragma omp parallel for
-    for (size_t j = 0; j < u.GetLength(); j++) {
-        typename Element::Integer v(u.at(j));
+    const size_t n          = u.GetLength();
+    const size_t numBlocks  = (n + GQ_BLOCK_SIZE - 1) / GQ_BLOCK_SIZE;
+    const bool nativeDigits = modulus.GetMSB() <= 64;
 
-        std::vector<int64_t> v_digits = *(GetDigits(v, base, k));
+    // every thread draws from its own PRNG (see PseudoRandomNumberGenerator::GetPRNG)
+#pragma omp parallel for schedule(static)
+    for (size_t blk = 0; blk < numBlocks; blk++) {
+        const size_t begin = blk * GQ_BLOCK_SIZE;
+        const size_t end   = std::min(n, begin + GQ_BLOCK_SIZE);
 
+        std::vector<int64_t> v_digits(GQ_BLOCK_SIZE * k);
+        std::vector<int64_t> zj(GQ_BLOCK_SIZE * k);
         std::vector<double> p(k);
+        std::vector<double> a(k);
 
-        LatticeGaussSampUtility<Element>::PerturbFloat(sigma, k, u.GetLength(), l, h, base, dgg, &p);
-
-        Matrix<double> a([]() { return 0.0; }, k, 1);
+        GetDigitsBlock(u, begin, end, base, k, nativeDigits, v_digits.data());
 
-        // int64_t cast is needed here as GetDigitAtIndexForBase returns an unsigned
-        // int when the result is negative, a(0,0) gets values close to 2^64 if the
-        // cast is not used (double) is added to avoid integer division
-        a(0, 0) = ((int64_t)(v_digits[0]) - p[0]) / static_cast<double>(base);
+        for (size_t j = begin; j < end; j++) {
+            const int64_t* vb = v_digits.data() + (j - begin) * k;
 
-        for (size_t t = 1; t < k; t++) {
-            a(t, 0) = (a(t - 1, 0) + (int64_t)(v_digits[t]) - p[t]) / static_cast<double>(base);
-        }
-        std::vector<int64_t> zj(k);
-
-        LatticeGaussSampUtility<Element>::SampleC(c, k, u.GetLength(), sigma, dgg, &a, &zj);
+            LatticeGaussSampUtility<Element>::PerturbFloat(sigma, k, n, l, h, base, dgg, p.data());
 
-        (*z)(0, j) = base * zj[0] + (int64_t)(m_digits[0]) * zj[k - 1] + (int64_t)(v_digits[0]);
+            // (double) is added to avoid integer division
+            a[0] = (vb[0] - p[0]) / static_cast<double>(base);
+            for (size_t t = 1; t < k; t++)
+                a[t] = (a[t - 1] + vb[t] - p[t]) / static_cast<double>(base);
 
-        for (size_t t = 1; t < k - 1; t++) {
-            (*z)(t, j) = base * zj[t] - zj[t - 1] + (int64_t)(m_digits[t]) * zj[k - 1] + (int64_t)(v_digits[t]);
+            LatticeGaussSampUtility<Element>::SampleC(c, k, n, sigma, dgg, a.data(), zj.data() + (j - begin) * k);
         }
-        (*z)(k - 1, j) = (int64_t)(m_digits[k - 1]) * zj[k - 1] - zj[k - 2] + (int64_t)(v_digits[k - 1]);
+
+        WriteGqBlock(begin, end, k, base, m_digits, zj.data(), v_digits.data(), z);
     }
 }
 
@@ -201,7 +253,7 @@ void LatticeGaussSampUtility<Element>::GaussSampGqArbBase(const Element& syndrom
 template <class Element>
 void LatticeGaussSampUtility<Element>::Perturb(double sigma, size_t k, size_t n, const std::vector<double>& l,
                                                const std::vector<double>& h, int64_t base,
-                                               typename Element::DggType& dgg, std::vector<int64_t>* p) {
+                                               typename Element::DggType& dgg, int64_t* p) {
     std::vector<int32_t> z(k);
     double d = 0;
 
@@ -210,10 +262,10 @@ void LatticeGaussSampUtility<Element>::Perturb(double sigma, size_t k, size_t n,
         d    = -z[i] * h[i];
     }
 
-    (*p)[0] = (2 * base + 1) * z[0] + base * z[1];
+    p[0] = (2 * base + 1) * z[0] + base * z[1];
     for (size_t i = 1; i < k - 1; i++)
-        (*p)[i] = base * (z[i - 1] + 2 * z[i] + z[i + 1]);
-    (*p)[k - 1] = base * (z[k - 2] + 2 * z[k - 1]);
+        p[i] = base * (z[i - 1] + 2 * z[i] + z[i + 1]);
+    p[k - 1] = base * (z[k - 2] + 2 * z[k - 1]);
 }
 
 // subroutine used by GaussSampGqArbBase
@@ -223,7 +275,7 @@ void LatticeGaussSampUtility<Element>::Perturb(double sigma, size_t k, size_t n,
 template <class Element>
 void LatticeGaussSampUtility<Element>::PerturbFloat(double sigma, size_t k, size_t n, const std::vector<double>& l,
                                                     const std::vector<double>& h, int64_t base,
-                                                    typename Element::DggType& dgg, std::vector<double>* p) {
+                                                    typename Element::DggType& dgg, double* p) {
     std::normal_distribution<> d(0, sigma);
 
     PRNG& g = PseudoRandomNumberGenerator::GetPRNG();
@@ -236,24 +288,25 @@ void LatticeGaussSampUtility<Element>::PerturbFloat(double sigma, size_t k, size
 
     // Compute matrix-vector product Lz (apply linear transformation)
     for (size_t i = 0; i < k - 1; i++) {
-        p->at(i) = l[i] * z[i] + h[i + 1] * z[i + 1];
+        p[i] = l[i] * z[i] + h[i + 1] * z[i + 1];
     }
 
-    p->at(k - 1) = h[k - 1] * z[k - 1];
+    p[k - 1] = h[k - 1] * z[k - 1];
 }
 
 // subroutine used by GaussSampGq
 // As described in Algorithm 3 of https://eprint.iacr.org/2017/844.pdf
 
 template <class Element>
-void LatticeGaussSampUtility<Element>::SampleC(const Matrix<double>& c, size_t k, size_t n, double sigma,
-                                               typename Element::DggType& dgg, Matrix<double>* a,
-                                               std::vector<int64_t>* z) {
-    (*z)[k - 1] = dgg.GenerateIntegerKarney(-(*a)(k - 1, 0) / c(k - 1, 0), sigma / c(k - 1, 0));
-    *a          = *a + (static_cast<double>((*z)[k - 1])) * c;
+void LatticeGaussSampUtility<Element>::SampleC(const std::vector<double>& c, size_t k, size_t n, double sigma,
+                                               typename Element::DggType& dgg, double* a, int64_t* z) {
+    z[k - 1]        = dgg.GenerateIntegerKarney(-a[k - 1] / c[k - 1], sigma / c[k - 1]);
+    const double zk = static_cast<double>(z[k - 1]);
+    for (size_t i = 0; i < k - 1; i++)
+        a[i] += zk * c[i];
 
     for (size_t i = 0; i < k - 1; i++) {
-        (*z)[i] = dgg.GenerateIntegerKarney(-(*a)(i, 0), sigma);
+        z[i] = dgg.GenerateIntegerKarney(-a[i], sigma);
     }
 }
 
@@ -382,12 +435,7 @@ void LatticeGaussSampUtility<Element>::SampleMat(const Matrix<Field2n>& A, const
         for (size_t i = 0; i < dimD; i++)
             qF1(i, 0) = Field2n(q1->ExtractRows(i * n, i * n + n - 1));
 
-        Field2n det(n, Format::EVALUATION, true);
-        D.Determinant(&det);
-
-        Field2n detInverse = det.Inverse();
-
-        Dinverse = (D.CofactorMatrix()).Transpose() * detInverse;
+        Dinverse = D.Inverse();
     }
 
     Matrix<Field2n> sigma = A - B * Dinverse * (B.Transpose());
@@ -38,6 +38,7 @@
 
 #include "lattice/lat-hal.h"
 #include "utils/debug.h"
+#include "utils/parallel.h"
 #include "utils/utilities-int.h"
 #include "utils/utilities.h"
 
@@ -57,6 +58,17 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(const std::shared_ptr<DCRTPolyImpl::Params>
     this->m_params = dcrtParams;
 
     size_t vecSize = dcrtParams->GetParams().size();
+    if (initializeElementToZero && vecSize > 1 && OpenFHEParallelControls.IsFirstTouchAllocationEnabled()) {
+        // each tower is first touched by the thread that owns it in
+        // statically scheduled limb-parallel loops
+        m_vectors.resize(vecSize);
+#pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < vecSize; i++) {
+            m_vectors[i] = PolyType(dcrtParams->GetParams()[i], format, true);
+        }
+        return;
+    }
+
     m_vectors.reserve(vecSize);
 
     for (usint i = 0; i < vecSize; i++) {
@@ -67,8 +79,17 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(const std::shared_ptr<DCRTPolyImpl::Params>
 template <typename VecType>
 DCRTPolyImpl<VecType>::DCRTPolyImpl(const DCRTPolyImpl& element) {
     this->m_format = element.m_format;
-    m_vectors      = element.m_vectors;
     this->m_params = element.m_params;
+    size_t vecSize = element.m_vectors.size();
+    if (vecSize > 1 && OpenFHEParallelControls.IsFirstTouchAllocationEnabled()) {
+        m_vectors.resize(vecSize);
+#pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < vecSize; i++) {
+            m_vectors[i] = element.m_vectors[i];
+        }
+        return;
+    }
+    m_vectors = element.m_vectors;
 }
 
 template <typename VecType>
@@ -211,46 +232,37 @@ DCRTPolyImpl<VecType>::DCRTPolyImpl(const DggType& dgg, const std::shared_ptr<DC
     this->m_params = dcrtParams;
 
     size_t vecSize = dcrtParams->GetParams().size();
+    usint ringDim  = dcrtParams->GetRingDimension();
     m_vectors.reserve(vecSize);
+    for (usint i = 0; i < vecSize; i++) {
+        m_vectors.push_back(PolyType(dcrtParams->GetParams()[i]));
+    }
 
-    // dgg generating random values
-    std::shared_ptr<int64_t> dggValues = dgg.GenerateIntVector(dcrtParams->GetRingDimension());
+    // dgg generating random values; one draw is reduced into all the towers
+    std::shared_ptr<int64_t> dggValues = dgg.GenerateIntVector(ringDim);
+    const int64_t* values              = dggValues.get();
+    const double dggStddev             = dgg.GetStd();
 
+#pragma omp parallel for
     for (usint i = 0; i < vecSize; i++) {
-        NativeVector ilDggValues(dcrtParams->GetRingDimension(), dcrtParams->GetParams()[i]->GetModulus());
-
-        for (usint j = 0; j < dcrtParams->GetRingDimension(); j++) {
-            NativeInteger::Integer entry;
-            // if the random generated value is less than zero, then multiply it by
-            // (-1) and subtract the modulus of the current tower to set the
-            // coefficient
-            NativeInteger::SignedNativeInt k = (dggValues.get())[j];
-            auto dcrt_qmodulus =
-                (NativeInteger::SignedNativeInt)dcrtParams->GetParams()[i]->GetModulus().ConvertToInt();
-            auto dgg_stddev = dgg.GetStd();
-
-            if (dgg_stddev > dcrt_qmodulus) {
-                // rescale k to dcrt_qmodulus
-                auto mk = k % dcrt_qmodulus;
-                k       = (NativeInteger::Integer)mk;
-            }
+        const NativeInteger& modulus = dcrtParams->GetParams()[i]->GetModulus();
+        auto qmodulus                = (NativeInteger::SignedNativeInt)modulus.ConvertToInt();
+        // rescale the values to the modulus if the distribution is wider than it
+        const bool rescale = dggStddev > qmodulus;
 
-            if (k < 0) {
-                k *= (-1);
-                entry = (NativeInteger::Integer)dcrt_qmodulus - (NativeInteger::Integer)k;
-            }
-            else {  // if greater than or equal to zero, set it the value generated
-                entry = k;
-            }
-            ilDggValues[j] = entry;
+        NativeVector ilDggValues(ringDim, modulus);
+        for (usint j = 0; j < ringDim; j++) {
+            NativeInteger::SignedNativeInt k = values[j];
+            if (rescale)
+                k %= qmodulus;
+            // a negative value k is set to the coefficient modulus - |k|
+            ilDggValues[j] = (NativeInteger::Integer)(k < 0 ? k + qmodulus : k);
         }
 
-        PolyType ilvector(dcrtParams->GetParams()[i]);
         // the random values are set in coefficient format
-        ilvector.SetValues(std::move(ilDggValues), Format::COEFFICIENT);
+        m_vectors[i].SetValues(std::move(ilDggValues), Format::COEFFICIENT);
         // set the format to what the caller asked for.
-        ilvector.SetFormat(this->GetFormat());
-        m_vectors.push_back(std::move(ilvector));
+        m_vectors[i].SetFormat(format);
     }
 }
 
@@ -1234,6 +1246,83 @@ typename DCRTPolyImpl<VecType>::PolyLargeType DCRTPolyImpl<VecType>::CRTInterpol
     return polynomialReconstructed;
 }
 
+template <typename VecType>
+std::vector<double> DCRTPolyImpl<VecType>::CRTInterpolateCentered(const std::vector<usint>& indices) const {
+    const size_t sizeQ = m_vectors.size();
+    std::vector<double> result(indices.size());
+    if (sizeQ == 0)
+        return result;
+
+    const std::vector<PolyType>* vecs = &m_vectors;
+    std::vector<PolyType> coeffVecs;
+    if (this->GetFormat() == Format::EVALUATION) {
+        coeffVecs = m_vectors;
+        for (auto& vec : coeffVecs)
+            vec.SetFormat(Format::COEFFICIENT);
+        vecs = &coeffVecs;
+    }
+
+    std::vector<NativeInteger> q(sizeQ);
+    for (size_t i = 0; i < sizeQ; i++)
+        q[i] = (*vecs)[i].GetModulus();
+
+    // [q_j^{-1}]_{q_i} for j < i
+    std::vector<std::vector<NativeInteger>> qInvModq(sizeQ);
+    std::vector<std::vector<NativeInteger>> qInvModqPrecon(sizeQ);
+    for (size_t i = 1; i < sizeQ; i++) {
+        qInvModq[i].resize(i);
+        qInvModqPrecon[i].resize(i);
+        for (size_t j = 0; j < i; j++) {
+            qInvModq[i][j]       = q[j].Mod(q[i]).ModInverse(q[i]);
+            qInvModqPrecon[i][j] = qInvModq[i][j].PrepModMulConst(q[i]);
+        }
+    }
+
+    // converts residues in place to the digits a_i of x = a_0 + a_1 q_0 + a_2 q_0 q_1 + ...
+    auto toMixedRadix = [&](std::vector<NativeInteger>& x) {
+        for (size_t i = 1; i < sizeQ; i++) {
+            NativeInteger t = x[i];
+            for (size_t j = 0; j < i; j++)
+                t = t.ModSub(x[j], q[i]).ModMulFastConst(qInvModq[i][j], q[i], qInvModqPrecon[i][j]);
+            x[i] = t;
+        }
+    };
+
+    // floor(Q/2) = (Q-1)/2 has residues (q_i-1)/2 as Q is odd
+    std::vector<NativeInteger> halfQ(sizeQ);
+    for (size_t i = 0; i < sizeQ; i++)
+        halfQ[i] = q[i] >> 1;
+    toMixedRadix(halfQ);
+
+#pragma omp parallel for
+    for (size_t k = 0; k < indices.size(); k++) {
+        std::vector<NativeInteger> digits(sizeQ);
+        for (size_t i = 0; i < sizeQ; i++)
+            digits[i] = (*vecs)[i][indices[k]];
+        std::vector<NativeInteger> residues(digits);
+        toMixedRadix(digits);
+
+        // x > Q/2 iff its digits are lexicographically larger, starting from the top
+        size_t i = sizeQ - 1;
+        while (i > 0 && digits[i] == halfQ[i])
+            i--;
+        bool negative = digits[i] > halfQ[i];
+        if (negative) {
+            // the digits of Q - x keep all the terms of the evaluation below positive
+            for (size_t l = 0; l < sizeQ; l++)
+                digits[l] = (residues[l] == 0) ? NativeInteger(0) : q[l] - residues[l];
+            toMixedRadix(digits);
+        }
+
+        long double value = digits[sizeQ - 1].ConvertToInt();
+        for (size_t l = sizeQ - 1; l > 0; l--)
+            value = value * q[l - 1].ConvertToInt() + digits[l - 1].ConvertToInt();
+        result[k] = static_cast<double>(negative ? -value : value);
+    }
+
+    return result;
+}
+
 /*
  * This method applies the Chinese Remainder Interpolation on a
  * single element across all towers of a DCRTPolyImpl and produces an Poly
@@ -2286,6 +2375,96 @@ DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRound(
 }
 #endif
 
+#if defined(HAVE_INT128) && NATIVEINT == 64
+template <typename VecType>
+DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRoundSwitchCRTBasis(
+    const std::shared_ptr<DCRTPolyImpl::Params> paramsP, const std::shared_ptr<DCRTPolyImpl::Params> paramsQ,
+    const std::vector<std::vector<NativeInteger>>& tPSHatInvModsDivsModp,
+    const std::vector<double>& tPSHatInvModsDivsFrac, const std::vector<DoubleNativeInt>& modpBarrettMu,
+    const std::vector<NativeInteger>& PHatInvModp, const std::vector<NativeInteger>& PHatInvModpPrecon,
+    const std::vector<std::vector<NativeInteger>>& PHatModq, const std::vector<std::vector<NativeInteger>>& alphaPModq,
+    const std::vector<DoubleNativeInt>& modqBarrettMu, const std::vector<double>& pInv) const {
+    DCRTPolyType ans(paramsQ, this->GetFormat(), true);
+
+    usint ringDim = this->GetRingDimension();
+    size_t sizeQP = m_vectors.size();
+    size_t sizeP  = paramsP->GetParams().size();
+    size_t sizeI  = sizeQP - sizeP;
+    size_t sizeQ  = ans.m_vectors.size();
+
+    #pragma omp parallel
+    {
+        // residues (mod p_j) of the scaled coefficient, already multiplied by [(P/p_j)^{-1}]_{p_j}
+        std::vector<NativeInteger> yPHatInvModp(sizeP);
+
+    #pragma omp for
+        for (usint ri = 0; ri < ringDim; ri++) {
+            // scale and round: {x}_{Q,P} -> {t/Q * x}_{P}
+            double nu = 0.5;
+            for (usint i = 0; i < sizeI; i++) {
+                nu += tPSHatInvModsDivsFrac[i] * m_vectors[i][ri].ConvertToInt();
+            }
+
+            NativeInteger alpha = static_cast<uint64_t>(nu);
+
+            double nuP = 0.5;
+            for (usint j = 0; j < sizeP; j++) {
+                DoubleNativeInt curValue = 0;
+
+                const NativeInteger& pj                                  = paramsP->GetParams()[j]->GetModulus();
+                const std::vector<NativeInteger>& tPSHatInvModsDivsModpj = tPSHatInvModsDivsModp[j];
+
+                for (usint i = 0; i < sizeI; i++) {
+                    curValue += Mul128(m_vectors[i][ri].ConvertToInt(), tPSHatInvModsDivsModpj[i].ConvertToInt());
+                }
+                curValue += Mul128(m_vectors[sizeI + j][ri].ConvertToInt(), tPSHatInvModsDivsModpj[sizeI].ConvertToInt());
+
+                NativeInteger yj = NativeInteger(BarrettUint128ModUint64(curValue, pj.ConvertToInt(), modpBarrettMu[j]))
+                                       .ModAddFast(alpha, pj);
+
+                // switch CRT basis, first round: [y_j (P/p_j)^{-1}]_{p_j}
+                yPHatInvModp[j] = yj.ModMulFastConst(PHatInvModp[j], pj, PHatInvModpPrecon[j]);
+                nuP += static_cast<double>(yPHatInvModp[j].ConvertToInt()) * pInv[j];
+            }
+
+            // alphaP corresponds to the number of p-overflows, 0 <= alphaP <= sizeP
+            const std::vector<NativeInteger>& alphaPModqri = alphaPModq[static_cast<usint>(nuP)];
+
+            // switch CRT basis, second round: {y}_{P} -> {y}_{Q}
+            for (usint i = 0; i < sizeQ; i++) {
+                DoubleNativeInt curValue = 0;
+
+                const NativeInteger& qi                     = ans.m_vectors[i].GetModulus();
+                const std::vector<NativeInteger>& PHatModqi = PHatModq[i];
+                for (usint j = 0; j < sizeP; j++) {
+                    curValue += Mul128(yPHatInvModp[j].ConvertToInt(), PHatModqi[j].ConvertToInt());
+                }
+
+                const NativeInteger& curNativeValue =
+                    NativeInteger(BarrettUint128ModUint64(curValue, qi.ConvertToInt(), modqBarrettMu[i]));
+
+                ans.m_vectors[i][ri] = curNativeValue.ModSubFast(alphaPModqri[i], qi);
+            }
+        }
+    }
+
+    return ans;
+}
+#else
+template <typename VecType>
+DCRTPolyImpl<VecType> DCRTPolyImpl<VecType>::ScaleAndRoundSwitchCRTBasis(
+    const std::shared_ptr<DCRTPolyImpl::Params> paramsP, const std::shared_ptr<DCRTPolyImpl::Params> paramsQ,
+    const std::vector<std::vector<NativeInteger>>& tPSHatInvModsDivsModp,
+    const std::vector<double>& tPSHatInvModsDivsFrac, const std::vector<DoubleNativeInt>& modpBarrettMu,
+    const std::vector<NativeInteger>& PHatInvModp, const std::vector<NativeInteger>& PHatInvModpPrecon,
+    const std::vector<std::vector<NativeInteger>>& PHatModq, const std::vector<std::vector<NativeInteger>>& alphaPModq,
+    const std::vector<DoubleNativeInt>& modqBarrettMu, const std::vector<double>& pInv) const {
+    // without 128-bit accumulation there is nothing to gain from fusing the two passes
+    return ScaleAndRound(paramsP, tPSHatInvModsDivsModp, tPSHatInvModsDivsFrac, modpBarrettMu)
+        .SwitchCRTBasis(paramsQ, PHatInvModp, PHatInvModpPrecon, PHatModq, alphaPModq, modqBarrettMu, pInv);
+}
+#endif
+
 template <typename VecType>
 PolyImpl<NativeVector> DCRTPolyImpl<VecType>::ScaleAndRound(
     const std::vector<NativeInteger>& moduliQ, const NativeInteger& t, const NativeInteger& tgamma,
@@ -112,7 +112,7 @@ template <typename Element>
 void Matrix<Element>::SetFormat(Format format) {
     for (size_t row = 0; row < rows; ++row) {
         for (size_t col = 0; col < cols; ++col) {
-            data[row][col].SetFormat(format);
+            (*this)(row, col).SetFormat(format);
         }
     }
 }
@@ -123,7 +123,7 @@ void Matrix<Element>::SwitchFormat() {
         for (size_t row = 0; row < rows; ++row) {
 #pragma omp parallel for
             for (size_t col = 0; col < cols; ++col) {
-                data[row][col].SwitchFormat();
+                (*this)(row, col).SwitchFormat();
             }
         }
     }
@@ -131,7 +131,7 @@ void Matrix<Element>::SwitchFormat() {
         for (size_t col = 0; col < cols; ++col) {
 #pragma omp parallel for
             for (size_t row = 0; row < rows; ++row) {
-                data[row][col].SwitchFormat();
+                (*this)(row, col).SwitchFormat();
             }
         }
     }
@@ -739,16 +739,18 @@ PolyImpl<VecType> PolyImpl<VecType>::AutomorphismTransform(const usint& k) const
 
 template <typename VecType>
 PolyImpl<VecType> PolyImpl<VecType>::AutomorphismTransform(usint k, const std::vector<usint>& precomp) const {
-    PolyImpl result(*this);
+    PolyImpl result(m_params, m_format);
     if ((this->m_format == Format::EVALUATION) && (m_params->OrderIsPowerOfTwo())) {
         if (k % 2 == 0) {
             OPENFHE_THROW(math_error, "automorphism index should be odd\n");
         }
         usint n = this->m_params->GetRingDimension();
 
+        VecType values(n, m_params->GetModulus());
         for (usint j = 0; j < n; j++) {
-            (*result.m_values)[j] = (*m_values)[precomp[j]];
+            values[j] = (*m_values)[precomp[j]];
         }
+        result.SetValues(std::move(values), m_format);
     }
     else {
         OPENFHE_THROW(
@@ -44,6 +44,7 @@ namespace lbcrypto {
 template class LatticeGaussSampUtility<DCRTPoly>;
 template class RLWETrapdoorPair<DCRTPoly>;
 template class RLWETrapdoorUtility<DCRTPoly>;
+template class PerturbationPool<DCRTPoly>;
 // template class Matrix<DCRTPoly>;
 
 // Trapdoor generation method as described in Algorithm 1 of
@@ -44,11 +44,13 @@ namespace lbcrypto {
 template class LatticeGaussSampUtility<Poly>;
 template class RLWETrapdoorPair<Poly>;
 template class RLWETrapdoorUtility<Poly>;
+template class PerturbationPool<Poly>;
 // template class Matrix<Poly>;
 
 template class LatticeGaussSampUtility<NativePoly>;
 template class RLWETrapdoorPair<NativePoly>;
 template class RLWETrapdoorUtility<NativePoly>;
+template class PerturbationPool<NativePoly>;
 // template class Matrix<NativePoly>;
 
 template class Matrix<Field2n>;
@@ -107,6 +107,124 @@ std::shared_ptr<Matrix<Element>> RLWETrapdoorUtility<Element>::GaussSampOffline(
     return result;
 }
 
+template <class Element>
+PerturbationPool<Element>::PerturbationPool(size_t n, size_t k, const RLWETrapdoorPair<Element>& T,
+                                            const DggType& dgg, const DggType& dggLargeSigma, int64_t base,
+                                            size_t depth, size_t watermark, size_t numWorkers)
+    : m_n(n),
+      m_k(k),
+      m_T(T),
+      m_dgg(dgg),
+      m_dggLargeSigma(dggLargeSigma),
+      m_base(base),
+      m_depth(depth),
+      m_watermark(watermark) {
+    if (depth == 0)
+        OPENFHE_THROW(config_error, "PerturbationPool: depth must be positive");
+    if (watermark > depth)
+        OPENFHE_THROW(config_error, "PerturbationPool: the refill watermark cannot exceed the depth");
+
+    m_workers.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; i++)
+        m_workers.emplace_back(&PerturbationPool<Element>::Worker, this);
+}
+
+template <class Element>
+PerturbationPool<Element>::~PerturbationPool() {
+    Stop();
+}
+
+template <class Element>
+void PerturbationPool<Element>::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_refillCv.notify_all();
+    for (auto& worker : m_workers) {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+template <class Element>
+void PerturbationPool<Element>::Worker() {
+    // each worker samples with its own copies of the generators
+    DggType dgg(m_dgg);
+    DggType dggLargeSigma(m_dggLargeSigma);
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_refillCv.wait(lock, [this] {
+                return m_stop || (m_refilling && m_queue.size() + m_inFlight < m_depth);
+            });
+            if (m_stop)
+                return;
+            m_inFlight++;
+        }
+
+        std::shared_ptr<Matrix<Element>> pHat;
+        std::exception_ptr error;
+        try {
+            pHat = RLWETrapdoorUtility<Element>::GaussSampOffline(m_n, m_k, m_T, dgg, dggLargeSigma, m_base);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inFlight--;
+        if (error) {
+            // reported by the next Pop(); the remaining workers stop as well
+            m_error = error;
+            m_stop  = true;
+            m_refillCv.notify_all();
+            return;
+        }
+        m_queue.push_back(std::move(pHat));
+        m_stats.produced++;
+        if (m_queue.size() + m_inFlight >= m_depth)
+            m_refilling = false;
+    }
+}
+
+template <class Element>
+std::shared_ptr<Matrix<Element>> PerturbationPool<Element>::Pop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_error)
+            std::rethrow_exception(m_error);
+        m_stats.consumed++;
+        if (!m_queue.empty()) {
+            auto pHat = std::move(m_queue.front());
+            m_queue.pop_front();
+            if (!m_refilling && m_queue.size() < m_watermark) {
+                m_refilling = true;
+                m_refillCv.notify_all();
+            }
+            return pHat;
+        }
+        m_stats.misses++;
+        if (!m_refilling) {
+            m_refilling = true;
+            m_refillCv.notify_all();
+        }
+    }
+
+    DggType dgg(m_dgg);
+    DggType dggLargeSigma(m_dggLargeSigma);
+    return RLWETrapdoorUtility<Element>::GaussSampOffline(m_n, m_k, m_T, dgg, dggLargeSigma, m_base);
+}
+
+template <class Element>
+PerturbationPoolStats PerturbationPool<Element>::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PerturbationPoolStats stats = m_stats;
+    stats.size                  = m_queue.size();
+    return stats;
+}
+
 template <>
 inline void RLWETrapdoorUtility<DCRTPoly>::ZSampleSigmaP(size_t n, double s, double sigma,
                                                          const RLWETrapdoorPair<DCRTPoly>& Tprime,
@@ -38,6 +38,9 @@
 #include "math/discretegaussiangenerator.h"
 #include "math/nbtheory.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace lbcrypto {
 
 #define KARNEY_THRESHOLD ((float)300.0)
@@ -103,58 +106,63 @@ void DiscreteGaussianGeneratorImpl<VecType>::Initialize() {
     for (usint i = 1; i < m_vals.size(); i++) {
         m_vals[i] += m_vals[i - 1];
     }
+
+    // integer CDT: a uniform 63-bit word u stands for |seed| * 2^64 with seed
+    // uniform in [-0.5, 0.5), so |x| is the number of entries below u
+    const double scale = std::ldexp(1.0, 64);
+    m_scanCDT = m_std <= DGG_CDT_SCAN_MAX_STD;
+    m_cdt.clear();
+    m_cdt.reserve(m_vals.size() + 1);
+    m_cdt.push_back(static_cast<int64_t>(m_a / 2 * scale));
+    for (usint i = 0; i < m_vals.size(); i++) {
+        double entry = (m_a / 2 + m_vals[i]) * scale;
+        m_cdt.push_back((i + 1 == m_vals.size() || entry >= scale / 2) ? std::numeric_limits<int64_t>::max() :
+                                                                          static_cast<int64_t>(entry));
+    }
 }
 
 template <typename VecType>
 int32_t DiscreteGaussianGeneratorImpl<VecType>::GenerateInt() const {
-    std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
-    usint val = 0;
-    double seed;
-    int32_t ans;
-
-    // we need to use the binary uniform generator rather than regular continuous
-    // distribution; see DG14 for details
-    seed = distribution(PseudoRandomNumberGenerator::GetPRNG()) - 0.5;
-    if (std::abs(seed) <= m_a / 2) {
-        val = 0;
-    }
-    else if (seed > 0) {
-        val = FindInVector(m_vals, (std::abs(seed) - m_a / 2));
+    if (!peikert) {
+        return GenerateIntegerKarney(0, m_std);
     }
-    else {
-        val = -static_cast<int>(FindInVector(m_vals, (std::abs(seed) - m_a / 2)));
-    }
-    ans = val;
-
-    return ans;
+    return SampleCDT(DrawWord(PseudoRandomNumberGenerator::GetPRNG()));
 }
 
 template <typename VecType>
 std::shared_ptr<int64_t> DiscreteGaussianGeneratorImpl<VecType>::GenerateIntVector(usint size) const {
     std::shared_ptr<int64_t> ans(new int64_t[size], std::default_delete<int64_t[]>());
 
-    int64_t val = 0;
-
-    double seed;
-    if (peikert) {
-        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    if (peikert && !m_scanCDT) {
+        PRNG& g      = PseudoRandomNumberGenerator::GetPRNG();
+        int64_t* out = ans.get();
         for (usint i = 0; i < size; i++) {
-            // we need to use the binary uniform generator rather than regular
-            // continuous distribution; see DG14 for details
-            seed = distribution(PseudoRandomNumberGenerator::GetPRNG()) - 0.5;
-            if (std::abs(seed) <= m_a / 2) {
-                val = 0;
+            out[i] = SampleCDT(DrawWord(g));
+        }
+    }
+    else if (peikert) {
+        PRNG& g      = PseudoRandomNumberGenerator::GetPRNG();
+        int64_t* out = ans.get();
+        int64_t u[DGG_CDT_BLOCK];
+        int64_t negative[DGG_CDT_BLOCK];
+        // the same constant-time scan as SampleCDT, but with the table in the
+        // outer loop so that the comparisons run over a whole block of words
+        for (usint start = 0; start < size; start += DGG_CDT_BLOCK) {
+            const usint len = std::min(DGG_CDT_BLOCK, size - start);
+            for (usint j = 0; j < len; j++) {
+                uint64_t word  = DrawWord(g);
+                u[j]           = static_cast<int64_t>(word >> 1);
+                negative[j]    = static_cast<int64_t>(word & 1);
+                out[start + j] = 0;
             }
-            else {
-                if (seed > 0) {
-                    val = FindInVector(m_vals, (std::abs(seed) - m_a / 2));
-                }
-                else {
-                    val = -static_cast<int64_t>(FindInVector(m_vals, (std::abs(seed) - m_a / 2)));
+            for (auto c : m_cdt) {
+                for (usint j = 0; j < len; j++) {
+                    out[start + j] += (c < u[j]);
                 }
             }
-            (ans.get())[i] = val;
+            for (usint j = 0; j < len; j++) {
+                out[start + j] = (out[start + j] ^ -negative[j]) + negative[j];
+            }
         }
     }
     else {
@@ -165,36 +173,11 @@ std::shared_ptr<int64_t> DiscreteGaussianGeneratorImpl<VecType>::GenerateIntVect
     return ans;
 }
 
-template <typename VecType>
-usint DiscreteGaussianGeneratorImpl<VecType>::FindInVector(const std::vector<double>& S, double search) const {
-    // STL binary search implementation
-    auto lower = std::lower_bound(S.begin(), S.end(), search);
-    if (lower != S.end()) {
-        return lower - S.begin() + 1;
-    }
-    OPENFHE_THROW(not_available_error,
-                  "DGG Inversion Sampling. FindInVector value not found: " + std::to_string(search));
-}
-
 template <typename VecType>
 typename VecType::Integer DiscreteGaussianGeneratorImpl<VecType>::GenerateInteger(
     const typename VecType::Integer& modulus) const {
-    int32_t val = 0;
-    double seed;
+    int32_t val = GenerateInt();
     typename VecType::Integer ans;
-    std::uniform_real_distribution<double> distribution(0.0, 1.0);
-
-    seed = distribution(PseudoRandomNumberGenerator::GetPRNG()) - 0.5;
-
-    if (std::abs(seed) <= m_a / 2) {
-        val = 0;
-    }
-    else if (seed > 0) {
-        val = FindInVector(m_vals, (std::abs(seed) - m_a / 2));
-    }
-    else {
-        val = -static_cast<int>(FindInVector(m_vals, (std::abs(seed) - m_a / 2)));
-    }
 
     if (val < 0) {
         val *= -1;
@@ -126,6 +126,29 @@ template <typename VecType>
 VecType DiscreteUniformGeneratorImpl<VecType>::GenerateVector(const usint size) const {
     VecType v(size, m_modulus);
 
+    if constexpr (std::is_same<typename VecType::Integer, NativeInteger>::value) {
+        // Native moduli fit in a 64-bit word: draw words straight from the
+        // PRNG buffer, mask them to the bit width of the modulus and reject
+        // those that are not below it, writing the accepted ones in place
+        const uint64_t q = m_modulus.ConvertToInt();
+        if (q == 0) {
+            OPENFHE_THROW(math_error, "0 modulus?");
+        }
+        const usint bits  = m_modulus.GetMSB();
+        const uint64_t mask = (bits >= 64) ? ~uint64_t(0) : ((uint64_t(1) << bits) - 1);
+        auto& prng          = PseudoRandomNumberGenerator::GetPRNG();
+
+        for (usint i = 0; i < size;) {
+            uint64_t word = prng();
+            if (bits > CHUNK_WIDTH)
+                word |= static_cast<uint64_t>(prng()) << CHUNK_WIDTH;
+            word &= mask;
+            if (word < q)
+                v[i++] = word;
+        }
+        return v;
+    }
+
     for (usint i = 0; i < size; i++) {
         typename VecType::Integer temp(this->GenerateInteger());
         v.at(i) = temp;
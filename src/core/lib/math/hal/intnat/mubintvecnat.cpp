@@ -73,6 +73,20 @@ NativeVectorT<IntegerType>::NativeVectorT(NativeVectorT&& bigVector) {
     m_modulus = bigVector.m_modulus;
 }
 
+template <class IntegerType>
+NativeVectorT<IntegerType>::NativeVectorT(IntegerType* data, usint length, const IntegerType& modulus,
+                                          std::shared_ptr<void> owner) {
+    this->SetModulus(modulus);
+#if BLOCK_VECTOR_ALLOCATION != 1
+    // the allocator hands out data for the storage and keeps the values found there
+    m_data = decltype(m_data)(NativeVectorAllocator<IntegerType>(data, length, std::move(owner)));
+    m_data.reserve(length);
+    m_data.resize(length);
+#else
+    m_data.assign(data, data + length);
+#endif
+}
+
 template <class IntegerType>
 NativeVectorT<IntegerType>::NativeVectorT(usint length, const IntegerType& modulus,
                                           std::initializer_list<std::string> rhs) {
@@ -54,7 +54,7 @@ template class Matrix<int64_t>;
     Matrix<T>& Matrix<T>::ModEq(const T& element) {   \
         for (size_t row = 0; row < rows; ++row) {     \
             for (size_t col = 0; col < cols; ++col) { \
-                data[row][col].ModEq(element);        \
+                (*this)(row, col).ModEq(element);     \
             }                                         \
         }                                             \
         return *this;                                 \
@@ -68,7 +68,7 @@ MODEQ_FOR_TYPE(BigInteger)
     Matrix<T>& Matrix<T>::ModSubEq(Matrix<T> const& b, const T& element) { \
         for (size_t row = 0; row < rows; ++row) {                          \
             for (size_t col = 0; col < cols; ++col) {                      \
-                data[row][col].ModSubEq(b.data[row][col], element);        \
+                (*this)(row, col).ModSubEq(b(row, col), element);          \
             }                                                              \
         }                                                                  \
         return *this;                                                      \
@@ -197,7 +197,7 @@ void Matrix<Field2n>::SetFormat(Format f) {
         for (size_t row = 0; row < rows; ++row) {
 #pragma omp parallel for
             for (size_t col = 0; col < cols; ++col) {
-                data[row][col].SetFormat(f);
+                (*this)(row, col).SetFormat(f);
             }
         }
     }
@@ -205,7 +205,7 @@ void Matrix<Field2n>::SetFormat(Format f) {
         for (size_t col = 0; col < cols; ++col) {
 #pragma omp parallel for
             for (size_t row = 0; row < rows; ++row) {
-                data[row][col].SetFormat(f);
+                (*this)(row, col).SetFormat(f);
             }
         }
     }
@@ -217,7 +217,7 @@ void Matrix<Field2n>::SwitchFormat() {
         for (size_t row = 0; row < rows; ++row) {
 #pragma omp parallel for
             for (size_t col = 0; col < cols; ++col) {
-                data[row][col].SwitchFormat();
+                (*this)(row, col).SwitchFormat();
             }
         }
     }
@@ -225,7 +225,7 @@ void Matrix<Field2n>::SwitchFormat() {
         for (size_t col = 0; col < cols; ++col) {
 #pragma omp parallel for
             for (size_t row = 0; row < rows; ++row) {
-                data[row][col].SwitchFormat();
+                (*this)(row, col).SwitchFormat();
             }
         }
     }
@@ -38,16 +38,46 @@
 
 #include "math/matrix.h"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace lbcrypto {
 
+// edge of the square tiles used by Matrix::Mult for scalar element types;
+// 32x32 tiles of 8-byte elements keep the three working tiles in L1
+static constexpr size_t MATRIX_MULT_TILE = 32;
+
+// multiplicative inverse of a pivot in the LU and Gauss-Jordan routines
+inline double InverseOf(double x) {
+    return 1.0 / x;
+}
+
+template <class Element>
+Element InverseOf(const Element& x) {
+    return x.Inverse();
+}
+
+// a Field2n pivot is a unit only in EVALUATION format with no zero slot
+template <class Element>
+static bool IsInvertible(const Element& x) {
+    if (x.GetFormat() != Format::EVALUATION)
+        return false;
+    for (const auto& slot : x) {
+        if (slot == std::complex<double>(0, 0))
+            return false;
+    }
+    return true;
+}
+
 template <class Element>
 Matrix<Element>::Matrix(alloc_func allocZero, size_t rows, size_t cols, alloc_func allocGen)
     : data(), rows(rows), cols(cols), allocZero(allocZero) {
-    data.resize(rows);
-    for (auto row = data.begin(); row != data.end(); ++row) {
-        for (size_t col = 0; col < cols; ++col) {
-            row->push_back(allocGen());
-        }
+    data.reserve(rows * cols);
+    for (size_t i = 0; i < rows * cols; ++i) {
+        data.push_back(allocGen());
     }
 }
 
@@ -55,16 +85,14 @@ template <class Element>
 Matrix<Element>& Matrix<Element>::operator=(const Matrix<Element>& other) {
     rows = other.rows;
     cols = other.cols;
-    deepCopyData(other.data);
+    data = other.data;
     return *this;
 }
 
 template <class Element>
 Matrix<Element>& Matrix<Element>::Fill(const Element& val) {
-    for (size_t row = 0; row < rows; ++row) {
-        for (size_t col = 0; col < cols; ++col) {
-            data[row][col] = val;
-        }
+    for (auto& elem : data) {
+        elem = val;
     }
     return *this;
 }
@@ -77,20 +105,62 @@ Matrix<Element> Matrix<Element>::Mult(Matrix<Element> const& other) const {
         OPENFHE_THROW(math_error, "incompatible matrix multiplication");
     }
     Matrix<Element> result(allocZero, rows, other.cols);
-    if (rows == 1) {
-#pragma omp parallel for
-        for (size_t col = 0; col < result.cols; ++col) {
-            for (size_t i = 0; i < cols; ++i) {
-                result.data[0][col] += data[0][i] * other.data[i][col];
+    const size_t rCols = result.cols;
+    if (result.data.empty() || cols == 0) {
+        return result;
+    }
+
+    if constexpr (std::is_same<Element, M2DCRTPoly>::value || std::is_same<Element, M4DCRTPoly>::value ||
+                  std::is_same<Element, M6DCRTPoly>::value) {
+        // Accumulate every entry of the result tower by tower, so the work is
+        // spread over both the entries and the RNS limbs: the products with a
+        // single output entry (e.g., T.m_e * zHat) are otherwise serial. Any
+        // tower mismatch falls through to the element-wise path, which reports it.
+        const usint towers = result.data[0].GetNumOfElements();
+        auto sameTowers    = [towers](const Element& elem) {
+            return elem.GetNumOfElements() == towers;
+        };
+        if (std::all_of(result.data.begin(), result.data.end(), sameTowers) &&
+            std::all_of(data.begin(), data.end(), sameTowers) &&
+            std::all_of(other.data.begin(), other.data.end(), sameTowers)) {
+            const size_t total = result.data.size() * towers;
+#pragma omp parallel for schedule(dynamic)
+            for (size_t idx = 0; idx < total; ++idx) {
+                const size_t pos = idx / towers;
+                const usint t    = idx % towers;
+                const size_t row = pos / rCols;
+                const size_t col = pos % rCols;
+                auto& acc        = result.data[pos].ElementAtIndex(t);
+                for (size_t i = 0; i < cols; ++i) {
+                    acc += data[row * cols + i].GetElementAtIndex(t) * other.data[i * rCols + col].GetElementAtIndex(t);
+                }
             }
+            return result;
         }
     }
-    else {
-#pragma omp parallel for
-        for (size_t row = 0; row < result.rows; ++row) {
-            for (size_t i = 0; i < cols; ++i) {
-                for (size_t col = 0; col < result.cols; ++col) {
-                    result.data[row][col] += data[row][i] * other.data[i][col];
+
+    // Cache-tiled i-k-j product over the row-major storage. Ring and field
+    // elements are large enough that each one fills several cache lines, so
+    // for them a tile is a single entry and the parallelism is over entries.
+    const size_t tile     = std::is_arithmetic<Element>::value ? MATRIX_MULT_TILE : 1;
+    const size_t rowTiles = (rows + tile - 1) / tile;
+    const size_t colTiles = (rCols + tile - 1) / tile;
+#pragma omp parallel for collapse(2) schedule(dynamic)
+    for (size_t rt = 0; rt < rowTiles; ++rt) {
+        for (size_t ct = 0; ct < colTiles; ++ct) {
+            const size_t rowEnd = std::min<size_t>(rows, (rt + 1) * tile);
+            const size_t colEnd = std::min<size_t>(rCols, (ct + 1) * tile);
+            for (size_t it = 0; it < cols; it += tile) {
+                const size_t iEnd = std::min<size_t>(cols, it + tile);
+                for (size_t row = rt * tile; row < rowEnd; ++row) {
+                    Element* dst = &result.data[row * rCols];
+                    for (size_t i = it; i < iEnd; ++i) {
+                        const Element& a = data[row * cols + i];
+                        const Element* b = &other.data[i * rCols];
+                        for (size_t col = ct * tile; col < colEnd; ++col) {
+                            dst[col] += a * b[col];
+                        }
+                    }
                 }
             }
         }
@@ -104,10 +174,8 @@ Matrix<Element>& Matrix<Element>::operator+=(Matrix<Element> const& other) {
         OPENFHE_THROW(math_error, "Addition operands have incompatible dimensions");
     }
 #pragma omp parallel for
-    for (size_t j = 0; j < cols; ++j) {
-        for (size_t i = 0; i < rows; ++i) {
-            data[i][j] += other.data[i][j];
-        }
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] += other.data[i];
     }
 
     return *this;
@@ -119,10 +187,8 @@ Matrix<Element>& Matrix<Element>::operator-=(Matrix<Element> const& other) {
         OPENFHE_THROW(math_error, "Subtraction operands have incompatible dimensions");
     }
 #pragma omp parallel for
-    for (size_t j = 0; j < cols; ++j) {
-        for (size_t i = 0; i < rows; ++i) {
-            data[i][j] -= other.data[i][j];
-        }
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] -= other.data[i];
     }
 
     return *this;
@@ -139,14 +205,104 @@ Matrix<Element> Matrix<Element>::Transpose() const {
     return result;
 }
 
+// LU elimination for double and Field2n; returns false, leaving *determinant
+// untouched, when a Field2n pivot is not a unit
+template <class Element>
+bool Matrix<Element>::DeterminantLU(Element* determinant) const {
+    if constexpr (std::is_same<Element, double>::value || std::is_same<Element, Field2n>::value) {
+        size_t n = rows;
+        Matrix<Element> lu(*this);
+        bool negate = false;
+
+        for (size_t k = 0; k < n; ++k) {
+            if constexpr (std::is_same<Element, double>::value) {
+                size_t pivot = k;
+                for (size_t i = k + 1; i < n; ++i) {
+                    if (std::fabs(lu(i, k)) > std::fabs(lu(pivot, k)))
+                        pivot = i;
+                }
+                if (lu(pivot, k) == 0) {
+                    *determinant = 0;
+                    return true;
+                }
+                if (pivot != k) {
+                    lu.SwapRows(k, pivot);
+                    negate = !negate;
+                }
+            }
+            else if constexpr (std::is_same<Element, Field2n>::value) {
+                if (!IsInvertible(lu(k, k)))
+                    return false;
+            }
+
+            Element pivotInverse = InverseOf(lu(k, k));
+#pragma omp parallel for
+            for (size_t i = k + 1; i < n; ++i) {
+                Element factor = lu(i, k) * pivotInverse;
+                for (size_t j = k + 1; j < n; ++j) {
+                    lu(i, j) -= factor * lu(k, j);
+                }
+            }
+        }
+
+        Element result = lu(0, 0);
+        for (size_t k = 1; k < n; ++k) {
+            result = result * lu(k, k);
+        }
+        *determinant = negate ? -result : result;
+        return true;
+    }
+    else {
+        return false;
+    }
+}
+
+// fraction-free Bareiss elimination for int and int64_t
+template <class Element>
+void Matrix<Element>::DeterminantBareiss(Element* determinant) const {
+    if constexpr (std::is_same<Element, int>::value || std::is_same<Element, int64_t>::value) {
+        size_t n = rows;
+        Matrix<Element> m(*this);
+        Element previous = 1;
+        bool negate      = false;
+
+        for (size_t k = 0; k + 1 < n; ++k) {
+            if (m(k, k) == 0) {
+                size_t pivot = k + 1;
+                while (pivot < n && m(pivot, k) == 0)
+                    ++pivot;
+                if (pivot == n) {
+                    *determinant = 0;
+                    return;
+                }
+                m.SwapRows(k, pivot);
+                negate = !negate;
+            }
+            // each entry becomes a (k+2)x(k+2) minor of the input, so the
+            // division by the previous pivot is exact
+#pragma omp parallel for
+            for (size_t i = k + 1; i < n; ++i) {
+                for (size_t j = k + 1; j < n; ++j) {
+                    m(i, j) = (m(i, j) * m(k, k) - m(i, k) * m(k, j)) / previous;
+                }
+            }
+            previous = m(k, k);
+        }
+        *determinant = negate ? -m(n - 1, n - 1) : m(n - 1, n - 1);
+    }
+}
+
 // YSP The signature of this method needs to be changed in the future
-// Laplace's formula is used to find the determinant
-// Complexity is O(d!), where d is the dimension
-// The determinant of a matrix is expressed in terms of its minors
-// recursive implementation
-// There are O(d^3) decomposition algorithms that can be implemented to support
-// larger dimensions. Examples include the LU decomposition, the QR
-// decomposition or the Cholesky decomposition(for positive definite matrices).
+// For double and Field2n the determinant is the product of the pivots of an LU
+// decomposition (with partial pivoting for double; Field2n is a product of
+// complex fields and is not pivoted, which works when its leading principal
+// minors are invertible, as for the positive-definite matrices in dgsampling).
+// For int and int64_t the fraction-free Bareiss elimination keeps every
+// intermediate value an exact minor of the input. Both are O(d^3).
+// Other element types (rings without exact division), and Field2n matrices
+// with a pivot that is not a unit, use Laplace's formula: the determinant of
+// a matrix is expressed in terms of its minors, recursively, with complexity
+// O(d!), where d is the dimension.
 template <class Element>
 void Matrix<Element>::Determinant(Element* determinant) const {
     if (rows != cols)
@@ -156,12 +312,21 @@ void Matrix<Element>::Determinant(Element* determinant) const {
         OPENFHE_THROW(math_error, "Dimension should be at least one");
 
     if (rows == 1) {
-        *determinant = data[0][0];
+        *determinant = data[0];
     }
     else if (rows == 2) {
-        *determinant = data[0][0] * (data[1][1]) - data[1][0] * (data[0][1]);
+        *determinant = data[0] * data[3] - data[2] * data[1];
     }
     else {
+        if constexpr (std::is_same<Element, double>::value || std::is_same<Element, Field2n>::value) {
+            if (DeterminantLU(determinant))
+                return;
+        }
+        else if constexpr (std::is_same<Element, int>::value || std::is_same<Element, int64_t>::value) {
+            DeterminantBareiss(determinant);
+            return;
+        }
+
         size_t j1, j2;
         size_t n = rows;
 
@@ -179,7 +344,7 @@ void Matrix<Element>::Determinant(Element* determinant) const {
 
                     // copy source element into new sub-matrix i-1 because new sub-matrix
                     // is one row (and column) smaller with excluded minors
-                    result.data[i - 1][j2] = data[i][j];
+                    result(i - 1, j2) = (*this)(i, j);
                     j2++;  // move to next sub-matrix column position
                 }
             }
@@ -188,9 +353,9 @@ void Matrix<Element>::Determinant(Element* determinant) const {
             result.Determinant(&tempDeterminant);
 
             if (j1 % 2 == 0)
-                *determinant = *determinant + (data[0][j1]) * tempDeterminant;
+                *determinant = *determinant + (*this)(0, j1) * tempDeterminant;
             else
-                *determinant = *determinant - (data[0][j1]) * tempDeterminant;
+                *determinant = *determinant - (*this)(0, j1) * tempDeterminant;
 
             // if (j1 % 2 == 0)
             //  determinant = determinant + (*data[0][j1]) *
@@ -202,6 +367,74 @@ void Matrix<Element>::Determinant(Element* determinant) const {
     return;
 }
 
+// In-place Gauss-Jordan inversion: each step k scales the pivot row by the
+// inverse of the pivot and eliminates column k from every other row, storing
+// the corresponding column of the inverse in the freed entries. For double
+// the rows are swapped for partial pivoting, and the swaps are undone on the
+// columns of the result in reverse order at the end. Field2n is not pivoted,
+// so a leading principal minor that is not a unit throws.
+template <class Element>
+Matrix<Element> Matrix<Element>::Inverse() const {
+    if (rows != cols)
+        OPENFHE_THROW(math_error, "Supported only for square matrix");
+    if (rows < 1)
+        OPENFHE_THROW(math_error, "Dimension should be at least one");
+
+    if constexpr (std::is_same<Element, double>::value || std::is_same<Element, Field2n>::value) {
+        size_t n = rows;
+        Matrix<Element> inv(*this);
+        std::vector<size_t> swaps(n);
+
+        for (size_t k = 0; k < n; ++k) {
+            swaps[k] = k;
+            if constexpr (std::is_same<Element, double>::value) {
+                for (size_t i = k + 1; i < n; ++i) {
+                    if (std::fabs(inv(i, k)) > std::fabs(inv(swaps[k], k)))
+                        swaps[k] = i;
+                }
+                if (inv(swaps[k], k) == 0)
+                    OPENFHE_THROW(math_error, "Matrix is singular");
+                inv.SwapRows(k, swaps[k]);
+            }
+            else if constexpr (std::is_same<Element, Field2n>::value) {
+                if (!IsInvertible(inv(k, k)))
+                    OPENFHE_THROW(math_error,
+                                  "Field2n matrix has a pivot that is not a unit (it has to be in EVALUATION "
+                                  "format with invertible leading principal minors)");
+            }
+
+            Element pivotInverse = InverseOf(inv(k, k));
+            for (size_t j = 0; j < n; ++j) {
+                if (j != k)
+                    inv(k, j) = inv(k, j) * pivotInverse;
+            }
+#pragma omp parallel for
+            for (size_t i = 0; i < n; ++i) {
+                if (i == k)
+                    continue;
+                Element factor = inv(i, k);
+                for (size_t j = 0; j < n; ++j) {
+                    if (j != k)
+                        inv(i, j) -= factor * inv(k, j);
+                }
+                inv(i, k) = -(factor * pivotInverse);
+            }
+            inv(k, k) = pivotInverse;
+        }
+
+        for (size_t k = n; k-- > 0;) {
+            if (swaps[k] != k) {
+                for (size_t i = 0; i < n; ++i)
+                    std::swap(inv(i, k), inv(i, swaps[k]));
+            }
+        }
+        return inv;
+    }
+    else {
+        OPENFHE_THROW(not_available_error, "Inverse is supported only for double and Field2n matrices");
+    }
+}
+
 // The cofactor matrix is the matrix of determinants of the minors A_{ij}
 // multiplied by -1^{i+j} The determinant subroutine is used
 template <class Element>
@@ -228,7 +461,7 @@ Matrix<Element> Matrix<Element>::CofactorMatrix() const {
                 for (jj = 0; jj < n; jj++) {
                     if (jj == j)
                         continue;
-                    c.data[iNew][jNew] = data[ii][jj];
+                    c(iNew, jNew) = (*this)(ii, jj);
                     jNew++;
                 }
                 iNew++;
@@ -241,9 +474,9 @@ Matrix<Element> Matrix<Element>::CofactorMatrix() const {
 
             /* Fill in the elements of the cofactor */
             if ((i + j) % 2 == 0)
-                result.data[i][j] = determinant;
+                result(i, j) = determinant;
             else
-                result.data[i][j] = negDeterminant;
+                result(i, j) = negDeterminant;
         }
     }
 
@@ -256,13 +489,12 @@ Matrix<Element>& Matrix<Element>::VStack(Matrix<Element> const& other) {
     if (cols != other.cols) {
         OPENFHE_THROW(math_error, "VStack rows not equal size");
     }
-    for (size_t row = 0; row < other.rows; ++row) {
-        data_row_t rowElems;
-        for (auto elem = other.data[row].begin(); elem != other.data[row].end(); ++elem) {
-            rowElems.push_back(*elem);
-        }
-        data.push_back(std::move(rowElems));
+    if (this == &other) {
+        Matrix<Element> copy(other);
+        return VStack(copy);
     }
+    // rows are contiguous, so the new rows are simply appended
+    data.insert(data.end(), other.data.begin(), other.data.end());
     rows += other.rows;
     return *this;
 }
@@ -273,28 +505,22 @@ inline Matrix<Element>& Matrix<Element>::HStack(Matrix<Element> const& other) {
     if (rows != other.rows) {
         OPENFHE_THROW(math_error, "HStack cols not equal size");
     }
+    if (this == &other) {
+        Matrix<Element> copy(other);
+        return HStack(copy);
+    }
+    data_row_t stacked;
+    stacked.reserve(rows * (cols + other.cols));
     for (size_t row = 0; row < rows; ++row) {
-        data_row_t rowElems;
-        for (auto& elem : other.data[row]) {
-            rowElems.push_back(elem);
-        }
-        MoveAppend(data[row], rowElems);
+        std::move(data.begin() + row * cols, data.begin() + (row + 1) * cols, std::back_inserter(stacked));
+        stacked.insert(stacked.end(), other.data.begin() + row * other.cols,
+                       other.data.begin() + (row + 1) * other.cols);
     }
+    data = std::move(stacked);
     cols += other.cols;
     return *this;
 }
 
-// template<class Element>
-// void Matrix<Element>::deepCopyData(data_t const& src) {
-//    data.clear();
-//    data.resize(src.size());
-//    for (size_t row = 0; row < src.size(); ++row) {
-//        for (auto elem = src[row].begin(); elem != src[row].end(); ++elem) {
-//            data[row].push_back(*elem);
-//        }
-//    }
-//}
-
 /*
  * Multiply the matrix by a vector of 1's, which is the same as adding all the
  * elements in the row together.
@@ -307,7 +533,7 @@ Matrix<Element> Matrix<Element>::MultByUnityVector() const {
 #pragma omp parallel for
     for (size_t row = 0; row < result.rows; ++row) {
         for (size_t col = 0; col < cols; ++col) {
-            result.data[row][0] += data[row][col];
+            result.data[row] += data[row * cols + col];
         }
     }
 
@@ -327,7 +553,7 @@ Matrix<Element> Matrix<Element>::MultByRandomVector(std::vector<int> ranvec) con
     for (size_t row = 0; row < result.rows; ++row) {
         for (size_t col = 0; col < cols; ++col) {
             if (ranvec[col] == 1)
-                result.data[row][0] += data[row][col];
+                result.data[row] += data[row * cols + col];
         }
     }
     return result;
@@ -38,7 +38,9 @@
 #include <time.h>
 #include <chrono>
 #include <cmath>
+#include <shared_mutex>
 #include <sstream>
+#include <unordered_map>
 
 #include "config_core.h"
 #include "math/distributiongenerator.h"
@@ -318,4 +320,26 @@ void PrecomputeAutoMap(uint32_t n, uint32_t k, std::vector<uint32_t>* precomp) {
     }
 }
 
+const std::vector<uint32_t>& GetAutoMap(uint32_t n, uint32_t k) {
+    static std::unordered_map<uint64_t, std::vector<uint32_t>> autoMaps;
+    static std::shared_mutex autoMapsMutex;
+
+    k %= (n << 1);
+    const uint64_t key = (static_cast<uint64_t>(n) << 32) | k;
+    {
+        std::shared_lock<std::shared_mutex> lock(autoMapsMutex);
+        auto it = autoMaps.find(key);
+        if (it != autoMaps.end())
+            return it->second;
+    }
+
+    // the map is built outside of the lock; if another thread inserted it
+    // in the meantime, emplace keeps the existing entry
+    std::vector<uint32_t> map(n);
+    PrecomputeAutoMap(n, k, &map);
+
+    std::unique_lock<std::shared_mutex> lock(autoMapsMutex);
+    return autoMaps.emplace(key, std::move(map)).first->second;
+}
+
 }  // namespace lbcrypto
@@ -34,8 +34,211 @@
  */
 
 #include "utils/parallel.h"
+#include "utils/exception.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+    #include <dirent.h>
+    #include <sched.h>
+#endif
 
 namespace lbcrypto {
 
-ParallelControls OpenFHEParallelControls;
+namespace {
+struct NumaTopology {
+    // usable CPUs of every node
+    std::vector<std::vector<int>> nodeCpus;
+    // node of every CPU, -1 if the CPU is not usable
+    std::vector<int> cpuNode;
+};
+
+#if defined(__linux__)
+// parses a sysfs CPU list such as "0-7,16-23"
+std::vector<int> ParseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end  = list.find(',', pos);
+        auto range  = list.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+        size_t dash = range.find('-');
+        try {
+            int first = std::stoi(range.substr(0, dash));
+            int last  = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; cpu++)
+                cpus.push_back(cpu);
+        }
+        catch (...) {
+            // skips malformed or empty ranges
+        }
+        if (end == std::string::npos)
+            break;
+        pos = end + 1;
+    }
+    return cpus;
+}
+#endif
+
+NumaTopology DiscoverNumaTopology() {
+    NumaTopology topology;
+    std::vector<int> usable;
+
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool haveMask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    std::vector<int> nodeIds;
+    if (DIR* dir = opendir("/sys/devices/system/node")) {
+        while (struct dirent* entry = readdir(dir)) {
+            std::string name(entry->d_name);
+            if (name.compare(0, 4, "node") == 0 && name.size() > 4 &&
+                std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; }))
+                nodeIds.push_back(std::stoi(name.substr(4)));
+        }
+        closedir(dir);
+    }
+    std::sort(nodeIds.begin(), nodeIds.end());
+
+    for (int id : nodeIds) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist");
+        std::string list;
+        std::getline(file, list);
+        std::vector<int> cpus;
+        for (int cpu : ParseCpuList(list)) {
+            if (cpu < CPU_SETSIZE && (!haveMask || CPU_ISSET(cpu, &allowed)))
+                cpus.push_back(cpu);
+        }
+        if (!cpus.empty())
+            topology.nodeCpus.push_back(std::move(cpus));
+    }
+
+    for (int cpu = 0; haveMask && cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &allowed))
+            usable.push_back(cpu);
+    }
+#endif
+
+    // no NUMA information: a single node with all CPUs
+    if (topology.nodeCpus.empty()) {
+        if (usable.empty()) {
+            for (int cpu = 0; cpu < ParallelControls::GetNumProcs(); cpu++)
+                usable.push_back(cpu);
+        }
+        topology.nodeCpus.push_back(usable);
+    }
+
+    for (size_t node = 0; node < topology.nodeCpus.size(); node++) {
+        for (int cpu : topology.nodeCpus[node]) {
+            if (cpu >= static_cast<int>(topology.cpuNode.size()))
+                topology.cpuNode.resize(cpu + 1, -1);
+            topology.cpuNode[cpu] = node;
+        }
+    }
+    return topology;
+}
+
+const NumaTopology& GetNumaTopology() {
+    static const NumaTopology topology = DiscoverNumaTopology();
+    return topology;
+}
+
+#if defined(__linux__)
+bool PinCurrentThread(const std::vector<int>& cpus) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+        CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
 }
+#endif
+}  // namespace
+
+int ParallelControls::GetNumaNodes() {
+    return GetNumaTopology().nodeCpus.size();
+}
+
+const std::vector<int>& ParallelControls::GetNumaNodeCpus(int node) {
+    const auto& topology = GetNumaTopology();
+    if (node < 0 || node >= static_cast<int>(topology.nodeCpus.size()))
+        OPENFHE_THROW(config_error, "NUMA node " + std::to_string(node) + " does not exist");
+    return topology.nodeCpus[node];
+}
+
+int ParallelControls::GetCurrentNumaNode() {
+#if defined(__linux__)
+    const auto& topology = GetNumaTopology();
+    int cpu              = sched_getcpu();
+    if (cpu >= 0 && cpu < static_cast<int>(topology.cpuNode.size()) && topology.cpuNode[cpu] >= 0)
+        return topology.cpuNode[cpu];
+#endif
+    return 0;
+}
+
+void ParallelControls::PinCurrentThreadToNumaNode(int node) {
+    const auto& cpus = GetNumaNodeCpus(node);
+#if defined(__linux__)
+    if (!PinCurrentThread(cpus))
+        OPENFHE_THROW(config_error, "Cannot pin the thread to NUMA node " + std::to_string(node));
+#else
+    OPENFHE_THROW(not_available_error, "Thread pinning is only supported on Linux");
+#endif
+}
+
+void ParallelControls::SetThreadPlacement(ThreadPlacement placement) {
+    const auto& topology = GetNumaTopology();
+
+    // CPU of thread i is cpus[i % cpus.size()]
+    std::vector<int> cpus;
+    if (placement == THREAD_PLACEMENT_COMPACT) {
+        for (const auto& nodeCpus : topology.nodeCpus)
+            cpus.insert(cpus.end(), nodeCpus.begin(), nodeCpus.end());
+    }
+    else if (placement == THREAD_PLACEMENT_SCATTER) {
+        for (size_t i = 0;; i++) {
+            bool added = false;
+            for (const auto& nodeCpus : topology.nodeCpus) {
+                if (i < nodeCpus.size()) {
+                    cpus.push_back(nodeCpus[i]);
+                    added = true;
+                }
+            }
+            if (!added)
+                break;
+        }
+    }
+
+#if defined(__linux__)
+    std::vector<int> all;
+    for (const auto& nodeCpus : topology.nodeCpus)
+        all.insert(all.end(), nodeCpus.begin(), nodeCpus.end());
+
+    bool failed = false;
+    #ifdef PARALLEL
+        #pragma omp parallel reduction(|| : failed)
+    #endif
+    {
+    #ifdef PARALLEL
+        size_t tid = omp_get_thread_num();
+    #else
+        size_t tid = 0;
+    #endif
+        if (cpus.empty())
+            failed = !PinCurrentThread(all);
+        else
+            failed = !PinCurrentThread({cpus[tid % cpus.size()]});
+    }
+    if (failed)
+        OPENFHE_THROW(config_error, "Cannot set the CPU affinity of the OpenMP threads");
+#else
+    if (placement != THREAD_PLACEMENT_NONE)
+        OPENFHE_THROW(not_available_error, "Thread placement is only supported on Linux");
+#endif
+    threadPlacement = placement;
+}
+
+ParallelControls OpenFHEParallelControls;
+}  // namespace lbcrypto
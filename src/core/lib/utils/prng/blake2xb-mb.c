@@ -0,0 +1,245 @@
+// clang-format off
+/*
+   Multi-buffer BLAKE2Xb built on the BLAKE2 reference source code package.
+
+   The output of BLAKE2Xb is a sequence of independent BLAKE2b invocations
+   (one per 64-byte output block) that share the same message, the root hash,
+   and differ only in the node offset of their parameter blocks. This file
+   computes BLAKE2XB_LANES of these blocks at once, lane-sliced: word k of the
+   working state of all the lanes is kept together, so every step of the G
+   function is a single vector operation. With AVX2 the lanes map to one
+   256-bit register; otherwise the lane loops are plain C that the compiler
+   may vectorize for the target. The output is identical to blake2xb().
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/prng/blake2.h"
+#include "utils/prng/blake2-impl.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+static const uint64_t blake2b_mb_IV[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
+    0xa54ff53a5f1d36f1ULL, 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL};
+
+static const uint8_t blake2b_mb_sigma[12][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3}};
+
+/*
+ * Compresses one block for BLAKE2XB_LANES states at once. All the lanes
+ * compress the same message block m with the same counter t0 (t1 = 0) and
+ * the last-block flag set (f0 = ~0, f1 = 0); h[k][l] is word k of lane l.
+ */
+#if defined(__AVX2__)
+
+#define ROTR32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR24(x) _mm256_shuffle_epi8((x), r24)
+#define ROTR16(x) _mm256_shuffle_epi8((x), r16)
+#define ROTR63(x) _mm256_or_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+#define G(r, i, a, b, c, d)                                                        \
+  do {                                                                             \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), mv[blake2b_mb_sigma[r][2 * i]]);  \
+    d = ROTR32(_mm256_xor_si256(d, a));                                            \
+    c = _mm256_add_epi64(c, d);                                                    \
+    b = ROTR24(_mm256_xor_si256(b, c));                                            \
+    a = _mm256_add_epi64(_mm256_add_epi64(a, b), mv[blake2b_mb_sigma[r][2 * i + 1]]); \
+    d = ROTR16(_mm256_xor_si256(d, a));                                            \
+    c = _mm256_add_epi64(c, d);                                                    \
+    b = ROTR63(_mm256_xor_si256(b, c));                                            \
+  } while (0)
+
+static void blake2b_compress_mb(uint64_t h[8][BLAKE2XB_LANES], const uint64_t m[16],
+                                uint64_t t0) {
+  const __m256i r24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                       3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+  const __m256i r16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                       2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+  __m256i mv[16];
+  __m256i v[16];
+  size_t i;
+
+  for (i = 0; i < 16; ++i) {
+    mv[i] = _mm256_set1_epi64x((long long)m[i]);
+  }
+  for (i = 0; i < 8; ++i) {
+    v[i] = _mm256_loadu_si256((const __m256i *)h[i]);
+    v[i + 8] = _mm256_set1_epi64x((long long)blake2b_mb_IV[i]);
+  }
+  v[12] = _mm256_xor_si256(v[12], _mm256_set1_epi64x((long long)t0));
+  v[14] = _mm256_xor_si256(v[14], _mm256_set1_epi64x(-1));
+
+  for (i = 0; i < 12; ++i) {
+    G(i, 0, v[0], v[4], v[8], v[12]);
+    G(i, 1, v[1], v[5], v[9], v[13]);
+    G(i, 2, v[2], v[6], v[10], v[14]);
+    G(i, 3, v[3], v[7], v[11], v[15]);
+    G(i, 4, v[0], v[5], v[10], v[15]);
+    G(i, 5, v[1], v[6], v[11], v[12]);
+    G(i, 6, v[2], v[7], v[8], v[13]);
+    G(i, 7, v[3], v[4], v[9], v[14]);
+  }
+
+  for (i = 0; i < 8; ++i) {
+    __m256i hi = _mm256_loadu_si256((const __m256i *)h[i]);
+    hi = _mm256_xor_si256(hi, _mm256_xor_si256(v[i], v[i + 8]));
+    _mm256_storeu_si256((__m256i *)h[i], hi);
+  }
+}
+
+#undef G
+#undef ROTR32
+#undef ROTR24
+#undef ROTR16
+#undef ROTR63
+
+#else  /* scalar lanes */
+
+#define G(r, i, a, b, c, d)                                  \
+  do {                                                       \
+    const uint64_t x = m[blake2b_mb_sigma[r][2 * i + 0]];    \
+    const uint64_t y = m[blake2b_mb_sigma[r][2 * i + 1]];    \
+    for (l = 0; l < BLAKE2XB_LANES; ++l) {                   \
+      a[l] = a[l] + b[l] + x;                                \
+      d[l] = rotr64(d[l] ^ a[l], 32);                        \
+      c[l] = c[l] + d[l];                                    \
+      b[l] = rotr64(b[l] ^ c[l], 24);                        \
+      a[l] = a[l] + b[l] + y;                                \
+      d[l] = rotr64(d[l] ^ a[l], 16);                        \
+      c[l] = c[l] + d[l];                                    \
+      b[l] = rotr64(b[l] ^ c[l], 63);                        \
+    }                                                        \
+  } while (0)
+
+static void blake2b_compress_mb(uint64_t h[8][BLAKE2XB_LANES], const uint64_t m[16],
+                                uint64_t t0) {
+  uint64_t v[16][BLAKE2XB_LANES];
+  size_t i, l;
+
+  for (i = 0; i < 8; ++i) {
+    for (l = 0; l < BLAKE2XB_LANES; ++l) {
+      v[i][l] = h[i][l];
+      v[i + 8][l] = blake2b_mb_IV[i];
+    }
+  }
+  for (l = 0; l < BLAKE2XB_LANES; ++l) {
+    v[12][l] ^= t0;
+    v[14][l] ^= (uint64_t)-1;
+  }
+
+  for (i = 0; i < 12; ++i) {
+    G(i, 0, v[0], v[4], v[8], v[12]);
+    G(i, 1, v[1], v[5], v[9], v[13]);
+    G(i, 2, v[2], v[6], v[10], v[14]);
+    G(i, 3, v[3], v[7], v[11], v[15]);
+    G(i, 4, v[0], v[5], v[10], v[15]);
+    G(i, 5, v[1], v[6], v[11], v[12]);
+    G(i, 6, v[2], v[7], v[8], v[13]);
+    G(i, 7, v[3], v[4], v[9], v[14]);
+  }
+
+  for (i = 0; i < 8; ++i) {
+    for (l = 0; l < BLAKE2XB_LANES; ++l) {
+      h[i][l] ^= v[i][l] ^ v[i + 8][l];
+    }
+  }
+}
+
+#undef G
+
+#endif
+
+int blake2xb_mb(void *out, size_t outlen, const void *in, size_t inlen,
+                const void *key, size_t keylen) {
+  blake2xb_state S[1];
+  blake2b_state C[1];
+  blake2b_param P[1];
+  uint8_t root[BLAKE2B_BLOCKBYTES];
+  uint64_t m[16];
+  uint64_t h[8][BLAKE2XB_LANES];
+  uint8_t buffer[BLAKE2B_OUTBYTES];
+  size_t i, k, l;
+
+  /* Verify parameters */
+  if (NULL == in && inlen > 0) return -1;
+  if (NULL == out) return -1;
+  if (NULL == key && keylen > 0) return -1;
+  if (keylen > BLAKE2B_KEYBYTES) return -1;
+  if (outlen == 0) return -1;
+
+  /* The root hash is computed exactly as in blake2xb() */
+  if (blake2xb_init_key(S, outlen, key, keylen) < 0) {
+    return -1;
+  }
+  blake2xb_update(S, in, inlen);
+  if (blake2b_final(S->S, root, BLAKE2B_OUTBYTES) < 0) {
+    return -1;
+  }
+
+  /* Every output block hashes the root, zero-padded to a single block */
+  memset(root + BLAKE2B_OUTBYTES, 0, BLAKE2B_BLOCKBYTES - BLAKE2B_OUTBYTES);
+  for (k = 0; k < 16; ++k) {
+    m[k] = load64(root + k * sizeof(m[k]));
+  }
+
+  memcpy(P, S->P, sizeof(blake2b_param));
+  P->key_length = 0;
+  P->fanout = 0;
+  P->depth = 0;
+  store32(&P->leaf_length, BLAKE2B_OUTBYTES);
+  P->inner_length = BLAKE2B_OUTBYTES;
+  P->node_depth = 0;
+
+  for (i = 0; i * BLAKE2B_OUTBYTES < outlen; i += BLAKE2XB_LANES) {
+    /* Lanes past the end of the output are computed and discarded */
+    for (l = 0; l < BLAKE2XB_LANES; ++l) {
+      const size_t offset = (i + l) * BLAKE2B_OUTBYTES;
+      const size_t left = (offset < outlen) ? outlen - offset : BLAKE2B_OUTBYTES;
+      P->digest_length = (uint8_t)((left < BLAKE2B_OUTBYTES) ? left : BLAKE2B_OUTBYTES);
+      store32(&P->node_offset, (uint32_t)(i + l));
+      blake2b_init_param(C, P);
+      for (k = 0; k < 8; ++k) {
+        h[k][l] = C->h[k];
+      }
+    }
+
+    blake2b_compress_mb(h, m, BLAKE2B_OUTBYTES);
+
+    for (l = 0; l < BLAKE2XB_LANES; ++l) {
+      const size_t offset = (i + l) * BLAKE2B_OUTBYTES;
+      size_t block_size;
+      if (offset >= outlen) break;
+      block_size = (outlen - offset < BLAKE2B_OUTBYTES) ? outlen - offset : BLAKE2B_OUTBYTES;
+      for (k = 0; k < 8; ++k) {
+        store64(buffer + k * sizeof(h[k][l]), h[k][l]);
+      }
+      memcpy((uint8_t *)out + offset, buffer, block_size);
+    }
+  }
+
+  secure_zero_memory(root, sizeof(root));
+  secure_zero_memory(m, sizeof(m));
+  secure_zero_memory(h, sizeof(h));
+  secure_zero_memory(buffer, sizeof(buffer));
+  secure_zero_memory(P, sizeof(P));
+  secure_zero_memory(C, sizeof(C));
+  return 0;
+}
+
+// clang-format on
@@ -33,6 +33,7 @@
   This code tests the transform feature of the OpenFHE lattice encryption library.
  */
 
+#include <cmath>
 #include <iostream>
 #include <vector>
 #include "gtest/gtest.h"
@@ -42,6 +43,7 @@
 #include "math/distrgen.h"
 #include "testdefs.h"
 #include "utils/exception.h"
+#include "utils/parallel.h"
 
 using namespace lbcrypto;
 
@@ -592,6 +594,71 @@ TEST(UTDCRTPoly, DCRT_mod_ops_on_two_elements) {
     RUN_BIG_DCRTPOLYS(DCRT_mod_ops_on_two_elements, "DCRT DCRT_mod_ops_on_two_elements");
 }
 
+template <typename Element>
+void DCRT_interpolate_centered(const std::string& msg) {
+    usint order     = 32;
+    usint nBits     = 50;
+    usint towersize = 5;
+
+    std::shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams =
+        GenerateDCRTParams<typename Element::Integer>(order, towersize, nBits);
+
+    typename Element::DugType dug;
+    Element op(dug, ildcrtparams, Format::EVALUATION);
+
+    typename Element::PolyLargeType big = op.CRTInterpolate();
+    const auto& Q                       = big.GetModulus();
+    const auto QHalf                    = Q >> 1;
+
+    std::vector<usint> indices;
+    for (usint i = 0; i < ildcrtparams->GetRingDimension(); i += 3)
+        indices.push_back(i);
+    std::vector<double> centered = op.CRTInterpolateCentered(indices);
+
+    ASSERT_EQ(centered.size(), indices.size()) << msg;
+    for (size_t k = 0; k < indices.size(); k++) {
+        double expected = (big[indices[k]] > QHalf) ? -(Q - big[indices[k]]).ConvertToDouble() :
+                                                      big[indices[k]].ConvertToDouble();
+        EXPECT_NEAR(centered[k], expected, std::abs(expected) * 1e-15)
+            << msg << " Failure: CRTInterpolateCentered index " << indices[k];
+    }
+
+    // small values of both signs must come back exactly
+    Element small(ildcrtparams, Format::COEFFICIENT, true);
+    small += typename Element::Integer(12345);
+    small = small.Negate() + typename Element::Integer(3);
+    std::vector<double> smallCentered = small.CRTInterpolateCentered({0, 1});
+    EXPECT_EQ(smallCentered[0], -12342.0) << msg << " Failure: CRTInterpolateCentered negative value";
+    EXPECT_EQ(smallCentered[1], 0.0) << msg << " Failure: CRTInterpolateCentered zero value";
+}
+
+TEST(UTDCRTPoly, DCRT_interpolate_centered) {
+    RUN_BIG_DCRTPOLYS(DCRT_interpolate_centered, "DCRT DCRT_interpolate_centered");
+}
+
+template <typename Element>
+void DCRT_first_touch_allocation(const std::string& msg) {
+    std::shared_ptr<ILDCRTParams<typename Element::Integer>> ildcrtparams =
+        GenerateDCRTParams<typename Element::Integer>(64, 6, 50);
+
+    typename Element::DugType dug;
+    Element op(dug, ildcrtparams, Format::EVALUATION);
+    Element zero(ildcrtparams, Format::EVALUATION, true);
+
+    OpenFHEParallelControls.EnableFirstTouchAllocation();
+    Element zeroParallel(ildcrtparams, Format::EVALUATION, true);
+    Element copyParallel(op);
+    OpenFHEParallelControls.DisableFirstTouchAllocation();
+
+    EXPECT_EQ(zeroParallel, zero) << msg << " Failure: first-touch zero allocation";
+    EXPECT_EQ(copyParallel, op) << msg << " Failure: first-touch copy";
+    EXPECT_EQ(copyParallel.GetNumOfElements(), op.GetNumOfElements()) << msg;
+}
+
+TEST(UTDCRTPoly, DCRT_first_touch_allocation) {
+    RUN_BIG_DCRTPOLYS(DCRT_first_touch_allocation, "DCRT DCRT_first_touch_allocation");
+}
+
 // only need to try this with one
 void testDCRTPolyConstructorNegative(std::vector<NativePoly>& towers) {
     DCRTPoly expectException(towers);
@@ -43,6 +43,7 @@
 #include "math/nbtheory.h"
 #include "utils/debug.h"
 #include "utils/inttypes.h"
+#include "utils/prng/blake2.h"
 #include "utils/utilities.h"
 
 #include "testdefs.h"
@@ -220,6 +221,40 @@ void testDiscreteUniformGenerator(typename V::Integer& modulus, std::string test
         << "Failure testing second_moment_test_convertToDouble " << test_name;
 }
 
+TEST(UTDistrGen, DiscreteUniformGeneratorNative) {
+    // native vectors are sampled with whole PRNG words and fused rejection
+    NativeInteger small_modulus("7919");
+    testDiscreteUniformGenerator<NativeVector>(small_modulus, "native small_modulus");
+
+    NativeInteger large_modulus("1152921504606846883");
+    testDiscreteUniformGenerator<NativeVector>(large_modulus, "native large_modulus");
+
+    DiscreteUniformGeneratorImpl<NativeVector> dug;
+    dug.SetModulus(large_modulus);
+    NativeVector v = dug.GenerateVector(4096);
+    for (usint i = 0; i < v.GetLength(); i++) {
+        EXPECT_LT(v[i], large_modulus) << "Failure: native uniform sample is not reduced";
+    }
+}
+
+TEST(UTDistrGen, Blake2xbMultiBuffer) {
+    // blake2xb_mb must produce the same stream as the reference blake2xb
+    std::vector<uint8_t> key(64), in(16);
+    for (usint i = 0; i < key.size(); i++)
+        key[i] = static_cast<uint8_t>(7 * i + 1);
+    for (usint i = 0; i < in.size(); i++)
+        in[i] = static_cast<uint8_t>(3 * i);
+
+    for (size_t outlen : {1, 33, 64, 100, 255, 256, 320, 1000, 4096}) {
+        for (size_t keylen : {0, 17, 64}) {
+            std::vector<uint8_t> ref(outlen), mb(outlen);
+            EXPECT_EQ(blake2xb(ref.data(), outlen, in.data(), in.size(), key.data(), keylen), 0);
+            EXPECT_EQ(blake2xb_mb(mb.data(), outlen, in.data(), in.size(), key.data(), keylen), 0);
+            EXPECT_EQ(ref, mb) << "Failure: blake2xb_mb differs for outlen " << outlen << " keylen " << keylen;
+        }
+    }
+}
+
 #ifdef PARALLEL
 template <typename V>
 void ParallelDiscreteUniformGenerator_LONG(const std::string& msg) {
@@ -480,6 +515,56 @@ TEST(UTDistrGen, DiscreteGaussianGenerator) {
     RUN_ALL_BACKENDS(DiscreteGaussianGeneratorTest, "DiscreteGaussianGeneratorTest")
 }
 
+// Checks the frequencies produced by the CDT sampler (both the block path of
+// GenerateIntVector and the single-sample GenerateInt) against the discrete
+// Gaussian probabilities for a deviation below and one above DGG_CDT_SCAN_MAX_STD
+template <typename V>
+void CheckDiscreteGaussianCDT(double stdev, const std::string& msg) {
+    usint size = 200000;
+    auto dgg   = DiscreteGaussianGeneratorImpl<V>(stdev);
+
+    double norm = 1.0;
+    for (int x = 1; x <= 12 * stdev; x++) {
+        norm += 2 * exp(-x * x / (2 * stdev * stdev));
+    }
+
+    std::shared_ptr<int64_t> block = dgg.GenerateIntVector(size);
+    std::vector<int64_t> single(size);
+    for (usint i = 0; i < size; i++) {
+        single[i] = dgg.GenerateInt();
+    }
+
+    for (const int64_t* samples : std::vector<const int64_t*>{block.get(), single.data()}) {
+        std::vector<usint> counts(7, 0);
+        double variance = 0;
+        for (usint i = 0; i < size; i++) {
+            variance += static_cast<double>(samples[i] * samples[i]);
+            if (samples[i] >= -3 && samples[i] <= 3)
+                counts[samples[i] + 3]++;
+        }
+        variance /= size;
+        EXPECT_NEAR(stdev * stdev, variance, 0.05 * stdev * stdev) << msg << " Failure CDT variance";
+
+        for (int x = -3; x <= 3; x++) {
+            double expected = size * exp(-x * x / (2 * stdev * stdev)) / norm;
+            // five standard deviations of the binomial count
+            EXPECT_NEAR(expected, counts[x + 3], 5 * sqrt(expected)) << msg << " Failure CDT frequency of " << x;
+        }
+    }
+}
+
+template <typename V>
+void DiscreteGaussianGeneratorCDT(const std::string& msg) {
+    // the first deviation scans the whole table, the second one binary-searches it
+    for (double stdev : {3.19, 50.0}) {
+        CheckDiscreteGaussianCDT<V>(stdev, msg + " stdev " + std::to_string(stdev));
+    }
+}
+
+TEST(UTDistrGen, DiscreteGaussianGeneratorCDT) {
+    RUN_ALL_BACKENDS(DiscreteGaussianGeneratorCDT, "DiscreteGaussianGeneratorCDT")
+}
+
 #ifdef PARALLEL
 template <typename V>
 void ParallelDiscreteGaussianGenerator_VERY_LONG(const std::string& msg) {
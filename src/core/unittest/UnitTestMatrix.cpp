@@ -36,6 +36,7 @@
 #include <iostream>
 #include "gtest/gtest.h"
 
+#include "lattice/field2n.h"
 #include "lattice/lat-hal.h"
 #include "math/distrgen.h"
 #include "math/nbtheory.h"
@@ -234,6 +235,35 @@ TEST(UTMatrix, Poly_mult_square_matrix_caps) {
     RUN_ALL_POLYS(Poly_mult_square_matrix_caps, "Poly_mult_square_matrix_caps")
 }
 
+// Checks the tower-by-tower product of DCRTPoly matrices against element-wise
+// products, including the single-output shape used by GaussSampOnline
+TEST(UTMatrix, DCRTPoly_mult) {
+    auto params       = std::make_shared<ILDCRTParams<BigInteger>>(16, 3, 30);
+    auto zeroAlloc    = DCRTPoly::Allocator(params, Format::EVALUATION);
+    auto uniformAlloc = DCRTPoly::MakeDiscreteUniformAllocator(params, Format::EVALUATION);
+
+    Matrix<DCRTPoly> A(zeroAlloc, 3, 4, uniformAlloc);
+    Matrix<DCRTPoly> B(zeroAlloc, 4, 2, uniformAlloc);
+
+    for (auto& dims : std::vector<std::pair<size_t, size_t>>{{3, 2}, {1, 1}}) {
+        Matrix<DCRTPoly> a = A.ExtractRows(0, dims.first - 1);
+        Matrix<DCRTPoly> b(zeroAlloc, 4, dims.second);
+        for (size_t i = 0; i < 4; ++i)
+            for (size_t j = 0; j < dims.second; ++j)
+                b(i, j) = B(i, j);
+
+        Matrix<DCRTPoly> c = a * b;
+        for (size_t i = 0; i < dims.first; ++i) {
+            for (size_t j = 0; j < dims.second; ++j) {
+                DCRTPoly expected = zeroAlloc();
+                for (size_t k = 0; k < 4; ++k)
+                    expected += a(i, k) * b(k, j);
+                EXPECT_EQ(expected, c(i, j)) << "at (" << i << ", " << j << ")";
+            }
+        }
+    }
+}
+
 inline void expect_close(double a, double b) {
     EXPECT_LE(fabs(a - b), 10e-8);
 }
@@ -406,3 +436,81 @@ TEST(UTMatrix, cofactorMatrix) {
 
     EXPECT_EQ(r, m.CofactorMatrix());
 }
+
+// Checks the O(d^3) determinants (Bareiss for integers, LU for doubles) on a
+// 5x5 matrix whose leading entry is zero, so both need a row swap
+TEST(UTMatrix, determinant_elimination) {
+    const int64_t values[5][5] = {
+        {0, 2, -1, 3, 1}, {4, 1, 0, -2, 5}, {-3, 2, 6, 1, 0}, {1, -1, 2, 4, -2}, {2, 0, 3, -1, 1}};
+    Matrix<int64_t> m([]() { return 0; }, 5, 5);
+    Matrix<double> md([]() { return 0; }, 5, 5);
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            m(i, j)  = values[i][j];
+            md(i, j) = values[i][j];
+        }
+    }
+
+    int64_t determinant = 0;
+    m.Determinant(&determinant);
+    EXPECT_EQ(464, determinant);
+
+    double determinantDouble = 0;
+    md.Determinant(&determinantDouble);
+    EXPECT_NEAR(464.0, determinantDouble, 1e-9);
+
+    Matrix<double> inverse = md.Inverse();
+    Matrix<double> product = md * inverse;
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            EXPECT_NEAR(i == j ? 1.0 : 0.0, product(i, j), 1e-12) << "at (" << i << ", " << j << ")";
+        }
+    }
+}
+
+// Field2n matrices are products of complex matrices, one per slot. A zero
+// leading entry in one slot is not a unit, so the determinant falls back to
+// the Laplace formula and the (unpivoted) inverse throws
+TEST(UTMatrix, determinant_field2n_zero_pivot) {
+    const double values[2][3][3] = {{{0, 2, -1}, {4, 1, 0}, {-3, 2, 6}}, {{2, 1, 0}, {1, 3, 1}, {0, 1, 4}}};
+    Matrix<Field2n> m([]() { return Field2n(2, Format::EVALUATION, true); }, 3, 3);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            m(i, j).at(0) = values[0][i][j];
+            m(i, j).at(1) = values[1][i][j];
+        }
+    }
+
+    Field2n determinant(2, Format::EVALUATION, true);
+    m.Determinant(&determinant);
+    EXPECT_NEAR(-59.0, determinant.at(0).real(), 1e-9);
+    EXPECT_NEAR(18.0, determinant.at(1).real(), 1e-9);
+    EXPECT_NEAR(0.0, std::abs(determinant.at(0).imag()) + std::abs(determinant.at(1).imag()), 1e-9);
+
+    EXPECT_THROW(m.Inverse(), math_error);
+}
+
+// Checks the tiled multiplication against the definition for dimensions that
+// are not multiples of the tile size
+TEST(UTMatrix, mult_tiled) {
+    Matrix<int64_t> a([]() { return 0; }, 37, 45);
+    Matrix<int64_t> b([]() { return 0; }, 45, 33);
+    for (size_t i = 0; i < a.GetRows(); ++i)
+        for (size_t j = 0; j < a.GetCols(); ++j)
+            a(i, j) = static_cast<int64_t>((i * 7 + j * 3) % 11) - 5;
+    for (size_t i = 0; i < b.GetRows(); ++i)
+        for (size_t j = 0; j < b.GetCols(); ++j)
+            b(i, j) = static_cast<int64_t>((i * 5 + j * 13) % 17) - 8;
+
+    Matrix<int64_t> c = a * b;
+    ASSERT_EQ(37u, c.GetRows());
+    ASSERT_EQ(33u, c.GetCols());
+    for (size_t i = 0; i < c.GetRows(); ++i) {
+        for (size_t j = 0; j < c.GetCols(); ++j) {
+            int64_t expected = 0;
+            for (size_t k = 0; k < a.GetCols(); ++k)
+                expected += a(i, k) * b(k, j);
+            EXPECT_EQ(expected, c(i, j)) << "at (" << i << ", " << j << ")";
+        }
+    }
+}
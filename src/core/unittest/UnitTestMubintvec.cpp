@@ -688,3 +688,30 @@ TEST(UTmubintvec, basic_vector_vector_mod_math_big_numbers) {
     d3 *= b3;
     EXPECT_EQ(d3, modmul3) << "Failure big number vector vector *=";
 }
+
+// Checks that a native vector made over an external buffer uses the buffer in
+// place, keeps it alive while it is used, and that copies get their own storage
+TEST(UTmubintvec, native_vector_over_buffer) {
+    auto buffer = std::make_shared<std::vector<NativeInteger>>(std::vector<NativeInteger>{1, 2, 3, 4});
+    NativeInteger* data                            = buffer->data();
+    std::weak_ptr<std::vector<NativeInteger>> alive = buffer;
+    {
+        NativeVector view(data, 4, NativeInteger(17), buffer);
+        buffer.reset();
+        EXPECT_FALSE(alive.expired()) << "the vector does not keep its buffer alive";
+        EXPECT_EQ(&view[0], data) << "the vector does not use the buffer in place";
+        EXPECT_EQ(view[3], NativeInteger(4)) << "the vector does not keep the values of the buffer";
+
+        NativeVector moved(std::move(view));
+        EXPECT_EQ(&moved[0], data) << "a moved vector does not use the buffer";
+
+        NativeVector copy(moved);
+        EXPECT_NE(&copy[0], data) << "a copy uses the buffer";
+        EXPECT_EQ(copy, moved) << "a copy does not have the values of the buffer";
+
+        moved.ModAddEq(NativeInteger(15));
+        EXPECT_EQ(data[0], NativeInteger(16)) << "the vector is not modified in place";
+        EXPECT_EQ(copy[0], NativeInteger(1)) << "modifying the vector changes its copy";
+    }
+    EXPECT_TRUE(alive.expired()) << "the buffer outlives the vectors using it";
+}
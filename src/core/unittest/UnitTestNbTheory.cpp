@@ -396,3 +396,17 @@ void test_nextQ(const std::string& msg) {
 TEST(UTNbTheory, test_nextQ) {
     RUN_ALL_BACKENDS_INT(test_nextQ, "test_nextQ")
 }
+
+TEST(UTNbTheory, method_get_auto_map) {
+    uint32_t n = 1024;
+    for (uint32_t k : {3u, 5u, 2 * n - 1}) {
+        std::vector<uint32_t> expected(n);
+        PrecomputeAutoMap(n, k, &expected);
+
+        const std::vector<uint32_t>& cached = GetAutoMap(n, k);
+        EXPECT_EQ(cached, expected) << "GetAutoMap differs from PrecomputeAutoMap for k = " << k;
+        EXPECT_EQ(&GetAutoMap(n, k), &cached) << "GetAutoMap did not reuse the cached map for k = " << k;
+        EXPECT_EQ(&GetAutoMap(n, k + 2 * n), &cached) << "GetAutoMap did not reduce k = " << k << " mod 2n";
+    }
+    EXPECT_NE(&GetAutoMap(n, 3), &GetAutoMap(2 * n, 3)) << "GetAutoMap shares maps across ring dimensions";
+}
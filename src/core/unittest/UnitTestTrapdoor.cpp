@@ -442,7 +442,7 @@ TEST(UTTrapdoor, TrapDoorGaussGqSampTestBase1024) {
     // TODO my guess is there is a race in the calculation/caching of factors
     // underneath, though the critical
     // TODO region *should* address that...
-    auto mmm = z.GetData()[0][0];
+    auto mmm = z.GetRow(0)[0];
     mmm.SwitchFormat();
 
     z.SwitchFormat();
@@ -529,6 +529,57 @@ TEST(UTTrapdoor, TrapDoorGaussSampTest) {
     // std::cout << z << std::endl;
 }
 
+TEST(UTTrapdoor, TrapDoorGaussSampPerturbationPoolTest) {
+    usint m = 16;
+    usint n = m / 2;
+
+    BigInteger modulus("67108913");
+    BigInteger rootOfUnity("61564");
+    double sigma = SIGMA;
+
+    double val    = modulus.ConvertToDouble();
+    double logTwo = log(val - 1.0) / log(2) + 1.0;
+    usint k       = (usint)floor(logTwo);
+
+    auto params = std::make_shared<ILParams>(m, modulus, rootOfUnity);
+
+    std::pair<Matrix<Poly>, RLWETrapdoorPair<Poly>> trapPair = RLWETrapdoorUtility<Poly>::TrapdoorGen(params, sigma);
+
+    Poly::DggType dgg(sigma);
+    Poly::DugType dug = Poly::DugType();
+    dug.SetModulus(modulus);
+
+    uint32_t base = 2;
+    double c      = (base + 1) * SIGMA;
+    double s      = SPECTRAL_BOUND(n, k, base);
+    Poly::DggType dggLargeSigma(sqrt(s * s - c * c));
+
+    EXPECT_THROW(PerturbationPool<Poly>(n, k, trapPair.second, dgg, dggLargeSigma, base, 4, 5), config_error)
+        << "Failure testing a refill watermark above the depth";
+
+    const size_t numSamples = 10;
+    PerturbationPool<Poly> pool(n, k, trapPair.second, dgg, dggLargeSigma, base, 4, 2, 2);
+    for (size_t i = 0; i < numSamples; i++) {
+        Poly u(dug, params, Format::COEFFICIENT);
+        u.SwitchFormat();
+
+        Matrix<Poly> z = pool.GaussSamp(trapPair.first, u, dgg);
+        EXPECT_EQ(trapPair.first.GetCols(), z.GetRows()) << "Failure testing number of rows";
+
+        Poly uEst = (trapPair.first * z)(0, 0);
+        uEst.SwitchFormat();
+        u.SwitchFormat();
+        EXPECT_EQ(u, uEst) << "Failure testing the pre-image for sample " << i;
+    }
+
+    pool.Stop();
+    PerturbationPoolStats stats = pool.GetStats();
+    EXPECT_EQ(numSamples, stats.consumed) << "Failure testing the number of consumed perturbations";
+    EXPECT_LE(stats.size, 4u) << "Failure testing the pool depth";
+    EXPECT_EQ(stats.produced + stats.misses, stats.consumed + stats.size)
+        << "Failure testing that every perturbation is handed out once";
+}
+
 // Test of Gaussian Sampling for matrices from 2x2 to 5x5
 TEST(UTTrapdoor, TrapDoorGaussSampTestSquareMatrices) {
     OPENFHE_DEBUG_FLAG(false);
@@ -37,6 +37,8 @@
 #include <iostream>
 #include "include/gtest/gtest.h"
 
+#include "utils/exception.h"
+#include "utils/parallel.h"
 #include "utils/utilities.h"
 
 using namespace lbcrypto;
@@ -53,3 +55,23 @@ TEST(Utilities, IsPowerOfTwo) {
         EXPECT_FALSE(IsPowerOfTwo(not_power_of_two));
     }
 }
+
+TEST(Utilities, NumaTopology) {
+    int nodes = ParallelControls::GetNumaNodes();
+    ASSERT_GE(nodes, 1);
+    for (int node = 0; node < nodes; node++)
+        EXPECT_FALSE(ParallelControls::GetNumaNodeCpus(node).empty()) << "NUMA node " << node << " has no CPUs";
+    EXPECT_THROW(ParallelControls::GetNumaNodeCpus(nodes), config_error);
+
+    int current = ParallelControls::GetCurrentNumaNode();
+    EXPECT_GE(current, 0);
+    EXPECT_LT(current, nodes);
+
+#if defined(__linux__)
+    ParallelControls controls;
+    for (auto placement : {THREAD_PLACEMENT_COMPACT, THREAD_PLACEMENT_SCATTER, THREAD_PLACEMENT_NONE}) {
+        EXPECT_NO_THROW(controls.SetThreadPlacement(placement));
+        EXPECT_EQ(controls.GetThreadPlacement(), placement);
+    }
+#endif
+}
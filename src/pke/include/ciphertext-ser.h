@@ -37,8 +37,15 @@
 #define LBCRYPTO_CRYPTO_CIPHERTEXTSER_H
 
 #include "ciphertext.h"
+#include "cryptocontext.h"
 #include "utils/serial.h"
 
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
 extern template class lbcrypto::CiphertextImpl<lbcrypto::Poly>;
 extern template class lbcrypto::CiphertextImpl<lbcrypto::NativePoly>;
 extern template class lbcrypto::CiphertextImpl<lbcrypto::DCRTPoly>;
@@ -50,4 +57,193 @@ CEREAL_CLASS_VERSION(lbcrypto::CiphertextImpl<lbcrypto::NativePoly>,
 CEREAL_CLASS_VERSION(lbcrypto::CiphertextImpl<lbcrypto::DCRTPoly>,
                      lbcrypto::CiphertextImpl<lbcrypto::DCRTPoly>::SerializedVersion());
 
+namespace lbcrypto {
+
+namespace Serial {
+
+// ================================= raw ciphertext format
+/**
+ * The raw format stores a DCRTPoly ciphertext as a fixed-size header followed by the key tag and the
+ * residues of all towers of all its elements, each tower written as one contiguous buffer of native
+ * words. Nothing is encoded per coefficient, and on deserialization every tower is read directly
+ * into freshly allocated polynomial storage.
+ *
+ * Unlike the cereal formats, the raw format does not carry the crypto context or the element
+ * parameters: they are taken from the context passed to DeserializeRaw() and shared with it. The
+ * header holds a hash of the ring dimension and the moduli of the towers, so a ciphertext is only
+ * accepted by a context it is compatible with. The data is written in the byte order of the host,
+ * and metadata attached to the ciphertext is not supported.
+ */
+constexpr uint32_t RAW_CIPHERTEXT_MAGIC   = 0x4f464843;  // "OFHC"
+constexpr uint32_t RAW_CIPHERTEXT_VERSION = 1;
+// bounds on the header fields that size allocations
+constexpr uint64_t RAW_CIPHERTEXT_MAX_KEY_TAG_SIZE = 1024;
+constexpr uint32_t RAW_CIPHERTEXT_MAX_ELEMENTS     = 1024;
+
+struct RawCiphertextHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nativeIntSize;
+    uint32_t ringDim;
+    uint32_t numElements;
+    uint32_t numTowers;
+    uint64_t paramsHash;
+    uint32_t format;
+    uint32_t encodingType;
+    uint32_t depth;
+    uint32_t level;
+    uint32_t hopLevel;
+    uint32_t slots;
+    double scalingFactor;
+    uint64_t scalingFactorInt;
+    uint64_t keyTagSize;
+};
+
+// FNV-1a over the ring dimension and the first numTowers moduli of the parameters
+inline uint64_t RawParamsHash(const std::shared_ptr<DCRTPoly::Params>& params, size_t numTowers) {
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix      = [&hash](uint64_t value) {
+        for (size_t i = 0; i < sizeof(value); i++) {
+            hash ^= (value >> (8 * i)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    };
+    mix(params->GetRingDimension());
+    for (size_t i = 0; i < numTowers; i++)
+        mix(params->GetParams()[i]->GetModulus().ConvertToInt());
+    return hash;
+}
+
+/**
+ * Writes a ciphertext in the raw format
+ *
+ * @param ciphertext - the ciphertext to serialize
+ * @param stream - where the ciphertext is written to
+ */
+inline void SerializeRaw(ConstCiphertext<DCRTPoly> ciphertext, std::ostream& stream) {
+    if (!ciphertext->GetMetadataMap()->empty())
+        OPENFHE_THROW(serialize_error, "The raw ciphertext format does not support metadata");
+
+    const std::vector<DCRTPoly>& elements = ciphertext->GetElements();
+    if (elements.empty())
+        OPENFHE_THROW(serialize_error, "Cannot serialize a ciphertext without elements");
+
+    if (elements.size() > RAW_CIPHERTEXT_MAX_ELEMENTS)
+        OPENFHE_THROW(serialize_error, "The raw ciphertext format supports at most " +
+                                           std::to_string(RAW_CIPHERTEXT_MAX_ELEMENTS) + " elements");
+
+    const std::string& keyTag = ciphertext->GetKeyTag();
+    if (keyTag.size() > RAW_CIPHERTEXT_MAX_KEY_TAG_SIZE)
+        OPENFHE_THROW(serialize_error, "The key tag is too long for the raw ciphertext format");
+
+    const auto params = elements[0].GetParams();
+
+    RawCiphertextHeader header;
+    header.magic            = RAW_CIPHERTEXT_MAGIC;
+    header.version          = RAW_CIPHERTEXT_VERSION;
+    header.nativeIntSize    = sizeof(NativeInteger);
+    header.ringDim          = elements[0].GetRingDimension();
+    header.numElements      = elements.size();
+    header.numTowers        = elements[0].GetNumOfElements();
+    header.paramsHash       = RawParamsHash(params, header.numTowers);
+    header.format           = elements[0].GetFormat();
+    header.encodingType     = ciphertext->GetEncodingType();
+    header.depth            = ciphertext->GetDepth();
+    header.level            = ciphertext->GetLevel();
+    header.hopLevel         = ciphertext->GetHopLevel();
+    header.slots            = ciphertext->GetSlots();
+    header.scalingFactor    = ciphertext->GetScalingFactor();
+    header.scalingFactorInt = static_cast<uint64_t>(ciphertext->GetScalingFactorInt().ConvertToInt());
+    header.keyTagSize       = keyTag.size();
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(keyTag.data(), keyTag.size());
+
+    const size_t towerBytes = header.ringDim * sizeof(NativeInteger);
+    for (const auto& element : elements) {
+        if (element.GetNumOfElements() != header.numTowers || element.GetFormat() != elements[0].GetFormat())
+            OPENFHE_THROW(serialize_error, "All ciphertext elements must have the same towers and format");
+        for (const auto& tower : element.GetAllElements())
+            stream.write(reinterpret_cast<const char*>(&tower.GetValues()[0]), towerBytes);
+    }
+
+    if (!stream)
+        OPENFHE_THROW(serialize_error, "Failed to write the raw ciphertext");
+}
+
+/**
+ * Reads a ciphertext written by SerializeRaw(). The element parameters are those of the crypto
+ * context, or a truncation of them for ciphertexts at a higher level, and are shared by all
+ * elements of the ciphertext.
+ *
+ * @param ciphertext - the target for the deserialization
+ * @param stream - where the ciphertext is coming from
+ * @param cc - the crypto context the ciphertext belongs to
+ */
+inline void DeserializeRaw(Ciphertext<DCRTPoly>& ciphertext, std::istream& stream, const CryptoContext<DCRTPoly>& cc) {
+    RawCiphertextHeader header;
+    if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        OPENFHE_THROW(deserialize_error, "Failed to read the raw ciphertext header");
+    if (header.magic != RAW_CIPHERTEXT_MAGIC)
+        OPENFHE_THROW(deserialize_error, "Not a raw ciphertext");
+    if (header.version > RAW_CIPHERTEXT_VERSION)
+        OPENFHE_THROW(deserialize_error, "raw ciphertext version " + std::to_string(header.version) +
+                                             " is from a later version of the library");
+    if (header.nativeIntSize != sizeof(NativeInteger))
+        OPENFHE_THROW(deserialize_error, "The raw ciphertext was written with a different native integer size");
+    if (header.numElements == 0 || header.numElements > RAW_CIPHERTEXT_MAX_ELEMENTS)
+        OPENFHE_THROW(deserialize_error, "Invalid number of raw ciphertext elements: " +
+                                             std::to_string(header.numElements));
+    if (header.keyTagSize > RAW_CIPHERTEXT_MAX_KEY_TAG_SIZE)
+        OPENFHE_THROW(deserialize_error, "Invalid raw ciphertext key tag size: " + std::to_string(header.keyTagSize));
+    if (header.format != EVALUATION && header.format != COEFFICIENT)
+        OPENFHE_THROW(deserialize_error, "Invalid raw ciphertext format: " + std::to_string(header.format));
+
+    auto params = cc->GetElementParams();
+    if (header.numTowers == 0 || header.numTowers > params->GetParams().size() ||
+        header.ringDim != params->GetRingDimension() || header.paramsHash != RawParamsHash(params, header.numTowers))
+        OPENFHE_THROW(deserialize_error, "The raw ciphertext does not match the parameters of the crypto context");
+
+    if (header.numTowers < params->GetParams().size()) {
+        auto paramsLevel = std::make_shared<DCRTPoly::Params>(*params);
+        while (paramsLevel->GetParams().size() > header.numTowers)
+            paramsLevel->PopLastParam();
+        params = paramsLevel;
+    }
+
+    std::string keyTag(header.keyTagSize, '\0');
+    if (!stream.read(&keyTag[0], header.keyTagSize))
+        OPENFHE_THROW(deserialize_error, "The raw ciphertext is truncated");
+
+    Format format           = static_cast<Format>(header.format);
+    const size_t towerBytes = header.ringDim * sizeof(NativeInteger);
+
+    std::vector<DCRTPoly> elements;
+    elements.reserve(header.numElements);
+    for (size_t i = 0; i < header.numElements; i++) {
+        DCRTPoly element(params, format, false);
+        for (size_t j = 0; j < header.numTowers; j++) {
+            NativePoly tower(params->GetParams()[j], format, true);
+            if (!stream.read(reinterpret_cast<char*>(&tower[0]), towerBytes))
+                OPENFHE_THROW(deserialize_error, "The raw ciphertext is truncated");
+            element.SetElementAtIndex(j, std::move(tower));
+        }
+        elements.push_back(std::move(element));
+    }
+
+    ciphertext = std::make_shared<CiphertextImpl<DCRTPoly>>(cc, keyTag,
+                                                            static_cast<PlaintextEncodings>(header.encodingType));
+    ciphertext->SetElements(std::move(elements));
+    ciphertext->SetDepth(header.depth);
+    ciphertext->SetLevel(header.level);
+    ciphertext->SetHopLevel(header.hopLevel);
+    ciphertext->SetSlots(header.slots);
+    ciphertext->SetScalingFactor(header.scalingFactor);
+    ciphertext->SetScalingFactorInt(NativeInteger(header.scalingFactorInt));
+}
+
+}  // namespace Serial
+
+}  // namespace lbcrypto
+
 #endif
@@ -37,11 +37,19 @@
 #define LBCRYPTO_CRYPTO_CRYPTOCONTEXTSER_H
 
 #include "cryptocontext.h"
+#include "globals.h"
+#include "schemerns/rns-cryptoparameters.h"
 
 #include "utils/serial.h"
 
+#include <algorithm>
+#include <exception>
+#include <istream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <sstream>
+#include <streambuf>
 #include <string>
 #include <vector>
 
@@ -56,16 +64,17 @@ namespace lbcrypto {
 template <typename Element>
 template <typename ST>
 bool CryptoContextImpl<Element>::SerializeEvalMultKey(std::ostream& ser, const ST& sertype, std::string id) {
-    std::map<std::string, std::vector<EvalKey<Element>>>* smap;
+    auto allKeys = GetAllEvalMultKeysPtr();
+    const std::map<std::string, std::vector<EvalKey<Element>>>* smap;
     std::map<std::string, std::vector<EvalKey<Element>>> omap;
 
     if (id.length() == 0) {
-        smap = &GetAllEvalMultKeys();
+        smap = allKeys.get();
     }
     else {
-        const auto k = GetAllEvalMultKeys().find(id);
+        const auto k = allKeys->find(id);
 
-        if (k == GetAllEvalMultKeys().end())
+        if (k == allKeys->end())
             return false;  // no such id
 
         smap           = &omap;
@@ -76,6 +85,293 @@ bool CryptoContextImpl<Element>::SerializeEvalMultKey(std::ostream& ser, const S
     return true;
 }
 
+// ================================= chunked EvalKey files
+namespace Serial {
+/**
+ * A chunked EvalKey file stores every key as a separate serialization (a chunk) and starts with an
+ * index holding the key tag, the key index (automorphism index or position in the EvalMult key
+ * vector), the offset and the size of every chunk. The chunks are independent of each other, so
+ * they are encoded and decoded in parallel.
+ */
+constexpr uint32_t CHUNKED_EVALKEY_MAGIC   = 0x4f46454b;  // "OFEK"
+constexpr uint32_t CHUNKED_EVALKEY_VERSION = 1;
+// bound on the key tag sizes in the index
+constexpr uint64_t CHUNKED_EVALKEY_MAX_KEY_TAG_SIZE = 1024;
+
+template <typename Element>
+struct EvalKeyChunk {
+    std::string keyTag;
+    uint32_t index;
+    EvalKey<Element> key;
+};
+
+/**
+ * Writes the index and the chunks of a chunked EvalKey file
+ *
+ * @param chunks - the keys to serialize
+ * @param stream - where the keys are written to
+ * @param sertype - type of serialization used for the chunks
+ */
+template <typename Element, typename ST>
+void SerializeEvalKeyChunks(const std::vector<EvalKeyChunk<Element>>& chunks, std::ostream& stream,
+                            const ST& sertype) {
+    std::vector<std::string> data(chunks.size());
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < chunks.size(); i++) {
+        std::ostringstream chunk;
+        Serial::Serialize(chunks[i].key, chunk, sertype);
+        data[i] = chunk.str();
+    }
+
+    auto write = [&stream](uint64_t value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    write(CHUNKED_EVALKEY_MAGIC);
+    write(CHUNKED_EVALKEY_VERSION);
+    write(chunks.size());
+    uint64_t offset = 0;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        write(chunks[i].keyTag.size());
+        stream.write(chunks[i].keyTag.data(), chunks[i].keyTag.size());
+        write(chunks[i].index);
+        write(offset);
+        write(data[i].size());
+        offset += data[i].size();
+    }
+    for (const auto& chunk : data)
+        stream.write(chunk.data(), chunk.size());
+
+    if (!stream)
+        OPENFHE_THROW(serialize_error, "Failed to write the chunked EvalKey file");
+}
+
+/**
+ * Read-only stream buffer over a range of an existing buffer, so that a chunk is decoded in place
+ */
+class ChunkStreamBuf : public std::streambuf {
+public:
+    ChunkStreamBuf(const char* data, size_t size) {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+};
+
+/**
+ * Reads the index and the chunks of a chunked EvalKey file and decodes the chunks in parallel.
+ * The first chunk of every key tag is decoded serially, which creates the crypto contexts of the
+ * keys; the other chunks are decoded without precomputing CRT tables, since their contexts are
+ * replaced with the ones already created. The index entries and the chunk data are read as they
+ * come, so a corrupted count or size fails on a short read instead of a huge allocation.
+ *
+ * @param stream - where the keys are coming from
+ * @param sertype - type of serialization used for the chunks
+ * @return the deserialized keys
+ */
+template <typename Element, typename ST>
+std::vector<EvalKeyChunk<Element>> DeserializeEvalKeyChunks(std::istream& stream, const ST& sertype) {
+    auto read = [&stream]() {
+        uint64_t value = 0;
+        if (!stream.read(reinterpret_cast<char*>(&value), sizeof(value)))
+            OPENFHE_THROW(deserialize_error, "The chunked EvalKey file is truncated");
+        return value;
+    };
+
+    if (read() != CHUNKED_EVALKEY_MAGIC)
+        OPENFHE_THROW(deserialize_error, "Not a chunked EvalKey file");
+    uint64_t version = read();
+    if (version > CHUNKED_EVALKEY_VERSION)
+        OPENFHE_THROW(deserialize_error, "chunked EvalKey file version " + std::to_string(version) +
+                                             " is from a later version of the library");
+
+    const uint64_t numChunks = read();
+    std::vector<EvalKeyChunk<Element>> chunks;
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> sizes;
+    uint64_t total = 0;
+    for (uint64_t i = 0; i < numChunks; i++) {
+        EvalKeyChunk<Element> chunk;
+        uint64_t keyTagSize = read();
+        if (keyTagSize > CHUNKED_EVALKEY_MAX_KEY_TAG_SIZE)
+            OPENFHE_THROW(deserialize_error, "Invalid key tag size in the chunked EvalKey file");
+        chunk.keyTag.resize(keyTagSize);
+        if (!stream.read(&chunk.keyTag[0], keyTagSize))
+            OPENFHE_THROW(deserialize_error, "The chunked EvalKey file is truncated");
+        uint64_t index = read();
+        if (index > std::numeric_limits<uint32_t>::max())
+            OPENFHE_THROW(deserialize_error, "Invalid key index in the chunked EvalKey file");
+        chunk.index     = index;
+        uint64_t offset = read();
+        uint64_t size   = read();
+        if (size > std::numeric_limits<uint64_t>::max() - offset)
+            OPENFHE_THROW(deserialize_error, "Invalid chunk size in the chunked EvalKey file");
+        total = std::max(total, offset + size);
+        chunks.push_back(std::move(chunk));
+        offsets.push_back(offset);
+        sizes.push_back(size);
+    }
+
+    // read in blocks so that the buffer only grows with the data actually present
+    constexpr uint64_t blockSize = 1 << 24;
+    std::string data;
+    while (data.size() < total) {
+        size_t done = data.size();
+        size_t size = std::min(blockSize, total - done);
+        data.resize(done + size);
+        if (!stream.read(&data[done], size))
+            OPENFHE_THROW(deserialize_error, "The chunked EvalKey file is truncated");
+    }
+
+    auto decode = [&](size_t i) {
+        ChunkStreamBuf buffer(data.data() + offsets[i], sizes[i]);
+        std::istream chunk(&buffer);
+        Serial::Deserialize(chunks[i].key, chunk, sertype);
+        if (!chunks[i].key)
+            OPENFHE_THROW(deserialize_error, "Failed to deserialize EvalKey chunk " + std::to_string(i));
+    };
+
+    std::map<std::string, size_t> firstChunks;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        if (firstChunks.emplace(chunks[i].keyTag, i).second)
+            decode(i);
+    }
+
+    std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < chunks.size(); i++) {
+        if (firstChunks.at(chunks[i].keyTag) == i)
+            continue;
+        try {
+            PrecomputeCRTTablesScope noPrecompute(false);
+            decode(i);
+        }
+        catch (...) {
+#pragma omp critical
+            error = std::current_exception();
+        }
+    }
+    if (error)
+        std::rethrow_exception(error);
+
+    return chunks;
+}
+
+template <typename Element>
+std::vector<EvalKeyChunk<Element>> EvalKeyMapToChunks(
+    const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>& keyMap, const std::string& id) {
+    std::vector<EvalKeyChunk<Element>> chunks;
+    for (const auto& k : keyMap) {
+        if (id.length() != 0 && k.first != id)
+            continue;
+        for (const auto& key : *k.second)
+            chunks.push_back({k.first, key.first, key.second});
+    }
+    return chunks;
+}
+
+template <typename Element>
+std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> ChunksToEvalKeyMap(
+    std::vector<EvalKeyChunk<Element>>&& chunks) {
+    std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> keyMap;
+    for (auto& chunk : chunks) {
+        auto& keys = keyMap[chunk.keyTag];
+        if (!keys)
+            keys = std::make_shared<std::map<usint, EvalKey<Element>>>();
+        (*keys)[chunk.index] = std::move(chunk.key);
+    }
+    return keyMap;
+}
+}  // namespace Serial
+
+template <typename Element>
+template <typename ST>
+bool CryptoContextImpl<Element>::SerializeEvalMultKeyChunked(std::ostream& ser, const ST& sertype, std::string id) {
+    auto allKeys = GetAllEvalMultKeysPtr();
+    std::vector<Serial::EvalKeyChunk<Element>> chunks;
+    for (const auto& k : *allKeys) {
+        if (id.length() != 0 && k.first != id)
+            continue;
+        for (size_t i = 0; i < k.second.size(); i++)
+            chunks.push_back({k.first, static_cast<uint32_t>(i), k.second[i]});
+    }
+    if (id.length() != 0 && chunks.empty())
+        return false;  // no such id
+
+    Serial::SerializeEvalKeyChunks(chunks, ser, sertype);
+    return true;
+}
+
+template <typename Element>
+template <typename ST>
+bool CryptoContextImpl<Element>::DeserializeEvalMultKeyChunked(std::istream& ser, const ST& sertype) {
+    auto chunks = Serial::DeserializeEvalKeyChunks<Element>(ser, sertype);
+
+    std::map<std::string, std::vector<EvalKey<Element>>> evalMultKeyMap;
+    for (auto& chunk : chunks) {
+        if (chunk.index >= chunks.size())
+            OPENFHE_THROW(deserialize_error, "Invalid EvalMult key index in the chunked EvalKey file");
+        auto& keys = evalMultKeyMap[chunk.keyTag];
+        if (keys.size() <= chunk.index)
+            keys.resize(chunk.index + 1);
+        keys[chunk.index] = std::move(chunk.key);
+    }
+
+    for (auto& k : evalMultKeyMap) {
+        GetEvalKeyRegistry(k.second[0]).Modify([&](auto& keys) { keys.mult[k.first] = std::move(k.second); });
+    }
+    return true;
+}
+
+template <typename Element>
+template <typename ST>
+bool CryptoContextImpl<Element>::SerializeEvalSumKeyChunked(std::ostream& ser, const ST& sertype, std::string id) {
+    auto chunks = Serial::EvalKeyMapToChunks(*GetAllEvalSumKeysPtr(), id);
+    if (id.length() != 0 && chunks.empty())
+        return false;  // no such id
+
+    Serial::SerializeEvalKeyChunks(chunks, ser, sertype);
+    return true;
+}
+
+template <typename Element>
+template <typename ST>
+bool CryptoContextImpl<Element>::DeserializeEvalSumKeyChunked(std::istream& ser, const ST& sertype) {
+    auto evalSumKeyMap = Serial::ChunksToEvalKeyMap(Serial::DeserializeEvalKeyChunks<Element>(ser, sertype));
+    for (auto& k : evalSumKeyMap) {
+        if (!k.second->empty())
+            GetEvalKeyRegistry(k.second->begin()->second).Modify([&](auto& keys) {
+                keys.sum[k.first] = std::move(k.second);
+            });
+    }
+    return true;
+}
+
+template <typename Element>
+template <typename ST>
+bool CryptoContextImpl<Element>::SerializeEvalAutomorphismKeyChunked(std::ostream& ser, const ST& sertype,
+                                                                     std::string id) {
+    auto chunks = Serial::EvalKeyMapToChunks(*GetAllEvalAutomorphismKeysPtr(), id);
+    if (id.length() != 0 && chunks.empty())
+        return false;  // no such id
+
+    Serial::SerializeEvalKeyChunks(chunks, ser, sertype);
+    return true;
+}
+
+template <typename Element>
+template <typename ST>
+bool CryptoContextImpl<Element>::DeserializeEvalAutomorphismKeyChunked(std::istream& ser, const ST& sertype) {
+    auto evalAutomorphismKeyMap =
+        Serial::ChunksToEvalKeyMap(Serial::DeserializeEvalKeyChunks<Element>(ser, sertype));
+    for (auto& k : evalAutomorphismKeyMap) {
+        if (!k.second->empty())
+            GetEvalKeyRegistry(k.second->begin()->second).Modify([&](auto& keys) {
+                keys.automorphism[k.first] = std::move(k.second);
+            });
+    }
+    return true;
+}
+
 }  // namespace lbcrypto
 
 namespace lbcrypto {
@@ -153,6 +449,20 @@ template bool CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKey<SerType:
     std::ostream& ser, const SerType::SERJSON&, const CryptoContext<DCRTPoly> cc);
 template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKey<SerType::SERJSON>(std::istream& ser,
                                                                                             const SerType::SERJSON&);
+template bool CryptoContextImpl<DCRTPoly>::SerializeEvalMultKeyChunked<SerType::SERJSON>(std::ostream& ser,
+                                                                                         const SerType::SERJSON&,
+                                                                                         std::string id);
+template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKeyChunked<SerType::SERJSON>(std::istream& ser,
+                                                                                           const SerType::SERJSON&);
+template bool CryptoContextImpl<DCRTPoly>::SerializeEvalSumKeyChunked<SerType::SERJSON>(std::ostream& ser,
+                                                                                        const SerType::SERJSON&,
+                                                                                        std::string id);
+template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalSumKeyChunked<SerType::SERJSON>(std::istream& ser,
+                                                                                          const SerType::SERJSON&);
+template bool CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKeyChunked<SerType::SERJSON>(
+    std::ostream& ser, const SerType::SERJSON&, std::string id);
+template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKeyChunked<SerType::SERJSON>(
+    std::istream& ser, const SerType::SERJSON&);
 
 // ================================= BINARY serialization/deserialization
 namespace Serial {
@@ -202,6 +512,181 @@ bool DeserializeFromFile(const std::string& filename, CryptoContext<T>& obj, con
     }
     return false;
 }
+
+// ================================= context snapshots
+/**
+ * A context snapshot is a binary image of a fully precomputed crypto context: the context itself,
+ * the CRT tables of its RNS crypto parameters and the NTT tables of all its moduli. Restoring a
+ * context from a snapshot skips both parameter generation (prime search) and all precomputations,
+ * and yields tables bit-identical to the ones of the original context.
+ *
+ * The payload is preceded by a header holding a magic string, the snapshot format version, the
+ * native integer size and a checksum of the payload, so that snapshots written by an incompatible
+ * build or damaged on disk are rejected with a deserialize_error.
+ */
+constexpr const char* CONTEXT_SNAPSHOT_MAGIC = "OpenFHE context snapshot";
+constexpr uint32_t CONTEXT_SNAPSHOT_VERSION  = 1;
+
+// FNV-1a; the checksum only guards against truncated or damaged files
+inline uint64_t ContextSnapshotChecksum(const std::string& data) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Serializes the NTT tables of all moduli used with the given ring dimension
+ */
+template <class Archive>
+void SaveNTTTables(Archive& ar, usint ringDim) {
+    using FTT = ChineseRemainderTransformFTT<NativeVector>;
+
+    std::vector<NativeInteger> moduli;
+    for (const auto& table : FTT::m_rootOfUnityReverseTableByModulus) {
+        if (table.second.GetLength() == ringDim)
+            moduli.push_back(table.first);
+    }
+
+    ar(static_cast<uint64_t>(moduli.size()));
+    for (const auto& q : moduli) {
+        ar(q, FTT::m_rootOfUnityReverseTableByModulus[q], FTT::m_rootOfUnityInverseReverseTableByModulus[q],
+           FTT::m_rootOfUnityPreconReverseTableByModulus[q], FTT::m_rootOfUnityInversePreconReverseTableByModulus[q],
+           FTT::m_cycloOrderInverseTableByModulus[q], FTT::m_cycloOrderInversePreconTableByModulus[q]);
+    }
+}
+
+/**
+ * Restores NTT tables written by SaveNTTTables(); tables already present are kept
+ */
+template <class Archive>
+void LoadNTTTables(Archive& ar) {
+    using FTT = ChineseRemainderTransformFTT<NativeVector>;
+
+    uint64_t size;
+    ar(size);
+    for (uint64_t i = 0; i < size; i++) {
+        NativeInteger q;
+        NativeVector table, tableI, precon, preconI, cycloOrderInv, cycloOrderInvPrecon;
+        ar(q, table, tableI, precon, preconI, cycloOrderInv, cycloOrderInvPrecon);
+#pragma omp critical
+        {
+            auto it = FTT::m_rootOfUnityReverseTableByModulus.find(q);
+            if (it == FTT::m_rootOfUnityReverseTableByModulus.end() || it->second.GetLength() != table.GetLength()) {
+                FTT::m_rootOfUnityReverseTableByModulus[q]              = std::move(table);
+                FTT::m_rootOfUnityInverseReverseTableByModulus[q]       = std::move(tableI);
+                FTT::m_rootOfUnityPreconReverseTableByModulus[q]        = std::move(precon);
+                FTT::m_rootOfUnityInversePreconReverseTableByModulus[q] = std::move(preconI);
+                FTT::m_cycloOrderInverseTableByModulus[q]               = std::move(cycloOrderInv);
+                FTT::m_cycloOrderInversePreconTableByModulus[q]         = std::move(cycloOrderInvPrecon);
+            }
+        }
+    }
+}
+
+/**
+ * Writes a snapshot of a crypto context and all its precomputations
+ *
+ * @param obj - the crypto context (RNS schemes only)
+ * @param stream - where the snapshot is written to
+ */
+template <typename T>
+void SerializeContextSnapshot(const CryptoContext<T>& obj, std::ostream& stream) {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(obj->GetCryptoParameters());
+    if (!cryptoParams)
+        OPENFHE_THROW(config_error, "Context snapshots are only supported for RNS crypto parameters");
+
+    std::stringstream payload;
+    {
+        cereal::PortableBinaryOutputArchive archive(payload);
+        archive(obj);
+        cryptoParams->SavePrecomputations(archive);
+        SaveNTTTables(archive, obj->GetRingDimension());
+    }
+    std::string data = payload.str();
+
+    cereal::PortableBinaryOutputArchive archive(stream);
+    archive(std::string(CONTEXT_SNAPSHOT_MAGIC), CONTEXT_SNAPSHOT_VERSION, static_cast<uint32_t>(NATIVEINT),
+            ContextSnapshotChecksum(data), data);
+}
+
+/**
+ * Restores a crypto context from a snapshot written by SerializeContextSnapshot(). The CRT tables
+ * are restored from the snapshot instead of being recomputed; the global
+ * PrecomputeCRTTablesAfterDeserializaton() flag is left unchanged.
+ *
+ * @param obj - the target for the deserialization
+ * @param stream - where the snapshot is coming from
+ */
+template <typename T>
+void DeserializeContextSnapshot(CryptoContext<T>& obj, std::istream& stream) {
+    std::string magic;
+    uint32_t version   = 0;
+    uint32_t nativeInt = 0;
+    uint64_t checksum  = 0;
+    std::string data;
+    try {
+        cereal::PortableBinaryInputArchive archive(stream);
+        archive(magic);
+        if (magic != CONTEXT_SNAPSHOT_MAGIC)
+            OPENFHE_THROW(deserialize_error, "the stream does not contain a context snapshot");
+        archive(version, nativeInt, checksum);
+        if (version > CONTEXT_SNAPSHOT_VERSION)
+            OPENFHE_THROW(deserialize_error, "context snapshot version " + std::to_string(version) +
+                                                 " is from a later version of the library");
+        if (nativeInt != NATIVEINT)
+            OPENFHE_THROW(deserialize_error, "context snapshot was written with NATIVEINT=" +
+                                                 std::to_string(nativeInt));
+        archive(data);
+    }
+    catch (const openfhe_error&) {
+        throw;
+    }
+    catch (const std::exception& e) {
+        OPENFHE_THROW(deserialize_error, std::string("context snapshot header cannot be read: ") + e.what());
+    }
+    if (ContextSnapshotChecksum(data) != checksum)
+        OPENFHE_THROW(deserialize_error, "context snapshot checksum mismatch");
+
+    CryptoContext<T> newob;
+    try {
+        PrecomputeCRTTablesScope noPrecompute(false);
+        std::istringstream payload(data);
+        cereal::PortableBinaryInputArchive archive(payload);
+        archive(newob);
+        std::dynamic_pointer_cast<CryptoParametersRNS>(newob->GetCryptoParameters())->LoadPrecomputations(archive);
+        LoadNTTTables(archive);
+    }
+    catch (const std::exception& e) {
+        OPENFHE_THROW(deserialize_error, std::string("context snapshot cannot be deserialized: ") + e.what());
+    }
+
+    obj = CryptoContextFactory<T>::GetContext(newob->GetCryptoParameters(), newob->GetScheme(), newob->getSchemeId());
+}
+
+template <typename T>
+bool SerializeContextSnapshotToFile(const std::string& filename, const CryptoContext<T>& obj) {
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    if (file.is_open()) {
+        Serial::SerializeContextSnapshot(obj, file);
+        file.close();
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+bool DeserializeContextSnapshotFromFile(const std::string& filename, CryptoContext<T>& obj) {
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    if (file.is_open()) {
+        Serial::DeserializeContextSnapshot(obj, file);
+        file.close();
+        return true;
+    }
+    return false;
+}
 }  // namespace Serial
 
 template void Serial::Deserialize(std::shared_ptr<CryptoContextImpl<DCRTPoly>>& obj, std::istream& stream,
@@ -229,6 +714,20 @@ template bool CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKey<SerType:
     std::ostream& ser, const SerType::SERBINARY&, const CryptoContext<DCRTPoly> cc);
 template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKey<SerType::SERBINARY>(
     std::istream& ser, const SerType::SERBINARY&);
+template bool CryptoContextImpl<DCRTPoly>::SerializeEvalMultKeyChunked<SerType::SERBINARY>(std::ostream& ser,
+                                                                                           const SerType::SERBINARY&,
+                                                                                           std::string id);
+template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKeyChunked<SerType::SERBINARY>(std::istream& ser,
+                                                                                             const SerType::SERBINARY&);
+template bool CryptoContextImpl<DCRTPoly>::SerializeEvalSumKeyChunked<SerType::SERBINARY>(std::ostream& ser,
+                                                                                          const SerType::SERBINARY&,
+                                                                                          std::string id);
+template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalSumKeyChunked<SerType::SERBINARY>(std::istream& ser,
+                                                                                            const SerType::SERBINARY&);
+template bool CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKeyChunked<SerType::SERBINARY>(
+    std::ostream& ser, const SerType::SERBINARY&, std::string id);
+template bool CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKeyChunked<SerType::SERBINARY>(
+    std::istream& ser, const SerType::SERBINARY&);
 
 }  // namespace lbcrypto
 
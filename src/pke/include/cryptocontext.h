@@ -43,6 +43,7 @@
 #include "encoding/plaintextfactory.h"
 
 #include "key/evalkey.h"
+#include "key/evalkeyregistry.h"
 #include "key/keypair.h"
 
 #include "schemebase/base-pke.h"
@@ -146,23 +147,28 @@ protected:
     // algorithm used; accesses all crypto methods
     std::shared_ptr<SchemeBase<Element>> scheme;
 
-    static std::map<std::string, std::vector<EvalKey<Element>>>& evalMultKeyMap() {
-        // cached evalmult keys, by secret key UID
-        static std::map<std::string, std::vector<EvalKey<Element>>> s_evalMultKeyMap;
-        return s_evalMultKeyMap;
-    }
+    // cached evalmult, evalsum and evalautomorphism keys of this context, by
+    // secret key UID; copies of a context share the registry
+    std::shared_ptr<EvalKeyRegistry<Element>> m_evalKeyRegistry;
 
-    static std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalSumKeyMap() {
-        // cached evalsum keys, by secret key UID
-        static std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> s_evalSumKeyMap;
-        return s_evalSumKeyMap;
+    /**
+   * Returns the registry of the context a key was generated in
+   */
+    static EvalKeyRegistry<Element>& GetEvalKeyRegistry(const EvalKey<Element>& key) {
+        if (key == nullptr || key->GetCryptoContext() == nullptr)
+            OPENFHE_THROW(config_error, "EvalKey is not associated with a crypto context");
+        return *key->GetCryptoContext()->m_evalKeyRegistry;
     }
 
-    static std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalAutomorphismKeyMap() {
-        // cached evalautomorphism keys, by secret key UID
-        static std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> s_evalAutomorphismKeyMap;
-        return s_evalAutomorphismKeyMap;
-    }
+    /**
+   * Adds automorphism keys to the keys of a key tag. For an index already
+   * present, the existing key is kept unless the new key has more towers, so
+   * a level-reduced key never shadows a full one. The key map of the tag is
+   * replaced by a new map rather than modified, so maps returned by
+   * GetEvalAutomorphismKeyMapPtr are never modified while in use
+   */
+    void MergeEvalAutomorphismKeys(const std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeys,
+                                   const std::string& keyTag);
 
     std::string m_schemeId;
 
@@ -346,8 +352,9 @@ public:
                       const std::string& schemeId = "Not") {
         this->params.reset(params);
         this->scheme.reset(scheme);
-        this->m_keyGenLevel = 0;
-        this->m_schemeId    = schemeId;
+        this->m_keyGenLevel     = 0;
+        this->m_schemeId        = schemeId;
+        this->m_evalKeyRegistry = EvalKeyRegistry<Element>::Create();
     }
 
     /**
@@ -357,10 +364,11 @@ public:
    */
     CryptoContextImpl(std::shared_ptr<CryptoParametersBase<Element>> params,
                       std::shared_ptr<SchemeBase<Element>> scheme, const std::string& schemeId = "Not") {
-        this->params        = params;
-        this->scheme        = scheme;
-        this->m_keyGenLevel = 0;
-        this->m_schemeId    = schemeId;
+        this->params            = params;
+        this->scheme            = scheme;
+        this->m_keyGenLevel     = 0;
+        this->m_schemeId        = schemeId;
+        this->m_evalKeyRegistry = EvalKeyRegistry<Element>::Create();
     }
 
     /**
@@ -368,10 +376,11 @@ public:
    * @param c - source
    */
     CryptoContextImpl(const CryptoContextImpl<Element>& c) {
-        params              = c.params;
-        scheme              = c.scheme;
-        this->m_keyGenLevel = 0;
-        this->m_schemeId    = c.m_schemeId;
+        params                  = c.params;
+        scheme                  = c.scheme;
+        this->m_keyGenLevel     = 0;
+        this->m_schemeId        = c.m_schemeId;
+        this->m_evalKeyRegistry = c.m_evalKeyRegistry;
     }
 
     /**
@@ -380,10 +389,11 @@ public:
    * @return this
    */
     CryptoContextImpl<Element>& operator=(const CryptoContextImpl<Element>& rhs) {
-        params        = rhs.params;
-        scheme        = rhs.scheme;
-        m_keyGenLevel = rhs.m_keyGenLevel;
-        m_schemeId    = rhs.m_schemeId;
+        params            = rhs.params;
+        scheme            = rhs.scheme;
+        m_keyGenLevel     = rhs.m_keyGenLevel;
+        m_schemeId        = rhs.m_schemeId;
+        m_evalKeyRegistry = rhs.m_evalKeyRegistry;
         return *this;
     }
 
@@ -454,8 +464,9 @@ public:
    */
     template <typename ST>
     static bool SerializeEvalMultKey(std::ostream& ser, const ST& sertype, const CryptoContext<Element> cc) {
+        auto keys = cc->ReadEvalKeys();
         std::map<std::string, std::vector<EvalKey<Element>>> omap;
-        for (const auto& k : GetAllEvalMultKeys()) {
+        for (const auto& k : keys->mult) {
             if (k.second[0]->GetCryptoContext() == cc) {
                 omap[k.first] = k.second;
             }
@@ -480,18 +491,44 @@ public:
     static bool DeserializeEvalMultKey(std::istream& ser, const ST& sertype) {
         std::map<std::string, std::vector<EvalKey<Element>>> evalMultKeyMap;
 
-        Serial::Deserialize(GetAllEvalMultKeys(), ser, sertype);
+        Serial::Deserialize(evalMultKeyMap, ser, sertype);
 
         // The deserialize call created any contexts that needed to be created....
         // so all we need to do is put the keys into the maps for their context
 
-        for (auto k : GetAllEvalMultKeys()) {
-            GetAllEvalMultKeys()[k.first] = k.second;
+        for (auto& k : evalMultKeyMap) {
+            GetEvalKeyRegistry(k.second[0]).Modify([&](auto& keys) { keys.mult[k.first] = std::move(k.second); });
         }
 
         return true;
     }
 
+    /**
+   * SerializeEvalMultKeyChunked writes EvalMult keys to a chunked key file:
+   * every key is serialized separately and an index of the offsets and sizes
+   * of all keys precedes the keys, so that DeserializeEvalMultKeyChunked can
+   * decode them in parallel
+   *
+   * @param ser - stream to serialize to
+   * @param sertype - type of serialization used for the keys
+   * @param id for key to serialize - if empty std::string, serialize them all
+   * @return true on success
+   */
+    template <typename ST>
+    static bool SerializeEvalMultKeyChunked(std::ostream& ser, const ST& sertype, std::string id = "");
+
+    /**
+   * DeserializeEvalMultKeyChunked deserializes all keys of a chunked key file
+   * written by SerializeEvalMultKeyChunked; the keys are decoded in parallel
+   * deserialized keys silently replace any existing matching keys
+   *
+   * @param ser - stream to serialize from
+   * @param sertype - type of serialization used for the keys
+   * @return true on success
+   */
+    template <typename ST>
+    static bool DeserializeEvalMultKeyChunked(std::istream& ser, const ST& sertype);
+
     /**
    * ClearEvalMultKeys - flush EvalMultKey cache
    */
@@ -526,16 +563,17 @@ public:
    */
     template <typename ST>
     static bool SerializeEvalSumKey(std::ostream& ser, const ST& sertype, std::string id = "") {
-        std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>* smap;
+        auto allKeys = GetAllEvalSumKeysPtr();
+        const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>* smap;
         std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> omap;
 
         if (id.length() == 0) {
-            smap = &GetAllEvalSumKeys();
+            smap = allKeys.get();
         }
         else {
-            auto k = GetAllEvalSumKeys().find(id);
+            auto k = allKeys->find(id);
 
-            if (k == GetAllEvalSumKeys().end())
+            if (k == allKeys->end())
                 return false;  // no such id
 
             smap           = &omap;
@@ -555,8 +593,9 @@ public:
    */
     template <typename ST>
     static bool SerializeEvalSumKey(std::ostream& ser, const ST& sertype, const CryptoContext<Element> cc) {
+        auto keys = cc->ReadEvalKeys();
         std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> omap;
-        for (const auto& k : GetAllEvalSumKeys()) {
+        for (const auto& k : keys->sum) {
             if (k.second->begin()->second->GetCryptoContext() == cc) {
                 omap[k.first] = k.second;
             }
@@ -588,13 +627,42 @@ public:
         // The deserialize call created any contexts that needed to be created....
         // so all we need to do is put the keys into the maps for their context
 
-        for (auto k : evalSumKeyMap) {
-            GetAllEvalSumKeys()[k.first] = k.second;
+        for (auto& k : evalSumKeyMap) {
+            if (!k.second->empty())
+                GetEvalKeyRegistry(k.second->begin()->second).Modify([&](auto& keys) {
+                    keys.sum[k.first] = std::move(k.second);
+                });
         }
 
         return true;
     }
 
+    /**
+   * SerializeEvalSumKeyChunked writes EvalSum keys to a chunked key file:
+   * every key is serialized separately and an index of the offsets and sizes
+   * of all keys precedes the keys, so that DeserializeEvalSumKeyChunked can
+   * decode them in parallel
+   *
+   * @param ser - stream to serialize to
+   * @param sertype - type of serialization used for the keys
+   * @param id - key to serialize; empty std::string means all keys
+   * @return true on success
+   */
+    template <typename ST>
+    static bool SerializeEvalSumKeyChunked(std::ostream& ser, const ST& sertype, std::string id = "");
+
+    /**
+   * DeserializeEvalSumKeyChunked deserializes all keys of a chunked key file
+   * written by SerializeEvalSumKeyChunked; the keys are decoded in parallel
+   * deserialized keys silently replace any existing matching keys
+   *
+   * @param ser - stream to serialize from
+   * @param sertype - type of serialization used for the keys
+   * @return true on success
+   */
+    template <typename ST>
+    static bool DeserializeEvalSumKeyChunked(std::istream& ser, const ST& sertype);
+
     /**
    * ClearEvalSumKeys - flush EvalSumKey cache
    */
@@ -630,15 +698,16 @@ public:
    */
     template <typename ST>
     static bool SerializeEvalAutomorphismKey(std::ostream& ser, const ST& sertype, std::string id = "") {
-        std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>* smap;
+        auto allKeys = GetAllEvalAutomorphismKeysPtr();
+        const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>* smap;
         std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> omap;
         if (id.length() == 0) {
-            smap = &GetAllEvalAutomorphismKeys();
+            smap = allKeys.get();
         }
         else {
-            auto k = GetAllEvalAutomorphismKeys().find(id);
+            auto k = allKeys->find(id);
 
-            if (k == GetAllEvalAutomorphismKeys().end())
+            if (k == allKeys->end())
                 return false;  // no such id
 
             smap           = &omap;
@@ -658,8 +727,9 @@ public:
    */
     template <typename ST>
     static bool SerializeEvalAutomorphismKey(std::ostream& ser, const ST& sertype, const CryptoContext<Element> cc) {
+        auto keys = cc->ReadEvalKeys();
         std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> omap;
-        for (const auto& k : GetAllEvalAutomorphismKeys()) {
+        for (const auto& k : keys->automorphism) {
             if (k.second->begin()->second->GetCryptoContext() == cc) {
                 omap[k.first] = k.second;
             }
@@ -690,13 +760,42 @@ public:
         // The deserialize call created any contexts that needed to be created....
         // so all we need to do is put the keys into the maps for their context
 
-        for (auto k : evalSumKeyMap) {
-            GetAllEvalAutomorphismKeys()[k.first] = k.second;
+        for (auto& k : evalSumKeyMap) {
+            if (!k.second->empty())
+                GetEvalKeyRegistry(k.second->begin()->second).Modify([&](auto& keys) {
+                    keys.automorphism[k.first] = std::move(k.second);
+                });
         }
 
         return true;
     }
 
+    /**
+   * SerializeEvalAutomorphismKeyChunked writes EvalAutomorphism keys to a chunked key file:
+   * every key is serialized separately and an index of the offsets and sizes
+   * of all keys precedes the keys, so that DeserializeEvalAutomorphismKeyChunked can
+   * decode them in parallel
+   *
+   * @param ser - stream to serialize to
+   * @param sertype - type of serialization used for the keys
+   * @param id - key to serialize; empty std::string means all keys
+   * @return true on success
+   */
+    template <typename ST>
+    static bool SerializeEvalAutomorphismKeyChunked(std::ostream& ser, const ST& sertype, std::string id = "");
+
+    /**
+   * DeserializeEvalAutomorphismKeyChunked deserializes all keys of a chunked key file
+   * written by SerializeEvalAutomorphismKeyChunked; the keys are decoded in parallel
+   * deserialized keys silently replace any existing matching keys
+   *
+   * @param ser - stream to serialize from
+   * @param sertype - type of serialization used for the keys
+   * @return true on success
+   */
+    template <typename ST>
+    static bool DeserializeEvalAutomorphismKeyChunked(std::istream& ser, const ST& sertype);
+
     /**
    * ClearEvalAutomorphismKeys - flush EvalAutomorphismKey cache
    */
@@ -722,6 +821,70 @@ public:
    */
     static void InsertEvalAutomorphismKey(const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap);
 
+    /**
+   * ReplicateEvalAutomorphismKeysPerNumaNode copies the automorphism keys of a
+   * key tag to the memory of every NUMA node; each copy is made by a thread
+   * pinned to its node. GetEvalAutomorphismKeyMap then returns the copy of
+   * the node the calling thread runs on, until the keys of the tag change.
+   * Does nothing on machines with a single NUMA node
+   *
+   * @param id - key tag; if empty, the keys of all key tags are replicated
+   */
+    static void ReplicateEvalAutomorphismKeysPerNumaNode(const std::string& id = "");
+
+    /**
+   * ClearEvalAutomorphismKeyReplicas - drops all per-node copies of
+   * automorphism keys
+   */
+    static void ClearEvalAutomorphismKeyReplicas();
+
+    //------------------------------------------------------------------------------
+    // SHARED-MEMORY EVAL KEY STORE
+    //------------------------------------------------------------------------------
+
+    /**
+   * PublishEvalKeysToSharedMemory writes the EvalMult, EvalSum and
+   * EvalAutomorphism keys of a given context to a new named POSIX
+   * shared-memory segment. The segment only holds offsets and raw limbs, so
+   * other processes can map it at any address
+   *
+   * @param name - name of the segment, e.g. "/openfhe-keys"
+   * @param cc - context whose keys should be published
+   * @param replace - if false, fails when a segment with this name exists;
+   * if true, removes it first
+   * @param mode - access permissions of the segment; by default only the
+   * owner can read it
+   * @return true on success (false if the context has no keys)
+   */
+    static bool PublishEvalKeysToSharedMemory(const std::string& name, const CryptoContext<Element> cc,
+                                              bool replace = false, uint32_t mode = 0600);
+
+    /**
+   * AttachEvalKeysFromSharedMemory maps a segment written by
+   * PublishEvalKeysToSharedMemory and installs its keys in the key maps of a
+   * given context. The limbs of the keys are used in place: the pages of the
+   * segment are shared by all attached processes and stay mapped for as long
+   * as any of the keys is alive. The mapping is private, so a key modified in
+   * place gets a private copy of the pages it writes and the segment is never
+   * changed. As with InsertEvalMultKey, InsertEvalSumKey and
+   * InsertEvalAutomorphismKey, the keys of every key tag found in the segment
+   * replace all existing keys of that tag
+   *
+   * @param name - name of the segment
+   * @param cc - context the keys are used with; its ring dimension and moduli
+   * must match the ones of the publishing context
+   * @return true on success
+   */
+    static bool AttachEvalKeysFromSharedMemory(const std::string& name, const CryptoContext<Element> cc);
+
+    /**
+   * RemoveEvalKeysFromSharedMemory removes a named segment; processes that
+   * have already attached to it keep their keys and the mapping they use
+   *
+   * @param name - name of the segment
+   */
+    static void RemoveEvalKeysFromSharedMemory(const std::string& name);
+
     //------------------------------------------------------------------------------
     // TURN FEATURES ON
     //------------------------------------------------------------------------------
@@ -823,23 +986,135 @@ public:
     // KEYS GETTERS
     //------------------------------------------------------------------------------
 
+    /**
+   * ReadEvalKeys opens a read section on the EvalMult, EvalSum and
+   * EvalAutomorphism keys of this context. The keys found through the returned
+   * reader stay valid until it is destroyed, even if keys are generated,
+   * deserialized or cleared concurrently; opening and closing the section take
+   * no lock
+   *
+   * @return the reader
+   */
+    typename EvalKeyRegistry<Element>::Reader ReadEvalKeys() const {
+        return m_evalKeyRegistry->Read();
+    }
+
+    // Every context holds its keys, by key tag; the static getters below look
+    // a key tag up in the keys of all contexts. The getters returning
+    // references are kept for compatibility and are deprecated: the returned
+    // keys are replaced, not modified, when the keys of their tag change, and
+    // stay valid only as long as nothing else holds them. The ...Ptr getters
+    // return snapshots that stay valid and unchanged while the caller holds
+    // them.
+
+    /**
+   * GetAllEvalMultKeys returns a copy of the EvalMult keys of all contexts,
+   * kept per thread until the next call; changes to it are not applied
+   *
+   * @deprecated use GetAllEvalMultKeysPtr
+   * @return the EvalMult key vectors, by key tag
+   */
     static std::map<std::string, std::vector<EvalKey<Element>>>& GetAllEvalMultKeys();
 
+    /**
+   * GetAllEvalMultKeysPtr returns the EvalMult keys of all contexts
+   *
+   * @return the EvalMult key vectors, by key tag
+   */
+    static std::shared_ptr<const std::map<std::string, std::vector<EvalKey<Element>>>> GetAllEvalMultKeysPtr();
+
+    /**
+   * GetEvalMultKeyVector returns the EvalMult keys of a key tag
+   *
+   * @deprecated use GetEvalMultKeyVectorPtr
+   * @return the EvalMult keys
+   */
     static const std::vector<EvalKey<Element>>& GetEvalMultKeyVector(const std::string& keyID);
 
+    /**
+   * GetEvalMultKeyVectorPtr returns the EvalMult keys of a key tag
+   *
+   * @return the EvalMult keys
+   */
+    static std::shared_ptr<const std::vector<EvalKey<Element>>> GetEvalMultKeyVectorPtr(const std::string& keyID);
+
+    /**
+   * GetEvalMultKeyVectorCopy returns a copy of the EvalMult keys of a key tag
+   *
+   * @return the EvalMult keys
+   */
+    static std::vector<EvalKey<Element>> GetEvalMultKeyVectorCopy(const std::string& keyID);
+
+    /**
+   * GetAllEvalAutomorphismKeys returns a copy of the automorphism keys of all
+   * contexts, kept per thread until the next call; changes to it are not
+   * applied
+   *
+   * @deprecated use GetAllEvalAutomorphismKeysPtr
+   * @return the EvalAutomorphism key maps, by key tag
+   */
     static std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>& GetAllEvalAutomorphismKeys();
 
+    /**
+   * GetAllEvalAutomorphismKeysPtr returns the automorphism keys of all contexts
+   *
+   * @return the EvalAutomorphism key maps, by key tag
+   */
+    static std::shared_ptr<const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>
+    GetAllEvalAutomorphismKeysPtr();
+
+    /**
+   * GetEvalAutomorphismKeyMap returns the automorphism key map of a key tag.
+   * Changes made to the map are seen by later evaluations, but are not safe
+   * against concurrent evaluation or key installs
+   *
+   * @deprecated use GetEvalAutomorphismKeyMapPtr, and InsertEvalAutomorphismKey to change keys
+   * @return the EvalAutomorphism key map
+   */
     static std::map<usint, EvalKey<Element>>& GetEvalAutomorphismKeyMap(const std::string& id);
 
+    /**
+   * GetEvalAutomorphismKeyMapPtr returns the automorphism key map of a key
+   * tag, or its copy for the NUMA node of the calling thread if the keys were
+   * replicated
+   *
+   * @return the EvalAutomorphism key map
+   */
+    static std::shared_ptr<const std::map<usint, EvalKey<Element>>> GetEvalAutomorphismKeyMapPtr(
+        const std::string& id);
+
+    /**
+   * GetAllEvalSumKeys returns a copy of the EvalSum keys of all contexts, kept
+   * per thread until the next call; changes to it are not applied
+   *
+   * @deprecated use GetAllEvalSumKeysPtr
+   * @return the EvalSum key maps, by key tag
+   */
     static std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>& GetAllEvalSumKeys();
 
     /**
-   * GetEvalSumKey  returns the map
+   * GetAllEvalSumKeysPtr returns the EvalSum keys of all contexts
    *
+   * @return the EvalSum key maps, by key tag
+   */
+    static std::shared_ptr<const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>
+    GetAllEvalSumKeysPtr();
+
+    /**
+   * GetEvalSumKeyMap returns the EvalSum key map of a key tag
+   *
+   * @deprecated use GetEvalSumKeyMapPtr
    * @return the EvalSum key map
    */
     static const std::map<usint, EvalKey<Element>>& GetEvalSumKeyMap(const std::string& id);
 
+    /**
+   * GetEvalSumKeyMapPtr returns the EvalSum key map of a key tag
+   *
+   * @return the EvalSum key map
+   */
+    static std::shared_ptr<const std::map<usint, EvalKey<Element>>> GetEvalSumKeyMapPtr(const std::string& id);
+
     //------------------------------------------------------------------------------
     // PLAINTEXT FACTORY METHODS
     //------------------------------------------------------------------------------
@@ -1424,7 +1699,8 @@ public:
     Ciphertext<Element> EvalMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2) const {
         TypeCheck(ciphertext1, ciphertext2);
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext1->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext1->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMult");
         }
@@ -1432,6 +1708,47 @@ public:
         return GetScheme()->EvalMult(ciphertext1, ciphertext2, evalKeyVec[0]);
     }
 
+    /**
+   * EvalMultPrecompute extends a ciphertext to the basis used for the tensor
+   * product of EvalMult (BFV only). The result can be passed to EvalMult
+   * any number of times to skip the basis extension of that operand.
+   *
+   * @param ciphertext the ciphertext to be multiplied repeatedly
+   * @return the extended elements of the ciphertext
+   */
+    std::shared_ptr<std::vector<Element>> EvalMultPrecompute(ConstCiphertext<Element> ciphertext) const {
+        CheckCiphertext(ciphertext);
+
+        return GetScheme()->EvalMultPrecompute(ciphertext);
+    }
+
+    /**
+   * EvalMult - OpenFHE EvalMult method for a pair of ciphertexts - with key
+   * switching - that reuses the extended operands computed by
+   * EvalMultPrecompute. A precomputation that does not match the basis needed
+   * for this product (or nullptr) is ignored and the operand is extended as
+   * usual.
+   *
+   * @param ct1
+   * @param ct2
+   * @param precomp1 EvalMultPrecompute(ct1) or nullptr
+   * @param precomp2 EvalMultPrecompute(ct2) or nullptr
+   * @return new ciphertext for ct1 * ct2
+   */
+    Ciphertext<Element> EvalMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+                                 const std::shared_ptr<std::vector<Element>> precomp1,
+                                 const std::shared_ptr<std::vector<Element>> precomp2) const {
+        TypeCheck(ciphertext1, ciphertext2);
+
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext1->GetKeyTag());
+        if (!evalKeyVec.size()) {
+            OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMult");
+        }
+
+        return GetScheme()->EvalMult(ciphertext1, ciphertext2, precomp1, precomp2, evalKeyVec[0]);
+    }
+
     /**
    * EvalMult - OpenFHE EvalMult method for a pair of ciphertexts - with key
    * switching This is a mutable version - input ciphertexts may get
@@ -1444,7 +1761,8 @@ public:
     Ciphertext<Element> EvalMultMutable(Ciphertext<Element>& ciphertext1, Ciphertext<Element>& ciphertext2) const {
         TypeCheck(ciphertext1, ciphertext2);
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext1->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext1->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMultMutable");
         }
@@ -1464,7 +1782,8 @@ public:
     void EvalMultMutableInPlace(Ciphertext<Element>& ciphertext1, Ciphertext<Element>& ciphertext2) const {
         TypeCheck(ciphertext1, ciphertext2);
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext1->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext1->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMultMutable");
         }
@@ -1475,7 +1794,8 @@ public:
     Ciphertext<Element> EvalSquare(ConstCiphertext<Element> ciphertext) const {
         CheckCiphertext(ciphertext);
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMult");
         }
@@ -1486,7 +1806,8 @@ public:
     Ciphertext<Element> EvalSquareMutable(Ciphertext<Element>& ciphertext) const {
         CheckCiphertext(ciphertext);
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMultMutable");
         }
@@ -1497,7 +1818,8 @@ public:
     void EvalSquareInPlace(Ciphertext<Element>& ciphertext) const {
         CheckCiphertext(ciphertext);
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMultMutable");
         }
@@ -1530,7 +1852,8 @@ public:
         if (!ciphertext)
             OPENFHE_THROW(type_error, "Input ciphertext is nullptr");
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext->GetKeyTag());
 
         if (evalKeyVec.size() < (ciphertext->GetElements().size() - 2)) {
             OPENFHE_THROW(type_error,
@@ -1553,7 +1876,8 @@ public:
         if (!ciphertext)
             OPENFHE_THROW(type_error, "Input ciphertext is nullptr");
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext->GetKeyTag());
         if (evalKeyVec.size() < (ciphertext->GetElements().size() - 2)) {
             OPENFHE_THROW(type_error,
                           "Insufficient value was used for maxRelinSkDeg to generate "
@@ -1580,7 +1904,8 @@ public:
         if (!ciphertext1 || !ciphertext2)
             OPENFHE_THROW(type_error, "Input ciphertext is nullptr");
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertext1->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext1->GetKeyTag());
 
         if (evalKeyVec.size() < (ciphertext1->GetElements().size() + ciphertext2->GetElements().size() - 3)) {
             OPENFHE_THROW(type_error,
@@ -1755,8 +2080,10 @@ public:
     Ciphertext<Element> EvalRotate(ConstCiphertext<Element> ciphertext, int32_t index) const {
         CheckCiphertext(ciphertext);
 
-        auto evalKeyMap = GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag());
-        return GetScheme()->EvalAtIndex(ciphertext, index, evalKeyMap);
+        usint autoIndex = FindAutomorphismIndex(index);
+        auto keys       = ReadEvalKeys();
+        return GetScheme()->EvalAutomorphism(ciphertext, autoIndex,
+                                             keys.GetAutomorphismKey(ciphertext->GetKeyTag(), autoIndex));
     }
 
     /**
@@ -1844,9 +2171,10 @@ public:
    */
     Ciphertext<Element> EvalFastRotationExt(ConstCiphertext<Element> ciphertext, usint index,
                                             const std::shared_ptr<std::vector<Element>> digits, bool addFirst) const {
-        auto evalKeyMap = GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag());
+        auto keys = ReadEvalKeys();
 
-        return GetScheme()->EvalFastRotationExt(ciphertext, index, digits, addFirst, evalKeyMap);
+        return GetScheme()->EvalFastRotationExt(ciphertext, index, digits, addFirst,
+                                                *keys.GetAutomorphismKeys(ciphertext->GetKeyTag()).GetMap());
     }
 
     /**
@@ -1894,6 +2222,21 @@ public:
     void EvalAtIndexKeyGen(const PrivateKey<Element> privateKey, const std::vector<int32_t>& indexList,
                            const PublicKey<Element> publicKey = nullptr);
 
+    /**
+   * EvalAtIndexKeyGen generates evaluation keys for a list of indices, keeping
+   * only the RNS limbs and digits needed at the level each key is used at.
+   * A key generated for level l works for ciphertexts with at most
+   * (number of towers in Q) - l towers, i.e., at level l or deeper.
+   *
+   * @param privateKey private key.
+   * @param indexList list of indices.
+   * @param levels the level each index will be used at (same size as indexList);
+   * 0 generates a full key.
+   * @param publicKey public key (used in NTRU schemes).
+   */
+    void EvalAtIndexKeyGen(const PrivateKey<Element> privateKey, const std::vector<int32_t>& indexList,
+                           const std::vector<uint32_t>& levels, const PublicKey<Element> publicKey = nullptr);
+
     /**
    * EvalRotateKeyGen generates evaluation keys for a list of indices
    *
@@ -1906,6 +2249,19 @@ public:
         EvalAtIndexKeyGen(privateKey, indexList, publicKey);
     };
 
+    /**
+   * EvalRotateKeyGen generates level-aware evaluation keys for a list of indices
+   *
+   * @param privateKey private key.
+   * @param indexList list of indices.
+   * @param levels the level each index will be used at (same size as indexList).
+   * @param publicKey public key (used in NTRU schemes).
+   */
+    void EvalRotateKeyGen(const PrivateKey<Element> privateKey, const std::vector<int32_t>& indexList,
+                          const std::vector<uint32_t>& levels, const PublicKey<Element> publicKey = nullptr) {
+        EvalAtIndexKeyGen(privateKey, indexList, levels, publicKey);
+    };
+
     /**
    * Moves i-th slot to slot 0
    *
@@ -1931,7 +2287,8 @@ public:
         CheckCiphertext(ciphertext1);
         CheckCiphertext(ciphertext2);
 
-        auto evalKeyVec = GetEvalMultKeyVector(ciphertext1->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertext1->GetKeyTag());
         if (!evalKeyVec.size()) {
             OPENFHE_THROW(type_error, "Evaluation key has not been generated for EvalMult");
         }
@@ -2085,7 +2442,8 @@ public:
             return ciphertextVec[0];
         }
 
-        const auto evalKeyVec = GetEvalMultKeyVector(ciphertextVec[0]->GetKeyTag());
+        auto keys              = ReadEvalKeys();
+        const auto& evalKeyVec = keys.GetMultKeys(ciphertextVec[0]->GetKeyTag());
         if (evalKeyVec.size() < (ciphertextVec[0]->GetElements().size() - 2)) {
             OPENFHE_THROW(type_error, "Insufficient value was used for maxRelinSkDeg to generate keys");
         }
@@ -2286,6 +2644,55 @@ public:
    */
     Ciphertext<Element> EvalMerge(const std::vector<Ciphertext<Element>>& ciphertextVec) const;
 
+    /**
+   * Packed matrix multiplication:
+   * There are three methods that have to be called in this specific order:
+   * 1. EvalMatMultSetup: computes and encodes the permutation masks for d x d matrices
+   * 2. EvalMatMultKeyGen: computes and stores the rotation keys (EvalMultKeyGen is also needed)
+   * 3. EvalMatMult/EvalMatMultBlocks: multiplies encrypted matrices
+   * A d x d matrix is packed row-major into d * d slots; d * d has to divide the number of slots.
+   */
+
+    /**
+   * Precomputes the masks for multiplying d x d matrices
+   *
+   * @param dim matrix dimension d
+   */
+    void EvalMatMultSetup(uint32_t dim);
+
+    /**
+   * Generates the rotation keys for multiplying d x d matrices
+   *
+   * @param privateKey private key.
+   * @param dim matrix dimension d
+   */
+    void EvalMatMultKeyGen(const PrivateKey<Element> privateKey, uint32_t dim);
+
+    /**
+   * Multiplies two encrypted d x d matrices; consumes three multiplicative levels.
+   * For BFV/BGV the packed matrices have to be replicated across all slots.
+   *
+   * @param ciphertext1 encrypted matrix A.
+   * @param ciphertext2 encrypted matrix B.
+   * @param dim matrix dimension d
+   * @return encryption of A * B
+   */
+    Ciphertext<Element> EvalMatMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+                                    uint32_t dim) const;
+
+    /**
+   * Multiplies two block matrices whose d x d blocks are encrypted separately.
+   * The output blocks are computed in parallel.
+   *
+   * @param blocks1 p x q grid of encrypted blocks of A.
+   * @param blocks2 q x r grid of encrypted blocks of B.
+   * @param dim block dimension d
+   * @return p x r grid of encrypted blocks of A * B
+   */
+    std::vector<std::vector<Ciphertext<Element>>> EvalMatMultBlocks(
+        const std::vector<std::vector<Ciphertext<Element>>>& blocks1,
+        const std::vector<std::vector<Ciphertext<Element>>>& blocks2, uint32_t dim) const;
+
     //------------------------------------------------------------------------------
     // PRE Wrapper
     //------------------------------------------------------------------------------
@@ -2330,6 +2737,27 @@ public:
         return GetScheme()->ReEncrypt(ciphertext, evalKey, publicKey);
     }
 
+    /**
+   * ReEncrypt - Proxy Re Encryption of a batch of ciphertexts under the same
+   * re-encryption key. The ciphertexts are re-encrypted in parallel, which is
+   * considerably faster than calling ReEncrypt for each ciphertext when many
+   * small ciphertexts are processed.
+   * @param ciphertextVec - vector of ciphertexts to re-encrypt
+   * @param evalKey - evaluation key from the PRE keygen method
+   * @param publicKey the public key of the recipient of the re-encrypted
+   * ciphertexts; if given, flooding noise is added to every ciphertext.
+   * @return vector of re-encrypted ciphertexts, in the order of the input
+   */
+    std::vector<Ciphertext<Element>> ReEncrypt(const std::vector<Ciphertext<Element>>& ciphertextVec,
+                                               EvalKey<Element> evalKey,
+                                               const PublicKey<Element> publicKey = nullptr) const {
+        for (const auto& ciphertext : ciphertextVec)
+            CheckCiphertext(ciphertext);
+        CheckKey(evalKey);
+
+        return GetScheme()->ReEncrypt(ciphertextVec, evalKey, publicKey);
+    }
+
     //------------------------------------------------------------------------------
     // Multiparty Wrapper
     //------------------------------------------------------------------------------
@@ -2621,6 +3049,146 @@ public:
         return GetScheme()->MultiAddEvalMultKeys(evalKey1, evalKey2, keyId);
     }
 
+    /**
+   * Threshold FHE: Adds the partial public keys of all parties in a single
+   * pass, rather than folding them pairwise
+   *
+   * @param publicKeyVec public keys of the parties.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   * @return the new joined key.
+   */
+    PublicKey<Element> MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec,
+                                       const std::string& keyId = "") {
+        return GetScheme()->MultiAddPubKeys(publicKeyVec, keyId);
+    }
+
+    /**
+   * Threshold FHE: Adds the evaluation keys of all parties in a single pass
+   *
+   * @param evalKeyVec evaluation keys of the parties.
+   * @param keyId - new key identifier used for the resulting evaluation key
+   * @return the new joined key.
+   */
+    EvalKey<Element> MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec, const std::string& keyId = "") {
+        return GetScheme()->MultiAddEvalKeys(evalKeyVec, keyId);
+    }
+
+    /**
+   * Threshold FHE: Adds the partial evaluation keys for multiplication of all
+   * parties in a single pass
+   *
+   * @param evalKeyVec evaluation keys of the parties.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   * @return the new joined key.
+   */
+    EvalKey<Element> MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                          const std::string& keyId = "") {
+        return GetScheme()->MultiAddEvalMultKeys(evalKeyVec, keyId);
+    }
+
+    /**
+   * Threshold FHE: Adds the automorphism key sets of all parties in a single
+   * pass. Only the indices present in every set are joined.
+   *
+   * @param evalKeyMapVec automorphism key sets of the parties.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   * @return the new joined key set.
+   */
+    std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalAutomorphismKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec,
+        const std::string& keyId = "") {
+        return GetScheme()->MultiAddEvalAutomorphismKeys(evalKeyMapVec, keyId);
+    }
+
+    /**
+   * Threshold FHE: Adds the summation key sets of all parties in a single
+   * pass. Only the indices present in every set are joined.
+   *
+   * @param evalKeyMapVec summation key sets of the parties.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   * @return the new joined key set.
+   */
+    std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalSumKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec,
+        const std::string& keyId = "") {
+        return GetScheme()->MultiAddEvalSumKeys(evalKeyMapVec, keyId);
+    }
+
+    /**
+   * Threshold FHE: Accumulates a partial public key into a running sum, so
+   * that shares can be joined as they arrive. Pass an empty key to start a
+   * new sum; it is initialized with a copy of the first share.
+   *
+   * @param publicKeySum running sum, updated in place; must not be one of the
+   * parties' keys.
+   * @param publicKey public key of the next party.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   */
+    void MultiAddPubKeysInPlace(PublicKey<Element>& publicKeySum, PublicKey<Element> publicKey,
+                                const std::string& keyId = "") {
+        GetScheme()->MultiAddPubKeysInPlace(publicKeySum, publicKey, keyId);
+    }
+
+    /**
+   * Threshold FHE: Accumulates an evaluation key into a running sum. Pass an
+   * empty key to start a new sum.
+   *
+   * @param evalKeySum running sum, updated in place; must not be one of the
+   * parties' keys.
+   * @param evalKey evaluation key of the next party.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   */
+    void MultiAddEvalKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey,
+                                 const std::string& keyId = "") {
+        GetScheme()->MultiAddEvalKeysInPlace(evalKeySum, evalKey, keyId);
+    }
+
+    /**
+   * Threshold FHE: Accumulates a partial evaluation key for multiplication
+   * into a running sum. Pass an empty key to start a new sum.
+   *
+   * @param evalKeySum running sum, updated in place; must not be one of the
+   * parties' keys.
+   * @param evalKey evaluation key of the next party.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   */
+    void MultiAddEvalMultKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey,
+                                     const std::string& keyId = "") {
+        GetScheme()->MultiAddEvalMultKeysInPlace(evalKeySum, evalKey, keyId);
+    }
+
+    /**
+   * Threshold FHE: Accumulates an automorphism key set into a running sum.
+   * Pass an empty map pointer to start a new sum. Indices missing from the
+   * share are dropped from the sum.
+   *
+   * @param evalKeyMapSum running sum, updated in place; must not be one of
+   * the parties' key sets.
+   * @param evalKeyMap automorphism key set of the next party.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   */
+    void MultiAddEvalAutomorphismKeysInPlace(std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+                                             const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap,
+                                             const std::string& keyId = "") {
+        GetScheme()->MultiAddEvalAutomorphismKeysInPlace(evalKeyMapSum, evalKeyMap, keyId);
+    }
+
+    /**
+   * Threshold FHE: Accumulates a summation key set into a running sum. Pass
+   * an empty map pointer to start a new sum. Indices missing from the share
+   * are dropped from the sum.
+   *
+   * @param evalKeyMapSum running sum, updated in place; must not be one of
+   * the parties' key sets.
+   * @param evalKeyMap summation key set of the next party.
+   * @param keyId - new key identifier used for the resulting evaluation key.
+   */
+    void MultiAddEvalSumKeysInPlace(std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+                                    const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap,
+                                    const std::string& keyId = "") {
+        GetScheme()->MultiAddEvalSumKeysInPlace(evalKeyMapSum, evalKeyMap, keyId);
+    }
+
     //------------------------------------------------------------------------------
     // FHE Bootstrap Methods
     //------------------------------------------------------------------------------
@@ -2642,9 +3210,12 @@ public:
    * @param dim1 - vector of inner dimension in the baby-step giant-step routine
    * for encoding and decoding
    * @param slots - number of slots to be bootstrapped
+   * @param cacheDir - directory of the on-disk cache of precomputations. If the precomputations
+   * for the same crypto parameters, level budget, dim1 and slots are found there, they are loaded
+   * instead of being recomputed; otherwise they are computed and stored. No caching if empty.
    */
     void EvalBootstrapSetup(std::vector<uint32_t> levelBudget = {5, 4}, std::vector<uint32_t> dim1 = {0, 0},
-                            uint32_t slots = 0);
+                            uint32_t slots = 0, const std::string& cacheDir = "");
 
     /**
    * Generates all automorphism keys for EvalBT.
@@ -2664,6 +3235,16 @@ public:
    */
     Ciphertext<Element> EvalBootstrap(ConstCiphertext<Element> ciphertext) const;
 
+    /**
+   * Bootstraps a vector of ciphertexts encrypting real values. Pairs of ciphertexts
+   * are packed as ct1 + i * ct2 so that one bootstrapping refreshes two ciphertexts;
+   * the packed bootstrappings are evaluated in parallel.
+   *
+   * @param ciphertexts the input ciphertexts (real-valued messages only).
+   * @return the refreshed ciphertexts in the same order.
+   */
+    std::vector<Ciphertext<Element>> EvalBootstrap(const std::vector<Ciphertext<Element>>& ciphertexts) const;
+
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
         ar(cereal::make_nvp("cc", params));
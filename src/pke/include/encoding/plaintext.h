@@ -71,6 +71,9 @@ protected:
     mutable Poly encodedVector;
     mutable NativePoly encodedNativeVector;
     mutable DCRTPoly encodedVectorDCRT;
+    // set when a decryption result is only held in encodedVectorDCRT; encodedVector
+    // is interpolated from it on the first GetElement<Poly>() call
+    mutable bool isPolyPending = false;
 
     static constexpr int intCTOR     = 0x01;
     static constexpr int vecintCTOR  = 0x02;
@@ -116,6 +119,7 @@ public:
           encodingParams(rhs.encodingParams),
           encodedVector(rhs.encodedVector),
           encodedVectorDCRT(rhs.encodedVectorDCRT),
+          isPolyPending(rhs.isPolyPending),
           scalingFactor(rhs.scalingFactor),
           scalingFactorInt(rhs.scalingFactorInt),
           level(rhs.level),
@@ -129,6 +133,7 @@ public:
           encodingParams(std::move(rhs.encodingParams)),
           encodedVector(std::move(rhs.encodedVector)),
           encodedVectorDCRT(std::move(rhs.encodedVectorDCRT)),
+          isPolyPending(rhs.isPolyPending),
           scalingFactor(rhs.scalingFactor),
           scalingFactorInt(rhs.scalingFactorInt),
           level(rhs.level),
@@ -158,6 +163,14 @@ public:
         scalingFactor = sf;
     }
 
+    /**
+   * SetIsEncoded - marks a plaintext whose encoded element was set directly
+   * (e.g., restored from storage), so that it is not encoded again
+   */
+    void SetIsEncoded(bool encoded) {
+        isEncoded = encoded;
+    }
+
     /**
    * Get the scaling factor of the plaintext for BGV-based plaintexts.
    */
@@ -431,15 +444,24 @@ inline bool operator!=(const Plaintext p1, const Plaintext p2) {
 
 /**
  * GetElement
- * @return the Polynomial that the element was encoded into
+ * @return the Polynomial that the element was encoded into; for a multi-tower CKKS
+ * decryption result it is interpolated from the DCRTPoly on first access
  */
 template <>
 inline const Poly& PlaintextImpl::GetElement<Poly>() const {
+    if (isPolyPending) {
+        encodedVector = encodedVectorDCRT.CRTInterpolate();
+        isPolyPending = false;
+    }
     return encodedVector;
 }
 
 template <>
 inline Poly& PlaintextImpl::GetElement<Poly>() {
+    if (isPolyPending) {
+        encodedVector = encodedVectorDCRT.CRTInterpolate();
+        isPolyPending = false;
+    }
     return encodedVector;
 }
 
@@ -54,6 +54,24 @@ bool PrecomputeCRTTablesAfterDeserializaton();
 void EnablePrecomputeCRTTablesAfterDeserializaton();
 void DisablePrecomputeCRTTablesAfterDeserializaton();
 
+/**
+     * PrecomputeCRTTablesScope overrides the value returned by PrecomputeCRTTablesAfterDeserializaton()
+     * for the calling thread while it is in scope; other threads keep seeing the global value.
+     * The library uses it to skip the precomputation for contexts it deserializes internally
+     * without changing the global setting
+     */
+class PrecomputeCRTTablesScope {
+public:
+    explicit PrecomputeCRTTablesScope(bool precompute);
+    ~PrecomputeCRTTablesScope();
+
+    PrecomputeCRTTablesScope(const PrecomputeCRTTablesScope&)            = delete;
+    PrecomputeCRTTablesScope& operator=(const PrecomputeCRTTablesScope&) = delete;
+
+private:
+    int m_previous;
+};
+
 }  // namespace lbcrypto
 
 #endif  // __GLOBALS_H__
@@ -95,6 +95,17 @@ public:
         OPENFHE_THROW(not_implemented_error, "GetAVector operation not supported");
     }
 
+    /**
+   * Getter function to access Relinearization Element Vector A for in-place
+   * updates. Throws exception, to be overridden by derived class.
+   *
+   * @return Element vector A.
+   */
+
+    virtual std::vector<Element>& GetAVector() {
+        OPENFHE_THROW(not_implemented_error, "GetAVector operation not supported");
+    }
+
     /**
    * Setter function to store Relinearization Element Vector B.
    * Throws exception, to be overridden by derived class.
@@ -128,6 +139,17 @@ public:
         OPENFHE_THROW(not_implemented_error, "GetBVector operation not supported");
     }
 
+    /**
+   * Getter function to access Relinearization Element Vector B for in-place
+   * updates. Throws exception, to be overridden by derived class.
+   *
+   * @return Element vector B.
+   */
+
+    virtual std::vector<Element>& GetBVector() {
+        OPENFHE_THROW(not_implemented_error, "GetBVector operation not supported");
+    }
+
     /**
    * Setter function to store key switch Element.
    * Throws exception, to be overridden by derived class.
@@ -0,0 +1,526 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+#ifndef LBCRYPTO_CRYPTO_KEY_EVALKEYREGISTRY_H
+#define LBCRYPTO_CRYPTO_KEY_EVALKEYREGISTRY_H
+
+#include "key/evalkey-fwd.h"
+#include "utils/exception.h"
+#include "utils/inttypes.h"
+#include "utils/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace lbcrypto
+ * The namespace of lbcrypto
+ */
+namespace lbcrypto {
+
+/**
+ * @brief Epoch-based read sections, shared by all EvalKey registries.
+ *
+ * A thread inside a section publishes the global epoch it entered in, in a
+ * slot of its own, and clears the slot when it leaves. An object unlinked by
+ * a writer is retired with the epoch returned by Advance() and can be freed
+ * once OldestActive() has reached that epoch, as no thread can then be in a
+ * section that started before the object was unlinked. Entering and leaving a
+ * section take no lock and do not write to memory shared with other threads.
+ * Sections of one thread nest.
+ */
+class EvalKeyEpoch {
+public:
+    // per-thread slot, defined in evalkeyregistry.cpp
+    struct Slot;
+
+    EvalKeyEpoch();
+
+    ~EvalKeyEpoch() {
+        Leave();
+    }
+
+    EvalKeyEpoch(const EvalKeyEpoch&) = delete;
+    EvalKeyEpoch& operator=(const EvalKeyEpoch&) = delete;
+
+    /**
+   * Leaves the section; does nothing if it was left already
+   */
+    void Leave();
+
+    /**
+   * Starts a new epoch
+   *
+   * @return the new epoch; objects unlinked before the call can be retired with it
+   */
+    static uint64_t Advance();
+
+    /**
+   * Returns the oldest epoch a thread is in a section of, or UINT64_MAX if no
+   * thread is in a section
+   */
+    static uint64_t OldestActive();
+
+private:
+    Slot* m_slot;
+};
+
+/**
+ * @brief Registry of the EvalMult, EvalSum and EvalAutomorphism keys of a
+ * crypto context, by key tag.
+ *
+ * The keys are held in an immutable snapshot. Writers are serialized: they
+ * copy the current snapshot, change the copy, index it and publish it with an
+ * atomic pointer exchange, so key installs and clears never block or
+ * invalidate concurrent evaluation. Readers enter an EvalKeyEpoch section and
+ * load the snapshot pointer; they take no lock and change no reference count.
+ * A replaced snapshot is freed once no section that could still see it is
+ * open.
+ *
+ * Every snapshot carries a read index: key tags are interned to ids that are
+ * never reused, the keys of a tag are found by id in a vector, and the
+ * automorphism keys of a tag are found by automorphism index in an
+ * open-addressing table.
+ *
+ * @tparam Element a ring element.
+ */
+template <typename Element>
+class EvalKeyRegistry {
+public:
+    using EvalKeyVector = std::vector<EvalKey<Element>>;
+    using EvalKeyMap    = std::map<usint, EvalKey<Element>>;
+
+    /**
+   * Per-NUMA-node copies of the automorphism keys of a key tag; the copies are
+   * used only while the key map of the tag is still the one they were made from
+   */
+    struct Replicas {
+        std::shared_ptr<EvalKeyMap> source;
+        std::vector<std::shared_ptr<EvalKeyMap>> nodes;
+    };
+
+    /**
+   * The automorphism keys of a key tag, with a table from automorphism index to
+   * key. Maps handed out by the deprecated reference getter may be changed in
+   * place; MarkModified then makes lookups use the map only
+   */
+    class AutomorphismKeys {
+    public:
+        explicit AutomorphismKeys(std::shared_ptr<EvalKeyMap> keys) : m_keys(std::move(keys)) {
+            size_t capacity = 1;
+            while (capacity < 2 * m_keys->size())
+                capacity <<= 1;
+            m_table.resize(capacity);
+
+            // automorphism indices are odd, so the low bit is dropped; index 0
+            // marks an empty slot and is found through the map
+            const size_t mask = capacity - 1;
+            for (const auto& key : *m_keys) {
+                if (key.first == 0)
+                    continue;
+                size_t slot = (key.first >> 1) & mask;
+                while (m_table[slot].first != 0)
+                    slot = (slot + 1) & mask;
+                m_table[slot] = key;
+            }
+        }
+
+        const EvalKey<Element>* Find(usint index) const {
+            if (!m_modified.load(std::memory_order_relaxed)) {
+                const size_t mask = m_table.size() - 1;
+                for (size_t slot = (index >> 1) & mask; m_table[slot].first != 0; slot = (slot + 1) & mask) {
+                    if (m_table[slot].first == index)
+                        return &m_table[slot].second;
+                }
+                if (index != 0)
+                    return nullptr;
+            }
+            auto it = m_keys->find(index);
+            return (it == m_keys->end()) ? nullptr : &it->second;
+        }
+
+        const std::shared_ptr<EvalKeyMap>& GetMap() const {
+            return m_keys;
+        }
+
+        bool IsModified() const {
+            return m_modified.load(std::memory_order_relaxed);
+        }
+
+        void MarkModified() const {
+            m_modified.store(true, std::memory_order_relaxed);
+        }
+
+    private:
+        std::shared_ptr<EvalKeyMap> m_keys;
+        std::vector<std::pair<usint, EvalKey<Element>>> m_table;
+        mutable std::atomic<bool> m_modified{false};
+    };
+
+    /**
+   * The keys of one key tag
+   */
+    struct Entry {
+        std::shared_ptr<const EvalKeyVector> mult;
+        std::shared_ptr<EvalKeyMap> sum;
+        std::shared_ptr<const AutomorphismKeys> automorphism;
+        // per-NUMA-node copies of the automorphism keys, if they were replicated
+        std::vector<std::shared_ptr<const AutomorphismKeys>> replicas;
+
+        /**
+     * Returns the automorphism keys, or their copy for the NUMA node of the
+     * calling thread if the keys were replicated
+     */
+        const AutomorphismKeys& GetAutomorphismKeys() const {
+            if (!replicas.empty() && !automorphism->IsModified()) {
+                size_t node = ParallelControls::GetCurrentNumaNode();
+                if (node < replicas.size() && replicas[node] != nullptr)
+                    return *replicas[node];
+            }
+            return *automorphism;
+        }
+    };
+
+    struct Snapshot {
+        std::map<std::string, EvalKeyVector> mult;
+        std::map<std::string, std::shared_ptr<EvalKeyMap>> sum;
+        std::map<std::string, std::shared_ptr<EvalKeyMap>> automorphism;
+        std::map<std::string, Replicas> replicas;
+
+        // read index, rebuilt by Modify
+        std::shared_ptr<const std::unordered_map<std::string, uint32_t>> ids;
+        std::vector<std::shared_ptr<const Entry>> entries;
+
+        const std::shared_ptr<const Entry>* Find(const std::string& tag) const {
+            auto id = ids->find(tag);
+            if (id == ids->end() || id->second >= entries.size() || entries[id->second] == nullptr)
+                return nullptr;
+            return &entries[id->second];
+        }
+    };
+
+    /**
+   * @brief Read section on a registry.
+   *
+   * Holds the snapshot that was current when the reader was created; the
+   * snapshot and every key found through the reader stay valid until the
+   * reader is destroyed. Keys of a tag missing from the registry are looked up
+   * in the registries of the other contexts.
+   */
+    class Reader {
+    public:
+        explicit Reader(const EvalKeyRegistry& registry)
+            : m_registry(registry), m_snapshot(registry.m_current.load()) {}
+
+        ~Reader() {
+            m_epoch.Leave();
+            if (m_registry.m_hasRetired.load(std::memory_order_relaxed))
+                m_registry.TryReclaim();
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        const Snapshot* operator->() const {
+            return m_snapshot;
+        }
+
+        const EvalKeyVector& GetMultKeys(const std::string& tag) const {
+            const Entry* entry = Find(tag, [](const Entry& e) { return e.mult != nullptr; });
+            if (entry == nullptr)
+                OPENFHE_THROW(not_available_error,
+                              "You need to use EvalMultKeyGen so that you have an "
+                              "EvalMultKey available for this ID");
+            return *entry->mult;
+        }
+
+        const EvalKeyMap& GetSumKeys(const std::string& tag) const {
+            const Entry* entry = Find(tag, [](const Entry& e) { return e.sum != nullptr; });
+            if (entry == nullptr)
+                OPENFHE_THROW(not_available_error,
+                              "You need to use EvalSumKeyGen so that you have EvalSumKeys "
+                              "available for this ID");
+            return *entry->sum;
+        }
+
+        const AutomorphismKeys& GetAutomorphismKeys(const std::string& tag) const {
+            const Entry* entry = Find(tag, [](const Entry& e) { return e.automorphism != nullptr; });
+            if (entry == nullptr)
+                OPENFHE_THROW(not_available_error,
+                              "You need to use EvalAutomorphismKeyGen so that you have "
+                              "EvalAutomorphismKeys available for this ID");
+            return entry->GetAutomorphismKeys();
+        }
+
+        const EvalKey<Element>& GetAutomorphismKey(const std::string& tag, usint index) const {
+            const EvalKey<Element>* key = GetAutomorphismKeys(tag).Find(index);
+            if (key == nullptr)
+                OPENFHE_THROW(not_available_error,
+                              "EvalKey for automorphism index " + std::to_string(index) + " is not available for this ID");
+            return *key;
+        }
+
+    private:
+        template <typename Has>
+        const Entry* Find(const std::string& tag, Has has) const {
+            auto entry = m_snapshot->Find(tag);
+            if (entry != nullptr && has(**entry))
+                return entry->get();
+
+            const Entry* found = nullptr;
+            ForEach([&](const std::shared_ptr<EvalKeyRegistry>& registry) {
+                if (registry.get() == &m_registry)
+                    return false;
+                auto other = registry->m_current.load()->Find(tag);
+                if (other == nullptr || !has(**other))
+                    return false;
+                // the snapshot is protected by this section; the registry has to be kept alive
+                m_pinned.push_back(registry);
+                found = other->get();
+                return true;
+            });
+            return found;
+        }
+
+        // declared first: the section has to be entered before the snapshot is loaded
+        EvalKeyEpoch m_epoch;
+        const EvalKeyRegistry& m_registry;
+        const Snapshot* m_snapshot;
+        mutable std::vector<std::shared_ptr<const EvalKeyRegistry>> m_pinned;
+    };
+
+    /**
+   * Creates a registry and adds it to the registries visited by ForEach
+   */
+    static std::shared_ptr<EvalKeyRegistry> Create() {
+        std::shared_ptr<EvalKeyRegistry> registry(new EvalKeyRegistry());
+        std::lock_guard<std::mutex> lock(ListMutex());
+        auto& list = List();
+        list.erase(std::remove_if(list.begin(), list.end(), [](const auto& r) { return r.expired(); }), list.end());
+        list.push_back(registry);
+        return registry;
+    }
+
+    /**
+   * Calls f for every live registry until f returns true
+   *
+   * @param f - callable taking a const std::shared_ptr<EvalKeyRegistry>& and returning bool
+   */
+    template <typename F>
+    static void ForEach(F&& f) {
+        std::vector<std::shared_ptr<EvalKeyRegistry>> live;
+        {
+            std::lock_guard<std::mutex> lock(ListMutex());
+            for (const auto& r : List()) {
+                if (auto registry = r.lock())
+                    live.push_back(std::move(registry));
+            }
+        }
+        for (const auto& registry : live) {
+            if (f(registry))
+                break;
+        }
+    }
+
+    ~EvalKeyRegistry() {
+        delete m_current.load();
+        for (auto& retired : m_retired)
+            delete retired.first;
+    }
+
+    EvalKeyRegistry(const EvalKeyRegistry&) = delete;
+    EvalKeyRegistry& operator=(const EvalKeyRegistry&) = delete;
+
+    /**
+   * Opens a read section on the current keys
+   */
+    Reader Read() const {
+        return Reader(*this);
+    }
+
+    /**
+   * Applies an update to a copy of the current snapshot and publishes the copy
+   *
+   * @param update - callable taking a Snapshot& to change
+   */
+    template <typename Update>
+    void Modify(Update&& update) {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        const Snapshot* current = m_current.load();
+        auto next               = new Snapshot(*current);
+        try {
+            update(*next);
+            Index(*current, next);
+        }
+        catch (...) {
+            delete next;
+            throw;
+        }
+
+        m_current.exchange(next);
+        m_retired.emplace_back(current, EvalKeyEpoch::Advance());
+        m_hasRetired.store(true, std::memory_order_relaxed);
+        Reclaim();
+    }
+
+private:
+    EvalKeyRegistry() {
+        auto empty = new Snapshot();
+        empty->ids = std::make_shared<const std::unordered_map<std::string, uint32_t>>();
+        m_current.store(empty);
+    }
+
+    static std::vector<std::weak_ptr<EvalKeyRegistry>>& List() {
+        static std::vector<std::weak_ptr<EvalKeyRegistry>> s_registries;
+        return s_registries;
+    }
+
+    static std::mutex& ListMutex() {
+        static std::mutex s_mutex;
+        return s_mutex;
+    }
+
+    // rebuilds the read index of next; entries and tables of keys that did not
+    // change are shared with the current snapshot
+    static void Index(const Snapshot& current, Snapshot* next) {
+        auto ids = current.ids;
+        std::vector<std::shared_ptr<const Entry>> entries;
+
+        auto index = [&](const std::string& tag) {
+            auto id = ids->find(tag);
+            if (id == ids->end()) {
+                auto interned = std::make_shared<std::unordered_map<std::string, uint32_t>>(*ids);
+                id            = interned->emplace(tag, static_cast<uint32_t>(interned->size())).first;
+                ids           = std::move(interned);
+            }
+            if (entries.size() <= id->second)
+                entries.resize(id->second + 1);
+            auto& entry = entries[id->second];
+            if (entry != nullptr)
+                return;
+
+            auto previous = current.Find(tag);
+            const Entry* old = (previous == nullptr) ? nullptr : previous->get();
+            auto built       = std::make_shared<Entry>();
+
+            auto mult = next->mult.find(tag);
+            if (mult != next->mult.end()) {
+                built->mult = (old != nullptr && old->mult != nullptr && *old->mult == mult->second) ?
+                                  old->mult :
+                                  std::make_shared<const EvalKeyVector>(mult->second);
+            }
+            auto sum = next->sum.find(tag);
+            if (sum != next->sum.end())
+                built->sum = sum->second;
+
+            auto table = [&](const std::shared_ptr<EvalKeyMap>& keys,
+                             const std::shared_ptr<const AutomorphismKeys>& reuse) {
+                return (reuse != nullptr && reuse->GetMap() == keys) ? reuse :
+                                                                       std::make_shared<const AutomorphismKeys>(keys);
+            };
+            auto automorphism = next->automorphism.find(tag);
+            if (automorphism != next->automorphism.end()) {
+                built->automorphism =
+                    table(automorphism->second, (old != nullptr) ? old->automorphism : nullptr);
+
+                auto replicas = next->replicas.find(tag);
+                if (replicas != next->replicas.end() && replicas->second.source == automorphism->second) {
+                    const auto& nodes = replicas->second.nodes;
+                    built->replicas.resize(nodes.size());
+                    for (size_t node = 0; node < nodes.size(); node++) {
+                        if (nodes[node] != nullptr)
+                            built->replicas[node] =
+                                table(nodes[node], (old != nullptr && node < old->replicas.size()) ?
+                                                       old->replicas[node] :
+                                                       nullptr);
+                    }
+                }
+            }
+
+            bool same = (old != nullptr) && old->mult == built->mult && old->sum == built->sum &&
+                        old->automorphism == built->automorphism && old->replicas == built->replicas;
+            if (same)
+                entry = *previous;
+            else
+                entry = std::move(built);
+        };
+
+        for (const auto& k : next->mult)
+            index(k.first);
+        for (const auto& k : next->sum)
+            index(k.first);
+        for (const auto& k : next->automorphism)
+            index(k.first);
+
+        next->ids     = std::move(ids);
+        next->entries = std::move(entries);
+    }
+
+    // frees the retired snapshots no section can still see; needs m_writeMutex
+    void Reclaim() const {
+        uint64_t oldest = EvalKeyEpoch::OldestActive();
+        m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(),
+                                       [oldest](const auto& retired) {
+                                           if (retired.second > oldest)
+                                               return false;
+                                           delete retired.first;
+                                           return true;
+                                       }),
+                        m_retired.end());
+        m_hasRetired.store(!m_retired.empty(), std::memory_order_relaxed);
+    }
+
+    void TryReclaim() const {
+        std::unique_lock<std::mutex> lock(m_writeMutex, std::try_to_lock);
+        if (lock.owns_lock())
+            Reclaim();
+    }
+
+    std::atomic<const Snapshot*> m_current{nullptr};
+    // replaced snapshots, with the epoch they were retired in
+    mutable std::vector<std::pair<const Snapshot*, uint64_t>> m_retired;
+    mutable std::atomic<bool> m_hasRetired{false};
+    // serializes writers and reclamation; readers do not use it
+    mutable std::mutex m_writeMutex;
+};
+
+}  // namespace lbcrypto
+
+#endif
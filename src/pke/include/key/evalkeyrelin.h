@@ -137,6 +137,16 @@ public:
         return m_rKey.at(0);
     }
 
+    /**
+   * Getter function to access Relinearization Element Vector A for in-place
+   * updates. Overrides base class implementation.
+   *
+   * @return Element vector A.
+   */
+    virtual std::vector<Element>& GetAVector() {
+        return m_rKey.at(0);
+    }
+
     /**
    * Setter function to store Relinearization Element Vector B.
    * Overrides base class implementation.
@@ -167,6 +177,16 @@ public:
         return m_rKey.at(1);
     }
 
+    /**
+   * Getter function to access Relinearization Element Vector B for in-place
+   * updates. Overrides base class implementation.
+   *
+   * @return Element vector B.
+   */
+    virtual std::vector<Element>& GetBVector() {
+        return m_rKey.at(1);
+    }
+
     /**
    * Setter function to store key switch Element.
    * Throws exception, to be overridden by derived class.
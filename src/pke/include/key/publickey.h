@@ -119,6 +119,14 @@ public:
         return this->m_h;
     }
 
+    /**
+   * Gets the computed public key for in-place updates
+   * @return the public key element.
+   */
+    std::vector<Element>& GetPublicElements() {
+        return this->m_h;
+    }
+
     // @Set Properties
 
     /**
@@ -106,6 +106,17 @@ public:
     virtual Element KeySwitchDownFirstElement(ConstCiphertext<Element> ciphertext) const {
         OPENFHE_THROW(config_error, "KeySwitchDownFirstElement is not supported");
     }
+
+    /**
+   * Drops the RNS limbs and digits of an evaluation key that are not needed
+   * for key switching of ciphertexts with "levels" fewer limbs than the key
+   *
+   * @param evalKey evaluation key to be truncated
+   * @param levels the number of RNS limbs to drop
+   */
+    virtual void EvalKeyLevelReduceInPlace(EvalKey<Element> evalKey, size_t levels) const {
+        OPENFHE_THROW(config_error, "EvalKeyLevelReduceInPlace is not supported");
+    }
     /////////////////////////////////////////
     // CORE OPERATIONS
     /////////////////////////////////////////
@@ -75,6 +75,8 @@ public:
 
     void KeySwitchInPlace(Ciphertext<DCRTPoly>& ciphertext, const EvalKey<DCRTPoly> evalKey) const override;
 
+    void EvalKeyLevelReduceInPlace(EvalKey<DCRTPoly> evalKey, size_t levels) const override;
+
     /////////////////////////////////////////
     // CORE OPERATIONS
     /////////////////////////////////////////
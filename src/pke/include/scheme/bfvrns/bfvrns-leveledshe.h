@@ -88,11 +88,33 @@ public:
     Ciphertext<DCRTPoly> EvalMult(ConstCiphertext<DCRTPoly> ciphertext1,
                                   ConstCiphertext<DCRTPoly> ciphertext2) const override;
 
+    /**
+   * Multiplication that reuses the basis extensions computed by
+   * EvalMultPrecompute; nullptr or a precomputation for a different basis
+   * falls back to extending the operand.
+   *
+   * @param ciphertext1 the input ciphertext.
+   * @param ciphertext2 the input ciphertext.
+   * @param precomp1 precomputation for ciphertext1 or nullptr.
+   * @param precomp2 precomputation for ciphertext2 or nullptr.
+   * @return the new ciphertext.
+   */
+    Ciphertext<DCRTPoly> EvalMult(ConstCiphertext<DCRTPoly> ciphertext1, ConstCiphertext<DCRTPoly> ciphertext2,
+                                  std::shared_ptr<std::vector<DCRTPoly>> precomp1,
+                                  std::shared_ptr<std::vector<DCRTPoly>> precomp2) const;
+
+    std::shared_ptr<std::vector<DCRTPoly>> EvalMultPrecompute(ConstCiphertext<DCRTPoly> ciphertext) const override;
+
     Ciphertext<DCRTPoly> EvalSquare(ConstCiphertext<DCRTPoly> ciphertext) const override;
 
     Ciphertext<DCRTPoly> EvalMult(ConstCiphertext<DCRTPoly> ciphertext1, ConstCiphertext<DCRTPoly> ciphertext2,
                                   const EvalKey<DCRTPoly> evalKey) const override;
 
+    Ciphertext<DCRTPoly> EvalMult(ConstCiphertext<DCRTPoly> ciphertext1, ConstCiphertext<DCRTPoly> ciphertext2,
+                                  const std::shared_ptr<std::vector<DCRTPoly>> precomp1,
+                                  const std::shared_ptr<std::vector<DCRTPoly>> precomp2,
+                                  const EvalKey<DCRTPoly> evalKey) const override;
+
     void EvalMultInPlace(Ciphertext<DCRTPoly>& ciphertext1, ConstCiphertext<DCRTPoly> ciphertext2,
                          const EvalKey<DCRTPoly> evalKey) const override;
 
@@ -107,9 +129,10 @@ public:
     // AUTOMORPHISM
     /////////////////////////////////////
 
+    using LeveledSHEBase<DCRTPoly>::EvalAutomorphism;
+
     Ciphertext<DCRTPoly> EvalAutomorphism(ConstCiphertext<DCRTPoly> ciphertext, usint i,
-                                          const std::map<usint, EvalKey<DCRTPoly>>& evalKeyMap,
-                                          CALLER_INFO_ARGS_HDR) const override;
+                                          const EvalKey<DCRTPoly>& evalKey) const override;
 
     Ciphertext<DCRTPoly> EvalFastRotation(ConstCiphertext<DCRTPoly> ciphertext, const usint index, const usint m,
                                           const std::shared_ptr<std::vector<DCRTPoly>> digits) const override;
@@ -35,6 +35,7 @@
 #include "constants.h"
 #include "schemerns/rns-fhe.h"
 #include "scheme/ckksrns/ckksrns-utils.h"
+#include "encoding/ckkspackedencoding.h"
 #include "utils/caller_info.h"
 
 #include <memory>
@@ -109,6 +110,108 @@ public:
 
     // coefficients corresponding to conj(U0^T); used in encoding
     std::vector<std::vector<ConstPlaintext>> m_U0hatTPreFFT;
+
+    template <class Archive>
+    void save(Archive& ar, std::uint32_t const version) const {
+        ar(cereal::make_nvp("d1", m_dim1));
+        ar(cereal::make_nvp("sl", m_slots));
+        ar(cereal::make_nvp("pe", m_paramsEnc));
+        ar(cereal::make_nvp("pd", m_paramsDec));
+        SavePlaintexts(ar, m_U0Pre);
+        SavePlaintexts(ar, m_U0hatTPre);
+        ar(static_cast<uint64_t>(m_U0PreFFT.size()));
+        for (const auto& vec : m_U0PreFFT)
+            SavePlaintexts(ar, vec);
+        ar(static_cast<uint64_t>(m_U0hatTPreFFT.size()));
+        for (const auto& vec : m_U0hatTPreFFT)
+            SavePlaintexts(ar, vec);
+    }
+
+    template <class Archive>
+    void load(Archive& ar, std::uint32_t const version) {
+        if (version > SerializedVersion()) {
+            OPENFHE_THROW(deserialize_error, "serialized object version " + std::to_string(version) +
+                                                 " is from a later version of the library");
+        }
+        ar(cereal::make_nvp("d1", m_dim1));
+        ar(cereal::make_nvp("sl", m_slots));
+        ar(cereal::make_nvp("pe", m_paramsEnc));
+        ar(cereal::make_nvp("pd", m_paramsDec));
+        LoadPlaintexts(ar, m_U0Pre, version);
+        LoadPlaintexts(ar, m_U0hatTPre, version);
+        uint64_t size;
+        ar(size);
+        m_U0PreFFT.resize(size);
+        for (auto& vec : m_U0PreFFT)
+            LoadPlaintexts(ar, vec, version);
+        ar(size);
+        m_U0hatTPreFFT.resize(size);
+        for (auto& vec : m_U0hatTPreFFT)
+            LoadPlaintexts(ar, vec, version);
+    }
+
+    std::string SerializedObjectName() const {
+        return "CKKSBootstrapPrecom";
+    }
+    static uint32_t SerializedVersion() {
+        return 2;
+    }
+
+private:
+    // The auxiliary plaintexts are stored as their encoded elements in the extended basis P*Q together
+    // with the metadata used by EvalMultExt; the cleartext complex values are not kept. Empty entries
+    // (skipped baby-step/giant-step positions) are preserved so that the vector sizes are unchanged.
+    template <class Archive>
+    static void SavePlaintexts(Archive& ar, const std::vector<ConstPlaintext>& plaintexts) {
+        ar(static_cast<uint64_t>(plaintexts.size()));
+        for (const auto& p : plaintexts) {
+            bool exists = (p != nullptr);
+            ar(exists);
+            if (exists) {
+                ar(p->GetEncodingParams(), p->GetElement<DCRTPoly>(), p->GetScalingFactor(),
+                   p->GetScalingFactorInt(), static_cast<uint64_t>(p->GetDepth()),
+                   static_cast<uint64_t>(p->GetLevel()), static_cast<uint32_t>(p->GetSlots()));
+            }
+        }
+    }
+
+    template <class Archive>
+    static void LoadPlaintexts(Archive& ar, std::vector<ConstPlaintext>& plaintexts, std::uint32_t version) {
+        uint64_t size;
+        ar(size);
+        plaintexts.resize(size);
+        for (auto& p : plaintexts) {
+            bool exists;
+            ar(exists);
+            if (!exists) {
+                p = nullptr;
+                continue;
+            }
+            EncodingParams encodingParams;
+            DCRTPoly element;
+            double scalingFactor;
+            NativeInteger scalingFactorInt(1);
+            uint64_t depth;
+            uint64_t level;
+            uint32_t slots;
+            ar(encodingParams, element, scalingFactor);
+            if (version > 1)
+                ar(scalingFactorInt);
+            ar(depth, level, slots);
+
+            // the element is already encoded (and in EVALUATION format), so the plaintext
+            // must not be encoded again from its empty cleartext values
+            auto pt = std::make_shared<CKKSPackedEncoding>(element.GetParams(), encodingParams);
+            pt->GetElement<DCRTPoly>() = std::move(element);
+            pt->SetScalingFactor(scalingFactor);
+            pt->SetScalingFactorInt(scalingFactorInt);
+            pt->SetDepth(depth);
+            pt->SetLevel(level);
+            pt->SetSlots(slots);
+            pt->SetIsEncoded(true);
+            p = pt;
+        }
+    }
 };
 
 class FHECKKSRNS : public FHERNS {
@@ -175,13 +278,15 @@ public:
     //------------------------------------------------------------------------------
 
     void EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::vector<uint32_t> levelBudget,
-                            std::vector<uint32_t> dim1, uint32_t slots) override;
+                            std::vector<uint32_t> dim1, uint32_t slots, const std::string& cacheDir) override;
 
     std::shared_ptr<std::map<usint, EvalKey<DCRTPoly>>> EvalBootstrapKeyGen(const PrivateKey<DCRTPoly> privateKey,
                                                                             uint32_t slots) override;
 
     Ciphertext<DCRTPoly> EvalBootstrap(ConstCiphertext<DCRTPoly> ciphertext) const override;
 
+    std::vector<Ciphertext<DCRTPoly>> EvalBootstrap(const std::vector<Ciphertext<DCRTPoly>>& ciphertexts) const override;
+
     //------------------------------------------------------------------------------
     // Find Rotation Indices
     //------------------------------------------------------------------------------
@@ -262,6 +367,16 @@ private:
 
     void AdjustCiphertext(Ciphertext<DCRTPoly>& ciphertext, double correction) const;
 
+    // description of everything the encoded plaintexts depend on (ring, moduli, scaling factors, level
+    // budget, dim1, slots); its SHA-256 digest names the entry in the on-disk cache, and the entry starts
+    // with the description itself so that a loaded entry is checked against the full parameter set
+    std::string GetBootstrapPrecomCacheKey(const CryptoContextImpl<DCRTPoly>& cc,
+                                           const std::vector<uint32_t>& levelBudget,
+                                           const std::vector<uint32_t>& dim1, uint32_t slots) const;
+
+    // halveResult divides the refreshed message by 2 at no extra level (used by the packed bootstrapping)
+    Ciphertext<DCRTPoly> EvalBootstrapInternal(ConstCiphertext<DCRTPoly> ciphertext, bool halveResult) const;
+
     void ApplyDoubleAngleIterations(Ciphertext<DCRTPoly>& ciphertext) const;
 
     Plaintext MakeAuxPlaintext(const CryptoContextImpl<DCRTPoly>& cc, const std::shared_ptr<ParmType> params,
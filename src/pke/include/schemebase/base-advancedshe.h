@@ -36,6 +36,8 @@
 #include "key/publickey.h"
 #include "key/evalkey.h"
 #include "ciphertext-fwd.h"
+#include "cryptocontext-fwd.h"
+#include "encoding/plaintext-fwd.h"
 #include "utils/exception.h"
 
 #include <memory>
@@ -49,6 +51,33 @@
  */
 namespace lbcrypto {
 
+/**
+ * @brief Precomputed masks for the packed d x d matrix product (Jiang et al., CCS 2018).
+ * Matrices are packed row-major: slot i * d + j holds the entry (i, j).
+ */
+class MatMultPrecom {
+public:
+    MatMultPrecom() {}
+
+    virtual ~MatMultPrecom() {}
+
+    // matrix dimension d; the packing uses d * d slots
+    uint32_t m_dim = 0;
+
+    // sigma permutation: row i is rotated by i (m_sigmaLeft[i], columns j < d - i)
+    // and by i - d (m_sigmaRight[i], columns j >= d - i); m_sigmaRight[0] is unused
+    std::vector<ConstPlaintext> m_sigmaLeft;
+    std::vector<ConstPlaintext> m_sigmaRight;
+
+    // tau permutation: column j is rotated by d * j
+    std::vector<ConstPlaintext> m_tau;
+
+    // column shift by k: rotation by k (m_phiLeft[k], columns j < d - k)
+    // and by k - d (m_phiRight[k], columns j >= d - k); index 0 is unused
+    std::vector<ConstPlaintext> m_phiLeft;
+    std::vector<ConstPlaintext> m_phiRight;
+};
+
 /**
  * @brief Abstract base class for derived HE algorithms
  * @tparam Element a ring element.
@@ -339,6 +368,64 @@ public:
     virtual Ciphertext<Element> EvalMerge(const std::vector<Ciphertext<Element>>& ciphertextVector,
                                           const std::map<usint, EvalKey<Element>>& evalKeyMap) const;
 
+    //------------------------------------------------------------------------------
+    // MATRIX MULTIPLICATION
+    //------------------------------------------------------------------------------
+
+    /**
+   * Precomputes and encodes the masks used by EvalMatMult for d x d matrices
+   * packed row-major into d * d slots.
+   *
+   * @param cc crypto context used to encode the masks.
+   * @param dim matrix dimension d; d * d has to divide the number of slots.
+   */
+    virtual void EvalMatMultSetup(const CryptoContextImpl<Element>& cc, uint32_t dim);
+
+    /**
+   * Returns the rotation indices needed by EvalMatMult for d x d matrices.
+   * The indices are non-negative and reduced modulo d * d.
+   *
+   * @param dim matrix dimension d.
+   * @return vector of rotation indices.
+   */
+    virtual std::vector<int32_t> FindMatMultRotationIndices(uint32_t dim) const;
+
+    /**
+   * Multiplies two encrypted d x d matrices packed row-major into d * d slots
+   * using hoisted rotations. For BFV/BGV the packed matrices have to be
+   * replicated across all slots. Consumes three multiplicative levels.
+   *
+   * @param ciphertext1 encrypted matrix A.
+   * @param ciphertext2 encrypted matrix B.
+   * @param dim matrix dimension d.
+   * @param evalKeyMap rotation keys generated for FindMatMultRotationIndices(dim).
+   * @param evalKeyVec relinearization keys.
+   * @return encryption of A * B.
+   */
+    virtual Ciphertext<Element> EvalMatMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+                                            uint32_t dim, const std::map<usint, EvalKey<Element>>& evalKeyMap,
+                                            const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
+    /**
+   * Multiplies two block matrices whose d x d blocks are encrypted separately
+   * (see EvalMatMult). The permutations of every input block are computed once
+   * and the output blocks are evaluated in parallel.
+   *
+   * @param blocks1 p x q grid of encrypted blocks of A.
+   * @param blocks2 q x r grid of encrypted blocks of B.
+   * @param dim block dimension d.
+   * @param evalKeyMap rotation keys generated for FindMatMultRotationIndices(dim).
+   * @param evalKeyVec relinearization keys.
+   * @return p x r grid of encrypted blocks of A * B.
+   */
+    virtual std::vector<std::vector<Ciphertext<Element>>> EvalMatMultBlocks(
+        const std::vector<std::vector<Ciphertext<Element>>>& blocks1,
+        const std::vector<std::vector<Ciphertext<Element>>>& blocks2, uint32_t dim,
+        const std::map<usint, EvalKey<Element>>& evalKeyMap, const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
+    // precomputed masks for EvalMatMult, keyed by the matrix dimension
+    std::map<uint32_t, std::shared_ptr<MatMultPrecom>> m_matMultPrecomMap;
+
     //------------------------------------------------------------------------------
     // LINEAR TRANSFORMATION
     //------------------------------------------------------------------------------
@@ -367,6 +454,21 @@ protected:
 
     Ciphertext<Element> EvalSum2nComplexCols(ConstCiphertext<Element> ciphertext, usint batchSize, usint m,
                                              const std::map<usint, EvalKey<Element>>& evalKeyMap) const;
+
+    std::shared_ptr<MatMultPrecom> GetMatMultPrecom(ConstCiphertext<Element> ciphertext, uint32_t dim,
+                                                    const std::map<usint, EvalKey<Element>>& evalKeyMap) const;
+
+    // returns phi^k(sigma(A)) for k = 0..d-1
+    std::vector<Ciphertext<Element>> EvalMatMultPermuteLeft(ConstCiphertext<Element> ciphertext,
+                                                            const MatMultPrecom& precom) const;
+
+    // returns psi^k(tau(B)) for k = 0..d-1
+    std::vector<Ciphertext<Element>> EvalMatMultPermuteRight(ConstCiphertext<Element> ciphertext,
+                                                             const MatMultPrecom& precom) const;
+
+    // adds sum_k left[k] * right[k] to result without relinearization
+    void EvalMatMultAccumulate(const std::vector<Ciphertext<Element>>& left,
+                               const std::vector<Ciphertext<Element>>& right, Ciphertext<Element>& result) const;
 };
 
 }  // namespace lbcrypto
@@ -39,6 +39,7 @@
 #include "utils/exception.h"
 
 #include <memory>
+#include <string>
 #include <vector>
 #include <map>
 
@@ -74,9 +75,10 @@ public:
    * @param dim1 - vector of inner dimension in the baby-step giant-step routine
    * for encoding and decoding
    * @param slots - number of slots to be bootstrapped
+   * @param cacheDir - directory of the on-disk cache of precomputations (no caching if empty)
    */
     virtual void EvalBootstrapSetup(const CryptoContextImpl<Element>& cc, std::vector<uint32_t> levelBudget,
-                                    std::vector<uint32_t> dim1, uint32_t slots) {
+                                    std::vector<uint32_t> dim1, uint32_t slots, const std::string& cacheDir) {
         OPENFHE_THROW(not_implemented_error, "Not supported");
     }
 
@@ -102,6 +104,16 @@ public:
     virtual Ciphertext<Element> EvalBootstrap(ConstCiphertext<Element> ciphertext) const {
         OPENFHE_THROW(not_implemented_error, "EvalBootstrap is not implemented for this scheme");
     }
+
+    /**
+   * Defines the bootstrapping evaluation of a vector of ciphertexts encrypting real values
+   *
+   * @param ciphertexts the input ciphertexts.
+   * @return the refreshed ciphertexts in the same order.
+   */
+    virtual std::vector<Ciphertext<Element>> EvalBootstrap(const std::vector<Ciphertext<Element>>& ciphertexts) const {
+        OPENFHE_THROW(not_implemented_error, "EvalBootstrap is not implemented for this scheme");
+    }
 };
 
 }  // namespace lbcrypto
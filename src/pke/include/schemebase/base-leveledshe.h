@@ -459,6 +459,35 @@ public:
     virtual void EvalMultInPlace(Ciphertext<Element>& ciphertext1, ConstCiphertext<Element> ciphertext2,
                                  const EvalKey<Element> evalKey) const;
 
+    /**
+   * Virtual function to extend a ciphertext to the basis used by EvalMult so
+   * that the extension can be reused across multiplications
+   *
+   * @param ciphertext the input ciphertext.
+   * @return the extended elements of the ciphertext
+   */
+    virtual std::shared_ptr<std::vector<Element>> EvalMultPrecompute(ConstCiphertext<Element> ciphertext) const {
+        OPENFHE_THROW(not_implemented_error, "EvalMultPrecompute is not implemented for this scheme");
+    }
+
+    /**
+   * Virtual function for multiplicative homomorphic evaluation of ciphertexts
+   * using the evaluation key and the precomputations of EvalMultPrecompute.
+   *
+   * @param ciphertext1 first input ciphertext.
+   * @param ciphertext2 second input ciphertext.
+   * @param precomp1 precomputation for ciphertext1 or nullptr
+   * @param precomp2 precomputation for ciphertext2 or nullptr
+   * @param evalKey the relinearization key.
+   * @return the new ciphertext.
+   */
+    virtual Ciphertext<Element> EvalMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+                                         const std::shared_ptr<std::vector<Element>> precomp1,
+                                         const std::shared_ptr<std::vector<Element>> precomp2,
+                                         const EvalKey<Element> evalKey) const {
+        OPENFHE_THROW(not_implemented_error, "EvalMult with precomputed operands is not implemented for this scheme");
+    }
+
     /**
    * Virtual function to define the interface for multiplicative homomorphic
    * evaluation of ciphertext using the evaluation key. This is the mutable
@@ -577,6 +606,18 @@ public:
                                                  const std::map<usint, EvalKey<Element>>& evalKeyMap,
                                                  CALLER_INFO_ARGS_HDR) const;
 
+    /**
+   * Virtual function for evaluating automorphism of ciphertext at index i
+   * with the key of that index
+   *
+   * @param ciphertext the input ciphertext.
+   * @param i automorphism index
+   * @param evalKey the evaluation key for index i
+   * @return resulting ciphertext
+   */
+    virtual Ciphertext<Element> EvalAutomorphism(ConstCiphertext<Element> ciphertext, usint i,
+                                                 const EvalKey<Element>& evalKey) const;
+
     /**
    * Virtual function for the automorphism and key switching step of
    * hoisted automorphisms.
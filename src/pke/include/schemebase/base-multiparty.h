@@ -276,6 +276,101 @@ public:
         const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap1,
         const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap2) const;
 
+    /**
+   * Threshold FHE: Adds the public keys of all parties in a single pass.
+   *
+   * @param publicKeyVec public keys of the parties.
+   * @return the new joined key.
+   */
+    virtual PublicKey<Element> MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec) const;
+
+    /**
+   * Threshold FHE: Adds the evaluation keys of all parties in a single pass.
+   *
+   * @param evalKeyVec evaluation keys of the parties.
+   * @return the new joined key.
+   */
+    virtual EvalKey<Element> MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
+    /**
+   * Threshold FHE: Adds the partial evaluation keys for multiplication of all
+   * parties in a single pass.
+   *
+   * @param evalKeyVec evaluation keys of the parties.
+   * @return the new joined key.
+   */
+    virtual EvalKey<Element> MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const;
+
+    /**
+   * Threshold FHE: Adds the automorphism key sets of all parties. Only the
+   * indices present in every set are joined.
+   *
+   * @param evalKeyMapVec automorphism key sets of the parties.
+   * @return the new joined key set.
+   */
+    virtual std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalAutomorphismKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec) const;
+
+    /**
+   * Threshold FHE: Adds the summation key sets of all parties. Only the
+   * indices present in every set are joined.
+   *
+   * @param evalKeyMapVec summation key sets of the parties.
+   * @return the new joined key set.
+   */
+    virtual std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalSumKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec) const;
+
+    /**
+   * Threshold FHE: Accumulates one party's public key into a running sum, so
+   * that shares can be joined as they arrive. An empty accumulator is
+   * initialized with a copy of the share.
+   *
+   * @param publicKeySum running sum; must not be shared with any party.
+   * @param publicKey public key of the next party.
+   */
+    virtual void MultiAddPubKeysInPlace(PublicKey<Element>& publicKeySum, PublicKey<Element> publicKey) const;
+
+    /**
+   * Threshold FHE: Accumulates one party's evaluation key into a running sum.
+   * An empty accumulator is initialized with a copy of the share.
+   *
+   * @param evalKeySum running sum; must not be shared with any party.
+   * @param evalKey evaluation key of the next party.
+   */
+    virtual void MultiAddEvalKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey) const;
+
+    /**
+   * Threshold FHE: Accumulates one party's partial evaluation key for
+   * multiplication into a running sum. An empty accumulator is initialized
+   * with a copy of the share.
+   *
+   * @param evalKeySum running sum; must not be shared with any party.
+   * @param evalKey evaluation key of the next party.
+   */
+    virtual void MultiAddEvalMultKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey) const;
+
+    /**
+   * Threshold FHE: Accumulates one party's automorphism key set into a running
+   * sum. Indices missing from the share are dropped from the sum.
+   *
+   * @param evalKeyMapSum running sum; must not be shared with any party.
+   * @param evalKeyMap automorphism key set of the next party.
+   */
+    virtual void MultiAddEvalAutomorphismKeysInPlace(
+        std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+        const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap) const;
+
+    /**
+   * Threshold FHE: Accumulates one party's summation key set into a running
+   * sum. Indices missing from the share are dropped from the sum.
+   *
+   * @param evalKeyMapSum running sum; must not be shared with any party.
+   * @param evalKeyMap summation key set of the next party.
+   */
+    virtual void MultiAddEvalSumKeysInPlace(std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+                                            const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap) const;
+
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {}
 
@@ -285,6 +380,26 @@ public:
     std::string SerializedObjectName() const {
         return "MultiPartyBase";
     }
+
+protected:
+    /**
+   * Adds size consecutive ring elements from every summand to sum in place.
+   * All (element, tower) pairs are processed in one parallel loop, so the work
+   * is spread over the threads even when only a few elements are added.
+   *
+   * @param *sum first element to accumulate into.
+   * @param size number of elements to accumulate.
+   * @param &summands first elements of the arrays to add.
+   */
+    static void AddElementsInPlace(Element* sum, size_t size, const std::vector<const Element*>& summands);
+
+    /**
+   * Adds the first elements of the partial decryptions.
+   *
+   * @param &ciphertextVec vector of "partial" decryptions.
+   * @return the sum of the first elements.
+   */
+    static Element FusePartialDecryptions(const std::vector<Ciphertext<Element>>& ciphertextVec);
 };
 
 }  // namespace lbcrypto
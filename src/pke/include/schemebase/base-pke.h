@@ -125,6 +125,19 @@ public:
         OPENFHE_THROW(config_error, "Decryption to Poly is not supported");
     }
 
+    /**
+   * Method for decrypting plaintext using LBC, keeping the result in RNS form
+   *
+   * @param &privateKey private key used for decryption.
+   * @param &ciphertext ciphertext id decrypted.
+   * @param *plaintext the plaintext output.
+   * @return the decoding result.
+   */
+    virtual DecryptResult Decrypt(ConstCiphertext<Element> ciphertext, const PrivateKey<Element> privateKey,
+                                  DCRTPoly* plaintext) const {
+        OPENFHE_THROW(config_error, "Decryption to DCRTPoly is not supported");
+    }
+
     /////////////////////////////////////////
     // CORE OPERATIONS
     /////////////////////////////////////////
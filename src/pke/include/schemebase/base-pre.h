@@ -85,6 +85,22 @@ public:
    */
     virtual Ciphertext<Element> ReEncrypt(ConstCiphertext<Element> ciphertext, const EvalKey<Element> evalKey,
                                           const PublicKey<Element> publicKey) const;
+
+    /**
+   * Virtual function to re-encrypt a batch of ciphertexts under the same
+   * re-encryption key. The ciphertexts are distributed over the threads, and
+   * the flooding noise (if publicKey is given) is sampled by the thread that
+   * re-encrypts the ciphertext.
+   *
+   * @param &ciphertextVec the input ciphertexts.
+   * @param &evalKey proxy re-encryption key.
+   * @param publicKey the public key of the recipient of the re-encrypted
+   * ciphertexts.
+   * @return the re-encrypted ciphertexts, in the order of the input.
+   */
+    virtual std::vector<Ciphertext<Element>> ReEncrypt(const std::vector<Ciphertext<Element>>& ciphertextVec,
+                                                       const EvalKey<Element> evalKey,
+                                                       const PublicKey<Element> publicKey) const;
 };
 
 }  // namespace lbcrypto
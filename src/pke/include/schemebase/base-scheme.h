@@ -83,6 +83,16 @@ protected:
         }
     }
 
+    template <typename T>
+    static void CheckMultipartyInputs(const std::vector<T>& inputs, const std::string& name) {
+        if (inputs.empty())
+            OPENFHE_THROW(config_error, "Input " + name + " vector is empty");
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (!inputs[i])
+                OPENFHE_THROW(config_error, "Input " + name + " at index " + std::to_string(i) + " is nullptr");
+        }
+    }
+
 public:
     SchemeBase() {}
 
@@ -243,6 +253,19 @@ public:
         OPENFHE_THROW(config_error, "Decrypt operation has not been enabled");
     }
 
+    virtual DecryptResult Decrypt(ConstCiphertext<Element> ciphertext, const PrivateKey<Element> privateKey,
+                                  DCRTPoly* plaintext) const {
+        if (m_PKE) {
+            if (!ciphertext)
+                OPENFHE_THROW(config_error, "Input ciphertext is nullptr");
+            if (!privateKey)
+                OPENFHE_THROW(config_error, "Input private key is nullptr");
+
+            return m_PKE->Decrypt(ciphertext, privateKey, plaintext);
+        }
+        OPENFHE_THROW(config_error, "Decrypt operation has not been enabled");
+    }
+
     std::shared_ptr<std::vector<Element>> EncryptZeroCore(const PrivateKey<Element> privateKey) const {
         if (m_PKE) {
             if (!privateKey)
@@ -353,6 +376,17 @@ public:
         OPENFHE_THROW(config_error, "KeySwitchInPlace operation has not been enabled");
     }
 
+    virtual void EvalKeyLevelReduceInPlace(EvalKey<Element> evalKey, size_t levels) const {
+        if (m_KeySwitch) {
+            if (!evalKey)
+                OPENFHE_THROW(config_error, "Input evaluation key is nullptr");
+
+            m_KeySwitch->EvalKeyLevelReduceInPlace(evalKey, levels);
+            return;
+        }
+        OPENFHE_THROW(config_error, "EvalKeyLevelReduceInPlace operation has not been enabled");
+    }
+
     virtual Ciphertext<Element> KeySwitchDown(ConstCiphertext<Element> ciphertext) const {
         if (m_KeySwitch) {
             if (!ciphertext)
@@ -451,6 +485,25 @@ public:
         OPENFHE_THROW(config_error, "ReEncrypt operation has not been enabled");
     }
 
+    virtual std::vector<Ciphertext<Element>> ReEncrypt(const std::vector<Ciphertext<Element>>& ciphertextVec,
+                                                       const EvalKey<Element> evalKey,
+                                                       const PublicKey<Element> publicKey) const {
+        if (m_PRE) {
+            for (size_t i = 0; i < ciphertextVec.size(); i++) {
+                if (!ciphertextVec[i])
+                    OPENFHE_THROW(config_error, "Input ciphertext at index " + std::to_string(i) + " is nullptr");
+            }
+            if (!evalKey)
+                OPENFHE_THROW(config_error, "Input evaluation key is nullptr");
+
+            auto result = m_PRE->ReEncrypt(ciphertextVec, evalKey, publicKey);
+            for (auto& ciphertext : result)
+                ciphertext->SetKeyTag(evalKey->GetKeyTag());
+            return result;
+        }
+        OPENFHE_THROW(config_error, "ReEncrypt operation has not been enabled");
+    }
+
     /////////////////////////////////////////
     // SHE NEGATION WRAPPER
     /////////////////////////////////////////
@@ -841,6 +894,33 @@ public:
         OPENFHE_THROW(config_error, "EvalMult operation has not been enabled");
     }
 
+    virtual std::shared_ptr<std::vector<Element>> EvalMultPrecompute(ConstCiphertext<Element> ciphertext) const {
+        if (m_LeveledSHE) {
+            if (!ciphertext)
+                OPENFHE_THROW(config_error, "Input ciphertext is nullptr");
+
+            return m_LeveledSHE->EvalMultPrecompute(ciphertext);
+        }
+        OPENFHE_THROW(config_error, "EvalMultPrecompute operation has not been enabled");
+    }
+
+    virtual Ciphertext<Element> EvalMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+                                         const std::shared_ptr<std::vector<Element>> precomp1,
+                                         const std::shared_ptr<std::vector<Element>> precomp2,
+                                         const EvalKey<Element> evalKey) const {
+        if (m_LeveledSHE) {
+            if (!ciphertext1)
+                OPENFHE_THROW(config_error, "Input first ciphertext is nullptr");
+            if (!ciphertext2)
+                OPENFHE_THROW(config_error, "Input second ciphertext is nullptr");
+            if (!evalKey)
+                OPENFHE_THROW(config_error, "Input evaluation key is nullptr");
+
+            return m_LeveledSHE->EvalMult(ciphertext1, ciphertext2, precomp1, precomp2, evalKey);
+        }
+        OPENFHE_THROW(config_error, "EvalMult operation has not been enabled");
+    }
+
     virtual void EvalMultInPlace(Ciphertext<Element>& ciphertext1, ConstCiphertext<Element> ciphertext2,
                                  const EvalKey<Element> evalKey) const {
         if (m_LeveledSHE) {
@@ -1116,6 +1196,19 @@ public:
         OPENFHE_THROW(config_error, errorMsg);
     }
 
+    virtual Ciphertext<Element> EvalAutomorphism(ConstCiphertext<Element> ciphertext, usint i,
+                                                 const EvalKey<Element>& evalKey) const {
+        if (m_LeveledSHE) {
+            if (!ciphertext)
+                OPENFHE_THROW(config_error, "Input ciphertext is nullptr");
+            if (!evalKey)
+                OPENFHE_THROW(config_error, "Input evaluation key is nullptr");
+
+            return m_LeveledSHE->EvalAutomorphism(ciphertext, i, evalKey);
+        }
+        OPENFHE_THROW(config_error, "EvalAutomorphism operation has not been enabled");
+    }
+
     virtual Ciphertext<Element> EvalFastRotation(ConstCiphertext<Element> ciphertext, const usint index, const usint m,
                                                  const std::shared_ptr<std::vector<Element>> digits) const {
         if (m_LeveledSHE) {
@@ -1683,6 +1776,53 @@ public:
         OPENFHE_THROW(config_error, "EvalMerge operation has not been enabled");
     }
 
+    void EvalMatMultSetup(const CryptoContextImpl<Element>& cc, uint32_t dim) {
+        if (m_AdvancedSHE) {
+            m_AdvancedSHE->EvalMatMultSetup(cc, dim);
+            return;
+        }
+        OPENFHE_THROW(config_error, "EvalMatMultSetup operation has not been enabled");
+    }
+
+    std::vector<int32_t> FindMatMultRotationIndices(uint32_t dim) const {
+        if (m_AdvancedSHE)
+            return m_AdvancedSHE->FindMatMultRotationIndices(dim);
+        OPENFHE_THROW(config_error, "FindMatMultRotationIndices operation has not been enabled");
+    }
+
+    virtual Ciphertext<Element> EvalMatMult(ConstCiphertext<Element> ciphertext1, ConstCiphertext<Element> ciphertext2,
+                                            uint32_t dim, const std::map<usint, EvalKey<Element>>& evalKeyMap,
+                                            const std::vector<EvalKey<Element>>& evalKeyVec) const {
+        if (m_AdvancedSHE) {
+            if (!ciphertext1)
+                OPENFHE_THROW(config_error, "Input first ciphertext is nullptr");
+            if (!ciphertext2)
+                OPENFHE_THROW(config_error, "Input second ciphertext is nullptr");
+            if (!evalKeyMap.size())
+                OPENFHE_THROW(config_error, "Input evaluation key map is empty");
+            if (!evalKeyVec.size())
+                OPENFHE_THROW(config_error, "Input evaluation key vector is empty");
+
+            return m_AdvancedSHE->EvalMatMult(ciphertext1, ciphertext2, dim, evalKeyMap, evalKeyVec);
+        }
+        OPENFHE_THROW(config_error, "EvalMatMult operation has not been enabled");
+    }
+
+    virtual std::vector<std::vector<Ciphertext<Element>>> EvalMatMultBlocks(
+        const std::vector<std::vector<Ciphertext<Element>>>& blocks1,
+        const std::vector<std::vector<Ciphertext<Element>>>& blocks2, uint32_t dim,
+        const std::map<usint, EvalKey<Element>>& evalKeyMap, const std::vector<EvalKey<Element>>& evalKeyVec) const {
+        if (m_AdvancedSHE) {
+            if (!evalKeyMap.size())
+                OPENFHE_THROW(config_error, "Input evaluation key map is empty");
+            if (!evalKeyVec.size())
+                OPENFHE_THROW(config_error, "Input evaluation key vector is empty");
+
+            return m_AdvancedSHE->EvalMatMultBlocks(blocks1, blocks2, dim, evalKeyMap, evalKeyVec);
+        }
+        OPENFHE_THROW(config_error, "EvalMatMultBlocks operation has not been enabled");
+    }
+
     /////////////////////////////////////////
     // MULTIPARTY WRAPPER
     /////////////////////////////////////////
@@ -1945,15 +2085,161 @@ public:
         OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
     }
 
+    virtual PublicKey<Element> MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec,
+                                               const std::string& keyId) {
+        if (m_Multiparty) {
+            CheckMultipartyInputs(publicKeyVec, "public key");
+
+            auto publicKeySum = m_Multiparty->MultiAddPubKeys(publicKeyVec);
+            publicKeySum->SetKeyTag(keyId);
+            return publicKeySum;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual EvalKey<Element> MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                              const std::string& keyId) {
+        if (m_Multiparty) {
+            CheckMultipartyInputs(evalKeyVec, "evaluation key");
+
+            auto evalKeySum = m_Multiparty->MultiAddEvalKeys(evalKeyVec);
+            evalKeySum->SetKeyTag(keyId);
+            return evalKeySum;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual EvalKey<Element> MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec,
+                                                  const std::string& keyId) {
+        if (m_Multiparty) {
+            CheckMultipartyInputs(evalKeyVec, "evaluation key");
+
+            auto evalKeySum = m_Multiparty->MultiAddEvalMultKeys(evalKeyVec);
+            evalKeySum->SetKeyTag(keyId);
+            return evalKeySum;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalAutomorphismKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec,
+        const std::string& keyId) {
+        if (m_Multiparty) {
+            CheckMultipartyInputs(evalKeyMapVec, "evaluation key map");
+
+            auto result = m_Multiparty->MultiAddEvalAutomorphismKeys(evalKeyMapVec);
+            for (auto& key : *result) {
+                if (key.second) {
+                    key.second->SetKeyTag(keyId);
+                }
+            }
+            return result;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual std::shared_ptr<std::map<usint, EvalKey<Element>>> MultiAddEvalSumKeys(
+        const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec,
+        const std::string& keyId) {
+        if (m_Multiparty) {
+            CheckMultipartyInputs(evalKeyMapVec, "evaluation key map");
+
+            auto result = m_Multiparty->MultiAddEvalSumKeys(evalKeyMapVec);
+            for (auto& key : *result) {
+                if (key.second) {
+                    key.second->SetKeyTag(keyId);
+                }
+            }
+            return result;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual void MultiAddPubKeysInPlace(PublicKey<Element>& publicKeySum, PublicKey<Element> publicKey,
+                                        const std::string& keyId) {
+        if (m_Multiparty) {
+            if (!publicKey)
+                OPENFHE_THROW(config_error, "Input public key is nullptr");
+
+            m_Multiparty->MultiAddPubKeysInPlace(publicKeySum, publicKey);
+            publicKeySum->SetKeyTag(keyId);
+            return;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual void MultiAddEvalKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey,
+                                         const std::string& keyId) {
+        if (m_Multiparty) {
+            if (!evalKey)
+                OPENFHE_THROW(config_error, "Input evaluation key is nullptr");
+
+            m_Multiparty->MultiAddEvalKeysInPlace(evalKeySum, evalKey);
+            evalKeySum->SetKeyTag(keyId);
+            return;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual void MultiAddEvalMultKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey,
+                                             const std::string& keyId) {
+        if (m_Multiparty) {
+            if (!evalKey)
+                OPENFHE_THROW(config_error, "Input evaluation key is nullptr");
+
+            m_Multiparty->MultiAddEvalMultKeysInPlace(evalKeySum, evalKey);
+            evalKeySum->SetKeyTag(keyId);
+            return;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual void MultiAddEvalAutomorphismKeysInPlace(std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+                                                     const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap,
+                                                     const std::string& keyId) {
+        if (m_Multiparty) {
+            if (!evalKeyMap)
+                OPENFHE_THROW(config_error, "Input evaluation key map is nullptr");
+
+            m_Multiparty->MultiAddEvalAutomorphismKeysInPlace(evalKeyMapSum, evalKeyMap);
+            for (auto& key : *evalKeyMapSum) {
+                if (key.second) {
+                    key.second->SetKeyTag(keyId);
+                }
+            }
+            return;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
+    virtual void MultiAddEvalSumKeysInPlace(std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+                                            const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap,
+                                            const std::string& keyId) {
+        if (m_Multiparty) {
+            if (!evalKeyMap)
+                OPENFHE_THROW(config_error, "Input evaluation key map is nullptr");
+
+            m_Multiparty->MultiAddEvalSumKeysInPlace(evalKeyMapSum, evalKeyMap);
+            for (auto& key : *evalKeyMapSum) {
+                if (key.second) {
+                    key.second->SetKeyTag(keyId);
+                }
+            }
+            return;
+        }
+        OPENFHE_THROW(config_error, "Multiparty capability has not been enabled");
+    }
+
     // FHE METHODS
 
     // TODO Andrey: do we need this method?
     //  const std::shared_ptr<PKEBase<Element>> getAlgorithm() const { return m_PKE; }
 
     void EvalBootstrapSetup(const CryptoContextImpl<Element>& cc, const std::vector<uint32_t>& levelBudget = {5, 4},
-                            const std::vector<uint32_t>& dim1 = {0, 0}, uint32_t slots = 0) {
+                            const std::vector<uint32_t>& dim1 = {0, 0}, uint32_t slots = 0,
+                            const std::string& cacheDir = "") {
         if (m_FHE) {
-            m_FHE->EvalBootstrapSetup(cc, levelBudget, dim1, slots);
+            m_FHE->EvalBootstrapSetup(cc, levelBudget, dim1, slots, cacheDir);
             return;
         }
 
@@ -1977,6 +2263,21 @@ public:
         OPENFHE_THROW(config_error, "EvalBootstrap operation has not been enabled");
     }
 
+    std::vector<Ciphertext<Element>> EvalBootstrap(const std::vector<Ciphertext<Element>>& ciphertexts) const {
+        if (m_FHE) {
+            if (!ciphertexts.size())
+                OPENFHE_THROW(config_error, "Input ciphertext vector is empty");
+            for (const auto& ciphertext : ciphertexts) {
+                if (!ciphertext)
+                    OPENFHE_THROW(config_error, "Input ciphertext is nullptr");
+            }
+
+            return m_FHE->EvalBootstrap(ciphertexts);
+        }
+
+        OPENFHE_THROW(config_error, "EvalBootstrap operation has not been enabled");
+    }
+
     template <class Archive>
     void save(Archive& ar, std::uint32_t const version) const {
         ar(::cereal::make_nvp("enabled", GetEnabled()));
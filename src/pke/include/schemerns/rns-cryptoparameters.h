@@ -1688,12 +1688,178 @@ public:
         ar(cereal::make_nvp("eb", m_extraBits));
     }
 
+    /**
+   * Serializes the tables computed by PrecomputeCRTTables(). Used by context snapshots to restore
+   * a fully precomputed context without calling PrecomputeCRTTables(); the regular save()/load()
+   * only store the parameters the tables are computed from.
+   */
+    template <class Archive>
+    void SavePrecomputations(Archive& ar) const {
+        const_cast<CryptoParametersRNS*>(this)->SerializePrecomputations(ar);
+    }
+
+    template <class Archive>
+    void LoadPrecomputations(Archive& ar) {
+        SerializePrecomputations(ar);
+    }
+
     std::string SerializedObjectName() const override {
         return "SchemeParametersRNS";
     }
     static uint32_t SerializedVersion() {
         return 1;
     }
+
+private:
+    template <class Archive>
+    void SerializePrecomputations(Archive& ar) {
+        ar(m_tModqPrecon);
+        ar(m_negtInvModq);
+        ar(m_negtInvModqPrecon);
+        ar(m_QlQlInvModqlDivqlModq);
+        ar(m_QlQlInvModqlDivqlModqPrecon);
+        ar(m_qlInvModq);
+        ar(m_qlInvModqPrecon);
+        ar(m_paramsQP);
+        ar(m_PModq);
+        ar(m_PartQHatModq);
+        ar(m_paramsP);
+        ar(m_numPerPartQ);
+        ar(m_paramsPartQ);
+        ar(m_PartQHatInvModq);
+        ar(m_paramsComplPartQ);
+        ar(m_PartQlHatInvModq);
+        ar(m_PartQlHatInvModqPrecon);
+        ar(m_PartQlHatModp);
+        ar(m_PInvModq);
+        ar(m_PInvModqPrecon);
+        ar(m_PHatInvModp);
+        ar(m_PHatInvModpPrecon);
+        ar(m_PHatModq);
+        ar(m_tInvModp);
+        ar(m_tInvModpPrecon);
+        ar(m_scalingFactorsReal);
+        ar(m_scalingFactorsRealBig);
+        ar(m_dmoduliQ);
+        ar(m_approxSF);
+        ar(m_scalingFactorsInt);
+        ar(m_scalingFactorsIntBig);
+        ar(m_qModt);
+        ar(m_fixedSF);
+        ar(m_negQModt);
+        ar(m_negQModtPrecon);
+        ar(m_tInvModq);
+        ar(m_tInvModqPrecon);
+        ar(m_tInvModqr);
+        ar(m_paramsQr);
+        ar(m_negQrModt);
+        ar(m_negQrModtPrecon);
+        ar(m_rInvModq);
+        ar(m_tQHatInvModqDivqFrac);
+        ar(m_tQHatInvModqBDivqFrac);
+        ar(m_tQHatInvModqDivqModt);
+        ar(m_tQHatInvModqDivqModtPrecon);
+        ar(m_tQHatInvModqBDivqModt);
+        ar(m_tQHatInvModqBDivqModtPrecon);
+        ar(m_paramsQl);
+        ar(m_QlQHatInvModqDivqFrac);
+        ar(m_QlQHatInvModqDivqModq);
+        ar(m_paramsRl);
+        ar(m_paramsQlRl);
+        ar(m_QlHatInvModq);
+        ar(m_QlHatInvModqPrecon);
+        ar(m_QlHatModr);
+        ar(m_alphaQlModr);
+        ar(m_qInv);
+        ar(m_tRSHatInvModsDivsFrac);
+        ar(m_tRSHatInvModsDivsModr);
+        ar(m_RlHatInvModr);
+        ar(m_RlHatInvModrPrecon);
+        ar(m_RlHatModq);
+        ar(m_alphaRlModq);
+        ar(m_rInv);
+        ar(m_negRlQHatInvModq);
+        ar(m_negRlQHatInvModqPrecon);
+        ar(m_qInvModr);
+        ar(m_QlHatModq);
+        ar(m_QlHatModqPrecon);
+        ar(m_tQlSlHatInvModsDivsFrac);
+        ar(m_tQlSlHatInvModsDivsModq);
+        ar(m_paramsBsk);
+        ar(m_numq);
+        ar(m_numb);
+        ar(m_mtilde);
+        ar(m_msk);
+        ar(m_moduliQ);
+        ar(m_moduliB);
+        ar(m_rootsBsk);
+        ar(m_moduliBsk);
+        ar(m_mtildeQHatInvModq);
+        ar(m_mtildeQHatInvModqPrecon);
+        ar(m_QHatModbsk);
+        ar(m_qInvModbsk);
+        ar(m_QHatModmtilde);
+        ar(m_QModbsk);
+        ar(m_QModbskPrecon);
+        ar(m_negQInvModmtilde);
+        ar(m_mtildeInvModbsk);
+        ar(m_mtildeInvModbskPrecon);
+        ar(m_tQHatInvModq);
+        ar(m_tQHatInvModqPrecon);
+        ar(m_tgammaQHatInvModq);
+        ar(m_tgammaQHatInvModqPrecon);
+        ar(m_tQInvModbsk);
+        ar(m_tQInvModbskPrecon);
+        ar(m_BHatInvModb);
+        ar(m_BHatInvModbPrecon);
+        ar(m_BHatModmsk);
+        ar(m_BInvModmsk);
+        ar(m_BInvModmskPrecon);
+        ar(m_BHatModq);
+        ar(m_BModq);
+        ar(m_BModqPrecon);
+        ar(m_gamma);
+        ar(m_tgamma);
+        ar(m_negInvqModtgamma);
+        ar(m_negInvqModtgammaPrecon);
+        SerializeBarrettMu(ar, m_modComplPartqBarrettMu);
+        SerializeBarrettMu(ar, m_modqBarrettMu);
+        SerializeBarrettMu(ar, m_modrBarrettMu);
+        SerializeBarrettMu(ar, m_modbskBarrettMu);
+    }
+
+    // cereal does not support 128-bit integers, so the Barrett constants are stored as 64-bit words
+    template <class Archive>
+    static void SerializeBarrettMu(Archive& ar, DoubleNativeInt& mu) {
+        constexpr size_t numWords = (sizeof(DoubleNativeInt) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        uint64_t words[numWords];
+        if (Archive::is_saving::value) {
+            DoubleNativeInt value = mu;
+            for (size_t i = 0; i < numWords; i++) {
+                words[i] = static_cast<uint64_t>(value);
+                value >>= (numWords > 1) ? 64 : 0;
+            }
+        }
+        for (size_t i = 0; i < numWords; i++)
+            ar(words[i]);
+        if (Archive::is_loading::value) {
+            DoubleNativeInt value = 0;
+            for (size_t i = numWords; i > 0; i--) {
+                value <<= (numWords > 1) ? 64 : 0;
+                value |= words[i - 1];
+            }
+            mu = value;
+        }
+    }
+
+    template <class Archive, typename T>
+    static void SerializeBarrettMu(Archive& ar, std::vector<T>& vec) {
+        uint64_t size = vec.size();
+        ar(size);
+        vec.resize(size);
+        for (auto& v : vec)
+            SerializeBarrettMu(ar, v);
+    }
 };
 
 }  // namespace lbcrypto
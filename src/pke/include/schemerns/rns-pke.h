@@ -106,6 +106,18 @@ public:
     DecryptResult Decrypt(ConstCiphertext<DCRTPoly> ciphertext, const PrivateKey<DCRTPoly> privateKey,
                           Poly* plaintext) const override;
 
+    /**
+   * Method for decrypting plaintext using LBC. The result stays in RNS form
+   * (coefficient format), so no multiprecision interpolation is done here.
+   *
+   * @param &privateKey private key used for decryption.
+   * @param &ciphertext ciphertext id decrypted.
+   * @param *plaintext the plaintext output.
+   * @return the decoding result.
+   */
+    DecryptResult Decrypt(ConstCiphertext<DCRTPoly> ciphertext, const PrivateKey<DCRTPoly> privateKey,
+                          DCRTPoly* plaintext) const override;
+
     /////////////////////////////////////
     // CORE OPERATIONS
     /////////////////////////////////////
@@ -0,0 +1,535 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+/*
+  Shared-memory store for the EvalMult, EvalSum and EvalAutomorphism keys of a crypto context.
+  The segment lets worker processes use the keys of one publisher without deserialization;
+  the limbs of the attached keys stay in the segment, so its pages are shared by all workers
+ */
+
+#include "cryptocontext.h"
+#include "key/evalkeyrelin.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define OPENFHE_SHARED_EVALKEYS 1
+#endif
+
+namespace lbcrypto {
+
+namespace {
+/**
+ * A shared EvalKey segment is an array of 64-bit words. The header holds the magic, the version,
+ * the size of the segment in words, the number of words per native integer, the ring dimension and
+ * the moduli of the publishing context, the number of keys and the offsets (in words from the start
+ * of the segment) of all keys. A key record holds its map, index and tag followed by the A and B
+ * vectors; a polynomial holds its format, cyclotomic order and tower parameters followed by the
+ * limbs of all towers. The segment holds no pointers, so it can be mapped at any address.
+ */
+constexpr uint64_t SHARED_EVALKEY_MAGIC   = 0x314d48534b45464f;  // "OFEKSHM1"
+constexpr uint64_t SHARED_EVALKEY_VERSION = 1;
+
+// words per NativeInteger in the segment
+constexpr uint64_t SHARED_EVALKEY_LIMB_WORDS = (sizeof(NativeInteger) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+enum SharedEvalKeyMap : uint64_t {
+    SHARED_EVAL_MULT_KEY = 0,
+    SHARED_EVAL_SUM_KEY,
+    SHARED_EVAL_AUTOMORPHISM_KEY,
+};
+
+template <typename Element>
+struct SharedEvalKey {
+    uint64_t map;
+    std::string keyTag;
+    uint32_t index;
+    EvalKey<Element> key;
+};
+
+template <typename Element>
+uint64_t SharedPolyWords(const Element& poly) {
+    const auto& towers = poly.GetAllElements();
+    uint64_t words     = 3;
+    for (const auto& tower : towers)
+        words += SHARED_EVALKEY_LIMB_WORDS * (4 + tower.GetLength());
+    return words;
+}
+
+template <typename Element>
+uint64_t SharedKeyWords(const SharedEvalKey<Element>& entry) {
+    uint64_t words = 3 + (entry.keyTag.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    for (const auto* vec : {&entry.key->GetAVector(), &entry.key->GetBVector()}) {
+        words += 1;
+        for (const auto& poly : *vec)
+            words += SharedPolyWords(poly);
+    }
+    return words;
+}
+
+// writes words to a segment; the sizes were computed by SharedKeyWords
+class SharedEvalKeyWriter {
+public:
+    explicit SharedEvalKeyWriter(uint64_t* pos) : m_pos(pos) {}
+
+    void Put(uint64_t value) {
+        *m_pos++ = value;
+    }
+
+    void Put(const NativeInteger& value) {
+        std::memcpy(m_pos, &value, sizeof(value));
+        m_pos += SHARED_EVALKEY_LIMB_WORDS;
+    }
+
+    void Put(const std::string& value) {
+        Put(static_cast<uint64_t>(value.size()));
+        std::memcpy(m_pos, value.data(), value.size());
+        m_pos += (value.size() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    }
+
+    template <typename Element>
+    void Put(const Element& poly) {
+        const auto& towers = poly.GetAllElements();
+        Put(static_cast<uint64_t>(poly.GetFormat()));
+        Put(static_cast<uint64_t>(poly.GetCyclotomicOrder()));
+        Put(static_cast<uint64_t>(towers.size()));
+        for (const auto& tower : towers) {
+            const auto& params = *tower.GetParams();
+            Put(params.GetModulus());
+            Put(params.GetRootOfUnity());
+            Put(params.GetBigModulus());
+            Put(params.GetBigRootOfUnity());
+        }
+        for (const auto& tower : towers) {
+            const auto& values = tower.GetValues();
+            if (SHARED_EVALKEY_LIMB_WORDS * sizeof(uint64_t) == sizeof(NativeInteger)) {
+                std::memcpy(m_pos, &values[0], values.GetLength() * sizeof(NativeInteger));
+                m_pos += values.GetLength() * SHARED_EVALKEY_LIMB_WORDS;
+            }
+            else {
+                for (size_t i = 0; i < values.GetLength(); i++)
+                    Put(values[i]);
+            }
+        }
+    }
+
+private:
+    uint64_t* m_pos;
+};
+
+// reads words from a mapped segment, checking that no read goes past its end
+class SharedEvalKeyReader {
+public:
+    SharedEvalKeyReader(const uint64_t* pos, const uint64_t* end) : m_pos(pos), m_end(end) {}
+
+    const uint64_t* Take(uint64_t words) {
+        if (words > static_cast<uint64_t>(m_end - m_pos))
+            OPENFHE_THROW(deserialize_error, "The shared EvalKey segment is truncated");
+        const uint64_t* pos = m_pos;
+        m_pos += words;
+        return pos;
+    }
+
+    uint64_t Get() {
+        return *Take(1);
+    }
+
+    // reads a count of items that take at least minWords words each, so that nothing is
+    // allocated for a count the rest of the segment cannot hold
+    uint64_t GetCount(uint64_t minWords) {
+        uint64_t count = Get();
+        if (count > static_cast<uint64_t>(m_end - m_pos) / minWords)
+            OPENFHE_THROW(deserialize_error, "The shared EvalKey segment is truncated");
+        return count;
+    }
+
+    NativeInteger GetInteger() {
+        NativeInteger value;
+        std::memcpy(static_cast<void*>(&value), Take(SHARED_EVALKEY_LIMB_WORDS), sizeof(value));
+        return value;
+    }
+
+    std::string GetString() {
+        uint64_t size = Get();
+        if (size > static_cast<uint64_t>(m_end - m_pos) * sizeof(uint64_t))
+            OPENFHE_THROW(deserialize_error, "The shared EvalKey segment is truncated");
+        const char* data = reinterpret_cast<const char*>(Take((size + sizeof(uint64_t) - 1) / sizeof(uint64_t)));
+        return std::string(data, size);
+    }
+
+private:
+    const uint64_t* m_pos;
+    const uint64_t* m_end;
+};
+
+#ifdef OPENFHE_SHARED_EVALKEYS
+// a private mapping of a whole segment, unmapped when it goes out of scope. Pages are shared with
+// the segment until they are written; a write copies the page and never reaches the segment
+class SharedEvalKeyMapping {
+public:
+    explicit SharedEvalKeyMapping(const std::string& name) {
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0)
+            OPENFHE_THROW(config_error, "Cannot open the shared EvalKey segment " + name);
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(uint64_t))) {
+            close(fd);
+            OPENFHE_THROW(deserialize_error, "The shared EvalKey segment " + name + " is empty");
+        }
+        m_size = st.st_size;
+        m_data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (m_data == MAP_FAILED)
+            OPENFHE_THROW(config_error, "Cannot map the shared EvalKey segment " + name);
+    }
+
+    ~SharedEvalKeyMapping() {
+        munmap(m_data, m_size);
+    }
+
+    SharedEvalKeyMapping(const SharedEvalKeyMapping&) = delete;
+    SharedEvalKeyMapping& operator=(const SharedEvalKeyMapping&) = delete;
+
+    const uint64_t* begin() const {
+        return static_cast<const uint64_t*>(m_data);
+    }
+
+    const uint64_t* end() const {
+        return begin() + m_size / sizeof(uint64_t);
+    }
+
+    // the words at pos, for values that are used in place
+    uint64_t* Writable(const uint64_t* pos) const {
+        return static_cast<uint64_t*>(m_data) + (pos - begin());
+    }
+
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0;
+};
+#endif
+}  // namespace
+
+template <typename Element>
+bool CryptoContextImpl<Element>::PublishEvalKeysToSharedMemory(const std::string& name,
+                                                               const CryptoContext<Element> cc, bool replace,
+                                                               uint32_t mode) {
+#ifdef OPENFHE_SHARED_EVALKEYS
+    auto snapshot = cc->ReadEvalKeys();
+    std::vector<SharedEvalKey<Element>> entries;
+    for (const auto& k : snapshot->mult) {
+        for (size_t i = 0; i < k.second.size(); i++) {
+            if (k.second[i]->GetCryptoContext() == cc)
+                entries.push_back({SHARED_EVAL_MULT_KEY, k.first, static_cast<uint32_t>(i), k.second[i]});
+        }
+    }
+    for (const auto& keyMap : {std::make_pair(SHARED_EVAL_SUM_KEY, &snapshot->sum),
+                               std::make_pair(SHARED_EVAL_AUTOMORPHISM_KEY, &snapshot->automorphism)}) {
+        for (const auto& k : *keyMap.second) {
+            for (const auto& key : *k.second) {
+                if (key.second->GetCryptoContext() == cc)
+                    entries.push_back({keyMap.first, k.first, key.first, key.second});
+            }
+        }
+    }
+    if (entries.empty())
+        return false;
+
+    const auto& moduli = cc->GetElementParams()->GetParams();
+
+    // header and the offsets of all keys
+    std::vector<uint64_t> offsets(entries.size());
+    uint64_t total = 7 + SHARED_EVALKEY_LIMB_WORDS * moduli.size() + entries.size();
+    for (size_t i = 0; i < entries.size(); i++) {
+        offsets[i] = total;
+        total += SharedKeyWords(entries[i]);
+    }
+
+    // a replaced segment stays mapped by the processes that attached to it
+    if (replace)
+        shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, static_cast<mode_t>(mode));
+    if (fd < 0) {
+        if (errno == EEXIST)
+            OPENFHE_THROW(config_error, "The shared EvalKey segment " + name + " already exists");
+        OPENFHE_THROW(config_error, "Cannot create the shared EvalKey segment " + name);
+    }
+    // the mode passed to shm_open is masked by the umask
+    if (fchmod(fd, static_cast<mode_t>(mode)) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        OPENFHE_THROW(config_error, "Cannot set the permissions of the shared EvalKey segment " + name);
+    }
+    const size_t size = total * sizeof(uint64_t);
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        OPENFHE_THROW(config_error, "Cannot allocate the shared EvalKey segment " + name);
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        OPENFHE_THROW(config_error, "Cannot map the shared EvalKey segment " + name);
+    }
+    uint64_t* segment = static_cast<uint64_t*>(data);
+
+    // the magic is written last, so readers never accept a partially written segment
+    SharedEvalKeyWriter header(segment + 1);
+    header.Put(SHARED_EVALKEY_VERSION);
+    header.Put(total);
+    header.Put(SHARED_EVALKEY_LIMB_WORDS);
+    header.Put(static_cast<uint64_t>(cc->GetRingDimension()));
+    header.Put(static_cast<uint64_t>(moduli.size()));
+    for (const auto& m : moduli)
+        header.Put(m->GetModulus());
+    header.Put(static_cast<uint64_t>(entries.size()));
+    for (auto offset : offsets)
+        header.Put(offset);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < entries.size(); i++) {
+        SharedEvalKeyWriter writer(segment + offsets[i]);
+        writer.Put(entries[i].map);
+        writer.Put(static_cast<uint64_t>(entries[i].index));
+        writer.Put(entries[i].keyTag);
+        for (const auto* vec : {&entries[i].key->GetAVector(), &entries[i].key->GetBVector()}) {
+            writer.Put(static_cast<uint64_t>(vec->size()));
+            for (const auto& poly : *vec)
+                writer.Put(poly);
+        }
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    segment[0] = SHARED_EVALKEY_MAGIC;
+    munmap(data, size);
+    return true;
+#else
+    OPENFHE_THROW(not_available_error, "Shared-memory EvalKey segments require POSIX shared memory");
+#endif
+}
+
+template <typename Element>
+bool CryptoContextImpl<Element>::AttachEvalKeysFromSharedMemory(const std::string& name,
+                                                                const CryptoContext<Element> cc) {
+#ifdef OPENFHE_SHARED_EVALKEYS
+    // the attached keys keep the mapping alive
+    auto mapping = std::make_shared<SharedEvalKeyMapping>(name);
+    SharedEvalKeyReader header(mapping->begin(), mapping->end());
+
+    if (header.Get() != SHARED_EVALKEY_MAGIC)
+        OPENFHE_THROW(deserialize_error, "Not a shared EvalKey segment, or it is not completely published");
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t version = header.Get();
+    if (version > SHARED_EVALKEY_VERSION)
+        OPENFHE_THROW(deserialize_error, "shared EvalKey segment version " + std::to_string(version) +
+                                             " is from a later version of the library");
+    if (header.Get() != static_cast<uint64_t>(mapping->end() - mapping->begin()))
+        OPENFHE_THROW(deserialize_error, "The shared EvalKey segment is truncated");
+    if (header.Get() != SHARED_EVALKEY_LIMB_WORDS)
+        OPENFHE_THROW(deserialize_error, "The shared EvalKey segment was written with a different NATIVE_SIZE");
+
+    const auto& moduli = cc->GetElementParams()->GetParams();
+    bool match         = header.Get() == cc->GetRingDimension() && header.Get() == moduli.size();
+    for (size_t i = 0; match && i < moduli.size(); i++)
+        match = header.GetInteger() == moduli[i]->GetModulus();
+    if (!match)
+        OPENFHE_THROW(config_error, "The shared EvalKey segment was published for different crypto parameters");
+
+    std::vector<SharedEvalKey<Element>> entries(header.GetCount(1));
+    std::vector<uint64_t> offsets(entries.size());
+    for (auto& offset : offsets) {
+        offset = header.Get();
+        if (offset >= static_cast<uint64_t>(mapping->end() - mapping->begin()))
+            OPENFHE_THROW(deserialize_error, "The shared EvalKey segment is truncated");
+    }
+
+    // keys with the same tower parameters share them, as they do after deserialization
+    std::map<std::vector<uint64_t>, std::shared_ptr<typename Element::Params>> paramsCache;
+
+    auto decodePoly = [&](SharedEvalKeyReader& reader) {
+        const uint64_t format = reader.Get();
+        const uint64_t order  = reader.Get();
+        if ((format != EVALUATION && format != COEFFICIENT) || order > std::numeric_limits<usint>::max())
+            OPENFHE_THROW(deserialize_error, "Invalid polynomial in the shared EvalKey segment");
+        const auto towers = reader.GetCount(4 * SHARED_EVALKEY_LIMB_WORDS);
+
+        const uint64_t* paramWords = reader.Take(4 * SHARED_EVALKEY_LIMB_WORDS * towers);
+        std::vector<uint64_t> paramsKey(paramWords, paramWords + 4 * SHARED_EVALKEY_LIMB_WORDS * towers);
+        paramsKey.push_back(order);
+        std::shared_ptr<typename Element::Params> params;
+#pragma omp critical(SharedEvalKeyParams)
+        {
+            auto& cached = paramsCache[paramsKey];
+            if (!cached) {
+                SharedEvalKeyReader paramReader(paramWords, paramWords + paramsKey.size() - 1);
+                std::vector<NativeInteger> q(towers), roots(towers), qBig(towers), rootsBig(towers);
+                bool big = false;
+                for (size_t i = 0; i < towers; i++) {
+                    q[i]        = paramReader.GetInteger();
+                    roots[i]    = paramReader.GetInteger();
+                    qBig[i]     = paramReader.GetInteger();
+                    rootsBig[i] = paramReader.GetInteger();
+                    big         = big || qBig[i] != NativeInteger(0);
+                }
+                cached = big ? std::make_shared<typename Element::Params>(order, q, roots, qBig, rootsBig) :
+                               std::make_shared<typename Element::Params>(order, q, roots);
+            }
+            params = cached;
+        }
+
+        Element poly(params, static_cast<Format>(format), false);
+        const auto& towerParams = params->GetParams();
+        for (size_t i = 0; i < towers; i++) {
+            const uint64_t n      = towerParams[i]->GetRingDimension();
+            const uint64_t* limbs = reader.Take(n * SHARED_EVALKEY_LIMB_WORDS);
+            NativeVector values;
+            if (SHARED_EVALKEY_LIMB_WORDS * sizeof(uint64_t) == sizeof(NativeInteger) &&
+                reinterpret_cast<uintptr_t>(limbs) % alignof(NativeInteger) == 0) {
+                // the limbs are used in place
+                values = NativeVector(reinterpret_cast<NativeInteger*>(mapping->Writable(limbs)), n,
+                                      towerParams[i]->GetModulus(), mapping);
+            }
+            else {
+                values = NativeVector(n, towerParams[i]->GetModulus());
+                SharedEvalKeyReader limbReader(limbs, limbs + n * SHARED_EVALKEY_LIMB_WORDS);
+                for (size_t j = 0; j < n; j++)
+                    values[j] = limbReader.GetInteger();
+            }
+            typename Element::PolyType tower(towerParams[i], static_cast<Format>(format), false);
+            tower.SetValues(std::move(values), static_cast<Format>(format));
+            poly.SetElementAtIndex(i, std::move(tower));
+        }
+        return poly;
+    };
+
+    auto decode = [&](size_t i) {
+        SharedEvalKeyReader reader(mapping->begin() + offsets[i], mapping->end());
+        entries[i].map    = reader.Get();
+        entries[i].index  = static_cast<uint32_t>(reader.Get());
+        entries[i].keyTag = reader.GetString();
+        if (entries[i].map > SHARED_EVAL_AUTOMORPHISM_KEY)
+            OPENFHE_THROW(deserialize_error, "Unknown key map in the shared EvalKey segment");
+        // EvalMult keys are stored in a vector indexed by the key index
+        if (entries[i].map == SHARED_EVAL_MULT_KEY && entries[i].index >= entries.size())
+            OPENFHE_THROW(deserialize_error, "Invalid EvalMult key index in the shared EvalKey segment");
+
+        auto key = std::make_shared<EvalKeyRelinImpl<Element>>(cc);
+        key->SetKeyTag(entries[i].keyTag);
+        // a polynomial takes at least its format, order and number of towers
+        std::vector<Element> a(reader.GetCount(3));
+        for (auto& poly : a)
+            poly = decodePoly(reader);
+        std::vector<Element> b(reader.GetCount(3));
+        for (auto& poly : b)
+            poly = decodePoly(reader);
+        key->SetAVector(std::move(a));
+        key->SetBVector(std::move(b));
+        entries[i].key = key;
+    };
+
+    std::exception_ptr error;
+#pragma omp parallel for schedule(dynamic)
+    for (size_t i = 0; i < entries.size(); i++) {
+        try {
+            decode(i);
+        }
+        catch (...) {
+#pragma omp critical
+            error = std::current_exception();
+        }
+    }
+    if (error)
+        std::rethrow_exception(error);
+
+    std::map<std::string, std::vector<EvalKey<Element>>> evalMultKeyMap;
+    std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> evalSumKeyMap;
+    std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> evalAutomorphismKeyMap;
+    for (auto& entry : entries) {
+        if (entry.map == SHARED_EVAL_MULT_KEY) {
+            auto& keys = evalMultKeyMap[entry.keyTag];
+            if (keys.size() <= entry.index)
+                keys.resize(entry.index + 1);
+            keys[entry.index] = std::move(entry.key);
+        }
+        else {
+            auto& keys = (entry.map == SHARED_EVAL_SUM_KEY ? evalSumKeyMap : evalAutomorphismKeyMap)[entry.keyTag];
+            if (!keys)
+                keys = std::make_shared<std::map<usint, EvalKey<Element>>>();
+            (*keys)[entry.index] = std::move(entry.key);
+        }
+    }
+
+    cc->m_evalKeyRegistry->Modify([&](auto& keys) {
+        for (auto& k : evalMultKeyMap)
+            keys.mult[k.first] = std::move(k.second);
+        for (auto& k : evalSumKeyMap)
+            keys.sum[k.first] = std::move(k.second);
+        for (auto& k : evalAutomorphismKeyMap)
+            keys.automorphism[k.first] = std::move(k.second);
+    });
+    return true;
+#else
+    OPENFHE_THROW(not_available_error, "Shared-memory EvalKey segments require POSIX shared memory");
+#endif
+}
+
+template <typename Element>
+void CryptoContextImpl<Element>::RemoveEvalKeysFromSharedMemory(const std::string& name) {
+#ifdef OPENFHE_SHARED_EVALKEYS
+    shm_unlink(name.c_str());
+#else
+    OPENFHE_THROW(not_available_error, "Shared-memory EvalKey segments require POSIX shared memory");
+#endif
+}
+
+template bool CryptoContextImpl<DCRTPoly>::PublishEvalKeysToSharedMemory(const std::string& name,
+                                                                         const CryptoContext<DCRTPoly> cc,
+                                                                         bool replace, uint32_t mode);
+template bool CryptoContextImpl<DCRTPoly>::AttachEvalKeysFromSharedMemory(const std::string& name,
+                                                                          const CryptoContext<DCRTPoly> cc);
+template void CryptoContextImpl<DCRTPoly>::RemoveEvalKeysFromSharedMemory(const std::string& name);
+
+}  // namespace lbcrypto
@@ -36,6 +36,11 @@
 #include "cryptocontext.h"
 #include "schemerns/rns-scheme.h"
 #include "scheme/ckksrns/ckksrns-cryptoparameters.h"
+#include "key/evalkeyrelin.h"
+#include "utils/parallel.h"
+
+#include <exception>
+#include <thread>
 
 namespace lbcrypto {
 
@@ -67,7 +72,7 @@ void CryptoContextImpl<Element>::EvalMultKeyGen(const PrivateKey<Element> key) {
 
     EvalKey<Element> k = GetScheme()->EvalMultKeyGen(key);
 
-    GetAllEvalMultKeys()[k->GetKeyTag()] = {k};
+    m_evalKeyRegistry->Modify([&](auto& keys) { keys.mult[k->GetKeyTag()] = {k}; });
 }
 
 template <typename Element>
@@ -79,27 +84,63 @@ void CryptoContextImpl<Element>::EvalMultKeysGen(const PrivateKey<Element> key)
 
     const std::vector<EvalKey<Element>>& evalKeys = GetScheme()->EvalMultKeysGen(key);
 
-    GetAllEvalMultKeys()[evalKeys[0]->GetKeyTag()] = evalKeys;
+    m_evalKeyRegistry->Modify([&](auto& keys) { keys.mult[evalKeys[0]->GetKeyTag()] = evalKeys; });
 }
 
 template <typename Element>
-const std::vector<EvalKey<Element>>& CryptoContextImpl<Element>::GetEvalMultKeyVector(const std::string& keyID) {
-    auto ekv = GetAllEvalMultKeys().find(keyID);
-    if (ekv == GetAllEvalMultKeys().end())
+std::shared_ptr<const std::vector<EvalKey<Element>>> CryptoContextImpl<Element>::GetEvalMultKeyVectorPtr(
+    const std::string& keyID) {
+    std::shared_ptr<const std::vector<EvalKey<Element>>> found;
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys  = registry->Read();
+        auto entry = keys->Find(keyID);
+        if (entry != nullptr && (*entry)->mult != nullptr)
+            found = (*entry)->mult;
+        return found != nullptr;
+    });
+    if (found == nullptr)
         OPENFHE_THROW(not_available_error,
                       "You need to use EvalMultKeyGen so that you have an "
                       "EvalMultKey available for this ID");
-    return ekv->second;
+    return found;
+}
+
+template <typename Element>
+const std::vector<EvalKey<Element>>& CryptoContextImpl<Element>::GetEvalMultKeyVector(const std::string& keyID) {
+    // the vector is held by the registry until the keys of the tag change
+    return *GetEvalMultKeyVectorPtr(keyID);
+}
+
+template <typename Element>
+std::vector<EvalKey<Element>> CryptoContextImpl<Element>::GetEvalMultKeyVectorCopy(const std::string& keyID) {
+    return *GetEvalMultKeyVectorPtr(keyID);
+}
+
+template <typename Element>
+std::shared_ptr<const std::map<std::string, std::vector<EvalKey<Element>>>>
+CryptoContextImpl<Element>::GetAllEvalMultKeysPtr() {
+    auto all = std::make_shared<std::map<std::string, std::vector<EvalKey<Element>>>>();
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys = registry->Read();
+        all->insert(keys->mult.begin(), keys->mult.end());
+        return false;
+    });
+    return all;
 }
 
 template <typename Element>
 std::map<std::string, std::vector<EvalKey<Element>>>& CryptoContextImpl<Element>::GetAllEvalMultKeys() {
-    return evalMultKeyMap();
+    thread_local std::map<std::string, std::vector<EvalKey<Element>>> t_evalMultKeys;
+    t_evalMultKeys = *GetAllEvalMultKeysPtr();
+    return t_evalMultKeys;
 }
 
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalMultKeys() {
-    GetAllEvalMultKeys().clear();
+    EvalKeyRegistry<Element>::ForEach([](const auto& registry) {
+        registry->Modify([](auto& keys) { keys.mult.clear(); });
+        return false;
+    });
 }
 
 /**
@@ -108,9 +149,11 @@ void CryptoContextImpl<Element>::ClearEvalMultKeys() {
  */
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalMultKeys(const std::string& id) {
-    auto kd = GetAllEvalMultKeys().find(id);
-    if (kd != GetAllEvalMultKeys().end())
-        GetAllEvalMultKeys().erase(kd);
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        if (registry->Read()->mult.count(id))
+            registry->Modify([&](auto& keys) { keys.mult.erase(id); });
+        return false;
+    });
 }
 
 /**
@@ -119,19 +162,23 @@ void CryptoContextImpl<Element>::ClearEvalMultKeys(const std::string& id) {
  */
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalMultKeys(const CryptoContext<Element> cc) {
-    for (auto it = GetAllEvalMultKeys().begin(); it != GetAllEvalMultKeys().end();) {
-        if (it->second[0]->GetCryptoContext() == cc) {
-            it = GetAllEvalMultKeys().erase(it);
-        }
-        else {
-            ++it;
+    cc->m_evalKeyRegistry->Modify([&](auto& keys) {
+        for (auto it = keys.mult.begin(); it != keys.mult.end();) {
+            if (it->second[0]->GetCryptoContext() == cc) {
+                it = keys.mult.erase(it);
+            }
+            else {
+                ++it;
+            }
         }
-    }
+    });
 }
 
 template <typename Element>
 void CryptoContextImpl<Element>::InsertEvalMultKey(const std::vector<EvalKey<Element>>& vectorToInsert) {
-    GetAllEvalMultKeys()[vectorToInsert[0]->GetKeyTag()] = vectorToInsert;
+    GetEvalKeyRegistry(vectorToInsert[0]).Modify([&](auto& keys) {
+        keys.mult[vectorToInsert[0]->GetKeyTag()] = vectorToInsert;
+    });
 }
 
 /////////////////////////////////////////
@@ -153,7 +200,7 @@ void CryptoContextImpl<Element>::EvalSumKeyGen(const PrivateKey<Element> private
 
     auto evalKeys = GetScheme()->EvalSumKeyGen(privateKey, publicKey);
 
-    GetAllEvalSumKeys()[privateKey->GetKeyTag()] = evalKeys;
+    m_evalKeyRegistry->Modify([&](auto& keys) { keys.sum[privateKey->GetKeyTag()] = evalKeys; });
 }
 
 template <typename Element>
@@ -193,24 +240,55 @@ std::shared_ptr<std::map<usint, EvalKey<Element>>> CryptoContextImpl<Element>::E
 }
 
 template <typename Element>
-const std::map<usint, EvalKey<Element>>& CryptoContextImpl<Element>::GetEvalSumKeyMap(const std::string& keyID) {
-    auto ekv = GetAllEvalSumKeys().find(keyID);
-    if (ekv == GetAllEvalSumKeys().end())
+std::shared_ptr<const std::map<usint, EvalKey<Element>>> CryptoContextImpl<Element>::GetEvalSumKeyMapPtr(
+    const std::string& keyID) {
+    std::shared_ptr<const std::map<usint, EvalKey<Element>>> found;
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys  = registry->Read();
+        auto entry = keys->Find(keyID);
+        if (entry != nullptr && (*entry)->sum != nullptr)
+            found = (*entry)->sum;
+        return found != nullptr;
+    });
+    if (found == nullptr)
         OPENFHE_THROW(not_available_error,
                       "You need to use EvalSumKeyGen so that you have EvalSumKeys "
                       "available for this ID");
-    return *ekv->second;
+    return found;
+}
+
+template <typename Element>
+const std::map<usint, EvalKey<Element>>& CryptoContextImpl<Element>::GetEvalSumKeyMap(const std::string& keyID) {
+    // the map is held by the registry until the keys of the tag change
+    return *GetEvalSumKeyMapPtr(keyID);
+}
+
+template <typename Element>
+std::shared_ptr<const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>
+CryptoContextImpl<Element>::GetAllEvalSumKeysPtr() {
+    auto all = std::make_shared<std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>();
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys = registry->Read();
+        all->insert(keys->sum.begin(), keys->sum.end());
+        return false;
+    });
+    return all;
 }
 
 template <typename Element>
 std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>&
 CryptoContextImpl<Element>::GetAllEvalSumKeys() {
-    return evalSumKeyMap();
+    thread_local std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> t_evalSumKeys;
+    t_evalSumKeys = *GetAllEvalSumKeysPtr();
+    return t_evalSumKeys;
 }
 
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalSumKeys() {
-    GetAllEvalSumKeys().clear();
+    EvalKeyRegistry<Element>::ForEach([](const auto& registry) {
+        registry->Modify([](auto& keys) { keys.sum.clear(); });
+        return false;
+    });
 }
 
 /**
@@ -219,9 +297,11 @@ void CryptoContextImpl<Element>::ClearEvalSumKeys() {
  */
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalSumKeys(const std::string& id) {
-    auto kd = GetAllEvalSumKeys().find(id);
-    if (kd != GetAllEvalSumKeys().end())
-        GetAllEvalSumKeys().erase(kd);
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        if (registry->Read()->sum.count(id))
+            registry->Modify([&](auto& keys) { keys.sum.erase(id); });
+        return false;
+    });
 }
 
 /**
@@ -230,14 +310,16 @@ void CryptoContextImpl<Element>::ClearEvalSumKeys(const std::string& id) {
  */
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalSumKeys(const CryptoContext<Element> cc) {
-    for (auto it = GetAllEvalSumKeys().begin(); it != GetAllEvalSumKeys().end();) {
-        if (it->second->begin()->second->GetCryptoContext() == cc) {
-            it = GetAllEvalSumKeys().erase(it);
-        }
-        else {
-            ++it;
+    cc->m_evalKeyRegistry->Modify([&](auto& keys) {
+        for (auto it = keys.sum.begin(); it != keys.sum.end();) {
+            if (it->second->begin()->second->GetCryptoContext() == cc) {
+                it = keys.sum.erase(it);
+            }
+            else {
+                ++it;
+            }
         }
-    }
+    });
 }
 
 template <typename Element>
@@ -245,8 +327,10 @@ void CryptoContextImpl<Element>::InsertEvalSumKey(
     const std::shared_ptr<std::map<usint, EvalKey<Element>>> mapToInsert) {
     // find the tag
     if (!mapToInsert->empty()) {
-        auto onekey                                      = mapToInsert->begin();
-        GetAllEvalSumKeys()[onekey->second->GetKeyTag()] = mapToInsert;
+        auto onekey = mapToInsert->begin();
+        GetEvalKeyRegistry(onekey->second).Modify([&](auto& keys) {
+            keys.sum[onekey->second->GetKeyTag()] = mapToInsert;
+        });
     }
 }
 
@@ -258,6 +342,14 @@ template <typename Element>
 void CryptoContextImpl<Element>::EvalAtIndexKeyGen(const PrivateKey<Element> privateKey,
                                                    const std::vector<int32_t>& indexList,
                                                    const PublicKey<Element> publicKey) {
+    EvalAtIndexKeyGen(privateKey, indexList, std::vector<uint32_t>(indexList.size(), 0), publicKey);
+}
+
+template <typename Element>
+void CryptoContextImpl<Element>::EvalAtIndexKeyGen(const PrivateKey<Element> privateKey,
+                                                   const std::vector<int32_t>& indexList,
+                                                   const std::vector<uint32_t>& levels,
+                                                   const PublicKey<Element> publicKey) {
     if (privateKey == nullptr || Mismatched(privateKey->GetCryptoContext())) {
         OPENFHE_THROW(config_error,
                       "Private key passed to EvalAtIndexKeyGen were not generated "
@@ -268,48 +360,208 @@ void CryptoContextImpl<Element>::EvalAtIndexKeyGen(const PrivateKey<Element> pri
         OPENFHE_THROW(config_error, "Public key passed to EvalAtIndexKeyGen does not match private key");
     }
 
+    if (levels.size() != indexList.size()) {
+        OPENFHE_THROW(config_error, "EvalAtIndexKeyGen needs one level per index");
+    }
+
     auto evalKeys = GetScheme()->EvalAtIndexKeyGen(publicKey, privateKey, indexList);
 
-    auto ekv = GetAllEvalAutomorphismKeys().find(privateKey->GetKeyTag());
-    if (ekv == GetAllEvalAutomorphismKeys().end()) {
-        GetAllEvalAutomorphismKeys()[privateKey->GetKeyTag()] = evalKeys;
+    // Several indices can map to the same automorphism; such a key has to
+    // support the highest of their levels (the one with the most limbs)
+    std::map<usint, uint32_t> keyLevels;
+    for (size_t i = 0; i < indexList.size(); i++) {
+        usint autoIndex = FindAutomorphismIndex(indexList[i]);
+        auto it         = keyLevels.find(autoIndex);
+        if (it == keyLevels.end())
+            keyLevels[autoIndex] = levels[i];
+        else
+            it->second = std::min(it->second, levels[i]);
     }
-    else {
-        auto& currRotMap = GetEvalAutomorphismKeyMap(privateKey->GetKeyTag());
-        auto iterRowKeys = evalKeys->begin();
-        while (iterRowKeys != evalKeys->end()) {
-            auto idx = iterRowKeys->first;
-            // Search current rotation key map and add key
-            // only if it doesn't exist
-            if (currRotMap.find(idx) == currRotMap.end()) {
-                currRotMap.insert(*iterRowKeys);
-            }
-            iterRowKeys++;
-        }
+    for (const auto& keyLevel : keyLevels) {
+        if (keyLevel.second > 0)
+            GetScheme()->EvalKeyLevelReduceInPlace(evalKeys->at(keyLevel.first), keyLevel.second);
     }
 
-    //  evalAutomorphismKeyMap()[privateKey->GetKeyTag()] = evalKeys;
+    MergeEvalAutomorphismKeys(evalKeys, privateKey->GetKeyTag());
+}
+
+template <typename Element>
+void CryptoContextImpl<Element>::MergeEvalAutomorphismKeys(
+    const std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeys, const std::string& keyTag) {
+    m_evalKeyRegistry->Modify([&](auto& keys) {
+        auto ekv = keys.automorphism.find(keyTag);
+        if (ekv == keys.automorphism.end()) {
+            keys.automorphism[keyTag] = evalKeys;
+            return;
+        }
+
+        // a key already present is replaced only by a key with more towers,
+        // e.g. a level-reduced rotation key by a full bootstrapping key; the
+        // merged map replaces the current one so that readers holding the
+        // current map are not affected
+        auto merged = std::make_shared<std::map<usint, EvalKey<Element>>>(*ekv->second);
+        for (const auto& key : *evalKeys) {
+            auto it = merged->find(key.first);
+            if (it == merged->end())
+                merged->insert(key);
+            else if (key.second->GetBVector()[0].GetNumOfElements() >
+                     it->second->GetBVector()[0].GetNumOfElements())
+                it->second = key.second;
+        }
+        ekv->second = std::move(merged);
+    });
+}
+
+template <typename Element>
+std::shared_ptr<const std::map<usint, EvalKey<Element>>> CryptoContextImpl<Element>::GetEvalAutomorphismKeyMapPtr(
+    const std::string& keyID) {
+    std::shared_ptr<const std::map<usint, EvalKey<Element>>> found;
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys  = registry->Read();
+        auto entry = keys->Find(keyID);
+        if (entry != nullptr && (*entry)->automorphism != nullptr)
+            found = (*entry)->GetAutomorphismKeys().GetMap();
+        return found != nullptr;
+    });
+    if (found == nullptr)
+        OPENFHE_THROW(not_available_error,
+                      "You need to use EvalAutomorphismKeyGen so that you have "
+                      "EvalAutomorphismKeys available for this ID");
+    return found;
 }
 
 template <typename Element>
 std::map<usint, EvalKey<Element>>& CryptoContextImpl<Element>::GetEvalAutomorphismKeyMap(const std::string& keyID) {
-    auto ekv = evalAutomorphismKeyMap().find(keyID);
-    if (ekv == evalAutomorphismKeyMap().end())
+    std::shared_ptr<std::map<usint, EvalKey<Element>>> found;
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys  = registry->Read();
+        auto entry = keys->Find(keyID);
+        if (entry != nullptr && (*entry)->automorphism != nullptr) {
+            // the caller may change the map in place, so lookups stop using
+            // the index table of the tag and its NUMA copies
+            (*entry)->automorphism->MarkModified();
+            found = (*entry)->automorphism->GetMap();
+        }
+        return found != nullptr;
+    });
+    if (found == nullptr)
         OPENFHE_THROW(not_available_error,
                       "You need to use EvalAutomorphismKeyGen so that you have "
                       "EvalAutomorphismKeys available for this ID");
-    return *ekv->second;
+    // the map is held by the registry until the keys of the tag change
+    return *found;
+}
+
+template <typename Element>
+void CryptoContextImpl<Element>::ReplicateEvalAutomorphismKeysPerNumaNode(const std::string& id) {
+    std::vector<std::pair<std::shared_ptr<EvalKeyRegistry<Element>>,
+                          std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>>
+        sources;
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys = registry->Read();
+        std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> tags;
+        for (const auto& k : keys->automorphism) {
+            if (id.length() == 0 || k.first == id)
+                tags.insert(k);
+        }
+        if (!tags.empty())
+            sources.emplace_back(registry, std::move(tags));
+        return false;
+    });
+    if (id.length() != 0 && sources.empty())
+        OPENFHE_THROW(not_available_error,
+                      "You need to use EvalAutomorphismKeyGen so that you have "
+                      "EvalAutomorphismKeys available for this ID");
+
+    int numNodes = ParallelControls::GetNumaNodes();
+    if (numNodes < 2)
+        return;
+
+    // the keys are copied by one thread per node, pinned to that node, so
+    // that the pages of every copy are first touched on its node
+    std::vector<std::map<std::string, typename EvalKeyRegistry<Element>::Replicas>> replicas(sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        for (const auto& k : sources[i].second) {
+            replicas[i][k.first].source = k.second;
+            replicas[i][k.first].nodes.resize(numNodes);
+        }
+    }
+    std::vector<std::exception_ptr> errors(numNodes);
+    std::vector<std::thread> threads;
+    for (int node = 0; node < numNodes; node++) {
+        threads.emplace_back([&, node]() {
+            try {
+                ParallelControls::PinCurrentThreadToNumaNode(node);
+                for (auto& tags : replicas) {
+                    for (auto& r : tags) {
+                        auto copy = std::make_shared<std::map<usint, EvalKey<Element>>>();
+                        for (const auto& key : *r.second.source) {
+                            auto relinKey = std::dynamic_pointer_cast<EvalKeyRelinImpl<Element>>(key.second);
+                            (*copy)[key.first] =
+                                relinKey ? std::make_shared<EvalKeyRelinImpl<Element>>(*relinKey) : key.second;
+                        }
+                        r.second.nodes[node] = std::move(copy);
+                    }
+                }
+            }
+            catch (...) {
+                errors[node] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    for (size_t i = 0; i < sources.size(); i++) {
+        sources[i].first->Modify([&](auto& keys) {
+            for (auto& r : replicas[i])
+                keys.replicas[r.first] = std::move(r.second);
+        });
+    }
+}
+
+template <typename Element>
+void CryptoContextImpl<Element>::ClearEvalAutomorphismKeyReplicas() {
+    EvalKeyRegistry<Element>::ForEach([](const auto& registry) {
+        if (!registry->Read()->replicas.empty())
+            registry->Modify([](auto& keys) { keys.replicas.clear(); });
+        return false;
+    });
+}
+
+template <typename Element>
+std::shared_ptr<const std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>
+CryptoContextImpl<Element>::GetAllEvalAutomorphismKeysPtr() {
+    auto all = std::make_shared<std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>>();
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        auto keys = registry->Read();
+        all->insert(keys->automorphism.begin(), keys->automorphism.end());
+        return false;
+    });
+    return all;
 }
 
 template <typename Element>
 std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>>&
 CryptoContextImpl<Element>::GetAllEvalAutomorphismKeys() {
-    return evalAutomorphismKeyMap();
+    thread_local std::map<std::string, std::shared_ptr<std::map<usint, EvalKey<Element>>>> t_evalAutomorphismKeys;
+    t_evalAutomorphismKeys = *GetAllEvalAutomorphismKeysPtr();
+    return t_evalAutomorphismKeys;
 }
 
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalAutomorphismKeys() {
-    evalAutomorphismKeyMap().clear();
+    EvalKeyRegistry<Element>::ForEach([](const auto& registry) {
+        registry->Modify([](auto& keys) {
+            keys.automorphism.clear();
+            keys.replicas.clear();
+        });
+        return false;
+    });
 }
 
 /**
@@ -318,9 +570,15 @@ void CryptoContextImpl<Element>::ClearEvalAutomorphismKeys() {
  */
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalAutomorphismKeys(const std::string& id) {
-    auto kd = evalAutomorphismKeyMap().find(id);
-    if (kd != evalAutomorphismKeyMap().end())
-        evalAutomorphismKeyMap().erase(kd);
+    EvalKeyRegistry<Element>::ForEach([&](const auto& registry) {
+        if (registry->Read()->automorphism.count(id)) {
+            registry->Modify([&](auto& keys) {
+                keys.automorphism.erase(id);
+                keys.replicas.erase(id);
+            });
+        }
+        return false;
+    });
 }
 
 /**
@@ -330,22 +588,27 @@ void CryptoContextImpl<Element>::ClearEvalAutomorphismKeys(const std::string& id
  */
 template <typename Element>
 void CryptoContextImpl<Element>::ClearEvalAutomorphismKeys(const CryptoContext<Element> cc) {
-    for (auto it = evalAutomorphismKeyMap().begin(); it != evalAutomorphismKeyMap().end();) {
-        if (it->second->begin()->second->GetCryptoContext() == cc) {
-            it = evalAutomorphismKeyMap().erase(it);
-        }
-        else {
-            ++it;
+    cc->m_evalKeyRegistry->Modify([&](auto& keys) {
+        for (auto it = keys.automorphism.begin(); it != keys.automorphism.end();) {
+            if (it->second->begin()->second->GetCryptoContext() == cc) {
+                keys.replicas.erase(it->first);
+                it = keys.automorphism.erase(it);
+            }
+            else {
+                ++it;
+            }
         }
-    }
+    });
 }
 
 template <typename Element>
 void CryptoContextImpl<Element>::InsertEvalAutomorphismKey(
     const std::shared_ptr<std::map<usint, EvalKey<Element>>> mapToInsert) {
     // find the tag
-    auto onekey                                           = mapToInsert->begin();
-    evalAutomorphismKeyMap()[onekey->second->GetKeyTag()] = mapToInsert;
+    auto onekey = mapToInsert->begin();
+    GetEvalKeyRegistry(onekey->second).Modify([&](auto& keys) {
+        keys.automorphism[onekey->second->GetKeyTag()] = mapToInsert;
+    });
 }
 
 template <typename Element>
@@ -355,8 +618,8 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalSum(ConstCiphertext<Element>
                       "Information passed to EvalSum was not generated with this "
                       "crypto context");
 
-    auto evalSumKeys = CryptoContextImpl<Element>::GetEvalSumKeyMap(ciphertext->GetKeyTag());
-    auto rv          = GetScheme()->EvalSum(ciphertext, batchSize, evalSumKeys);
+    auto keys = ReadEvalKeys();
+    auto rv   = GetScheme()->EvalSum(ciphertext, batchSize, keys.GetSumKeys(ciphertext->GetKeyTag()));
     return rv;
 }
 
@@ -382,9 +645,9 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalSumCols(
                       "Information passed to EvalSum was not generated with this "
                       "crypto context");
 
-    auto evalSumKeys = CryptoContextImpl<Element>::GetEvalSumKeyMap(ciphertext->GetKeyTag());
+    auto keys = ReadEvalKeys();
 
-    auto rv = GetScheme()->EvalSumCols(ciphertext, rowSize, evalSumKeys, evalSumKeysRight);
+    auto rv = GetScheme()->EvalSumCols(ciphertext, rowSize, keys.GetSumKeys(ciphertext->GetKeyTag()), evalSumKeysRight);
     return rv;
 }
 
@@ -403,9 +666,11 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalAtIndex(ConstCiphertext<Elem
         return rv;
     }
 
-    auto evalAutomorphismKeys = CryptoContextImpl<Element>::GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag());
+    usint autoIndex = FindAutomorphismIndex(index);
+    auto keys       = ReadEvalKeys();
 
-    auto rv = GetScheme()->EvalAtIndex(ciphertext, index, evalAutomorphismKeys);
+    auto rv = GetScheme()->EvalAutomorphism(ciphertext, autoIndex,
+                                            keys.GetAutomorphismKey(ciphertext->GetKeyTag(), autoIndex));
     return rv;
 }
 
@@ -417,13 +682,69 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalMerge(
                       "Information passed to EvalMerge was not generated with "
                       "this crypto context");
 
-    auto evalAutomorphismKeys = CryptoContextImpl<Element>::GetEvalAutomorphismKeyMap(ciphertextVector[0]->GetKeyTag());
+    auto keys = ReadEvalKeys();
 
-    auto rv = GetScheme()->EvalMerge(ciphertextVector, evalAutomorphismKeys);
+    auto rv = GetScheme()->EvalMerge(ciphertextVector,
+                                     *keys.GetAutomorphismKeys(ciphertextVector[0]->GetKeyTag()).GetMap());
 
     return rv;
 }
 
+template <typename Element>
+void CryptoContextImpl<Element>::EvalMatMultSetup(uint32_t dim) {
+    GetScheme()->EvalMatMultSetup(*this, dim);
+}
+
+template <typename Element>
+void CryptoContextImpl<Element>::EvalMatMultKeyGen(const PrivateKey<Element> privateKey, uint32_t dim) {
+    if (privateKey == nullptr || Mismatched(privateKey->GetCryptoContext())) {
+        OPENFHE_THROW(config_error,
+                      "Private key passed to EvalMatMultKeyGen was not generated with this crypto context");
+    }
+
+    EvalAtIndexKeyGen(privateKey, GetScheme()->FindMatMultRotationIndices(dim));
+}
+
+template <typename Element>
+Ciphertext<Element> CryptoContextImpl<Element>::EvalMatMult(ConstCiphertext<Element> ct1,
+                                                            ConstCiphertext<Element> ct2, uint32_t dim) const {
+    if (ct1 == nullptr || ct2 == nullptr || ct1->GetKeyTag() != ct2->GetKeyTag() || Mismatched(ct1->GetCryptoContext()))
+        OPENFHE_THROW(config_error,
+                      "Information passed to EvalMatMult was not generated with this "
+                      "crypto context");
+
+    auto keys = ReadEvalKeys();
+
+    return GetScheme()->EvalMatMult(ct1, ct2, dim, *keys.GetAutomorphismKeys(ct1->GetKeyTag()).GetMap(),
+                                    keys.GetMultKeys(ct1->GetKeyTag()));
+}
+
+template <typename Element>
+std::vector<std::vector<Ciphertext<Element>>> CryptoContextImpl<Element>::EvalMatMultBlocks(
+    const std::vector<std::vector<Ciphertext<Element>>>& blocks1,
+    const std::vector<std::vector<Ciphertext<Element>>>& blocks2, uint32_t dim) const {
+    if (blocks1.empty() || blocks1[0].empty() || blocks1[0][0] == nullptr ||
+        Mismatched(blocks1[0][0]->GetCryptoContext()))
+        OPENFHE_THROW(config_error,
+                      "Information passed to EvalMatMultBlocks was not generated with this "
+                      "crypto context");
+
+    const std::string keyTag = blocks1[0][0]->GetKeyTag();
+    for (const auto* blocks : {&blocks1, &blocks2}) {
+        for (const auto& row : *blocks) {
+            for (const auto& block : row) {
+                if (block == nullptr || block->GetKeyTag() != keyTag)
+                    OPENFHE_THROW(config_error, "EvalMatMultBlocks: all blocks must be encrypted under the same key");
+            }
+        }
+    }
+
+    auto keys = ReadEvalKeys();
+
+    return GetScheme()->EvalMatMultBlocks(blocks1, blocks2, dim, *keys.GetAutomorphismKeys(keyTag).GetMap(),
+                                          keys.GetMultKeys(keyTag));
+}
+
 template <typename Element>
 Ciphertext<Element> CryptoContextImpl<Element>::EvalInnerProduct(ConstCiphertext<Element> ct1,
                                                                  ConstCiphertext<Element> ct2, usint batchSize) const {
@@ -432,10 +753,10 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalInnerProduct(ConstCiphertext
                       "Information passed to EvalInnerProduct was not generated "
                       "with this crypto context");
 
-    auto evalSumKeys = CryptoContextImpl<Element>::GetEvalSumKeyMap(ct1->GetKeyTag());
-    auto ek          = GetEvalMultKeyVector(ct1->GetKeyTag());
+    auto keys = ReadEvalKeys();
 
-    auto rv = GetScheme()->EvalInnerProduct(ct1, ct2, batchSize, evalSumKeys, ek[0]);
+    auto rv = GetScheme()->EvalInnerProduct(ct1, ct2, batchSize, keys.GetSumKeys(ct1->GetKeyTag()),
+                                            keys.GetMultKeys(ct1->GetKeyTag())[0]);
     return rv;
 }
 
@@ -447,9 +768,9 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalInnerProduct(ConstCiphertext
                       "Information passed to EvalInnerProduct was not generated "
                       "with this crypto context");
 
-    auto evalSumKeys = CryptoContextImpl<Element>::GetEvalSumKeyMap(ct1->GetKeyTag());
+    auto keys = ReadEvalKeys();
 
-    auto rv = GetScheme()->EvalInnerProduct(ct1, ct2, batchSize, evalSumKeys);
+    auto rv = GetScheme()->EvalInnerProduct(ct1, ct2, batchSize, keys.GetSumKeys(ct1->GetKeyTag()));
     return rv;
 }
 
@@ -579,8 +900,8 @@ DecryptResult CryptoContextImpl<Element>::MultipartyDecryptFusion(
 
 template <typename Element>
 void CryptoContextImpl<Element>::EvalBootstrapSetup(std::vector<uint32_t> levelBudget, std::vector<uint32_t> dim1,
-                                                    uint32_t numSlots) {
-    GetScheme()->EvalBootstrapSetup(*this, levelBudget, dim1, numSlots);
+                                                    uint32_t numSlots, const std::string& cacheDir) {
+    GetScheme()->EvalBootstrapSetup(*this, levelBudget, dim1, numSlots, cacheDir);
 }
 
 template <typename Element>
@@ -592,23 +913,7 @@ void CryptoContextImpl<Element>::EvalBootstrapKeyGen(const PrivateKey<Element> p
 
     auto evalKeys = GetScheme()->EvalBootstrapKeyGen(privateKey, slots);
 
-    auto ekv = GetAllEvalAutomorphismKeys().find(privateKey->GetKeyTag());
-    if (ekv == GetAllEvalAutomorphismKeys().end()) {
-        GetAllEvalAutomorphismKeys()[privateKey->GetKeyTag()] = evalKeys;
-    }
-    else {
-        auto& currRotMap = GetEvalAutomorphismKeyMap(privateKey->GetKeyTag());
-        auto iterRowKeys = evalKeys->begin();
-        while (iterRowKeys != evalKeys->end()) {
-            auto idx = iterRowKeys->first;
-            // Search current rotation key map and add key
-            // only if it doesn't exist
-            if (currRotMap.find(idx) == currRotMap.end()) {
-                currRotMap.insert(*iterRowKeys);
-            }
-            iterRowKeys++;
-        }
-    }
+    MergeEvalAutomorphismKeys(evalKeys, privateKey->GetKeyTag());
 }
 
 template <typename Element>
@@ -616,6 +921,19 @@ Ciphertext<Element> CryptoContextImpl<Element>::EvalBootstrap(ConstCiphertext<El
     return GetScheme()->EvalBootstrap(ciphertext);
 }
 
+template <typename Element>
+std::vector<Ciphertext<Element>> CryptoContextImpl<Element>::EvalBootstrap(
+    const std::vector<Ciphertext<Element>>& ciphertexts) const {
+    for (const auto& ciphertext : ciphertexts) {
+        if (ciphertext == nullptr || Mismatched(ciphertext->GetCryptoContext()) ||
+            ciphertext->GetKeyTag() != ciphertexts[0]->GetKeyTag())
+            OPENFHE_THROW(config_error,
+                          "Information passed to EvalBootstrap was not generated with this crypto context");
+    }
+
+    return GetScheme()->EvalBootstrap(ciphertexts);
+}
+
 }  // namespace lbcrypto
 
 // the code below is from cryptocontext-impl.cpp
@@ -651,16 +969,23 @@ DecryptResult CryptoContextImpl<DCRTPoly>::Decrypt(ConstCiphertext<DCRTPoly> cip
     // Plaintext decrypted =
     // GetPlaintextForDecrypt(ciphertext->GetEncodingType(),
     // this->GetElementParams(), this->GetEncodingParams());
-    Plaintext decrypted = GetPlaintextForDecrypt(ciphertext->GetEncodingType(),
-                                                 ciphertext->GetElements()[0].GetParams(), this->GetEncodingParams());
-
+    Plaintext decrypted;
     DecryptResult result;
 
     if ((ciphertext->GetEncodingType() == CKKS_PACKED_ENCODING) &&
-        (ciphertext->GetElements()[0].GetParams()->GetParams().size() > 1))  // only one tower in DCRTPoly
-        result = GetScheme()->Decrypt(ciphertext, privateKey, &decrypted->GetElement<Poly>());
-    else
-        result = GetScheme()->Decrypt(ciphertext, privateKey, &decrypted->GetElement<NativePoly>());
+        (ciphertext->GetElements()[0].GetParams()->GetParams().size() > 1)) {
+        // more than one tower: keep the result in RNS form, CKKS decoding reconstructs
+        // only the coefficients it needs without multiprecision arithmetic; the full
+        // Poly is interpolated only if the caller asks for GetElement<Poly>()
+        decrypted = PlaintextFactory::MakePlaintext(CKKS_PACKED_ENCODING, ciphertext->GetElements()[0].GetParams(),
+                                                    this->GetEncodingParams());
+        result    = GetScheme()->Decrypt(ciphertext, privateKey, &decrypted->GetElement<DCRTPoly>());
+    }
+    else {
+        decrypted = GetPlaintextForDecrypt(ciphertext->GetEncodingType(), ciphertext->GetElements()[0].GetParams(),
+                                           this->GetEncodingParams());
+        result    = GetScheme()->Decrypt(ciphertext, privateKey, &decrypted->GetElement<NativePoly>());
+    }
 
     if (result.isValid == false)
         return result;
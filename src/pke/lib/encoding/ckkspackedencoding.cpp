@@ -442,6 +442,30 @@ bool CKKSPackedEncoding::Decode(size_t depth, double scalingFactor, enum Scaling
             curValues[i] = cur;
         }
     }
+    else if (this->typeFlag == IsDCRTPoly) {
+        powP = pow(2, -p);
+
+        // we will bring down the scaling factor to 2^p
+        double scalingFactorPre = 0.0;
+        if (scalTech == FLEXIBLEAUTO || scalTech == FLEXIBLEAUTOEXT)
+            scalingFactorPre = pow(scalingFactor, -1) * pow(2, p);
+        else
+            scalingFactorPre = pow(2, -p * (depth - 1));
+
+        // only the coefficients read by the slots are reconstructed
+        std::vector<usint> indices(2 * slots);
+        for (size_t i = 0, idx = 0; i < slots; ++i, idx += gap) {
+            indices[2 * i]     = idx;
+            indices[2 * i + 1] = idx + Nh;
+        }
+        std::vector<double> centered = GetElement<DCRTPoly>().CRTInterpolateCentered(indices);
+        // GetElement<Poly>() still returns the full decryption result, interpolated only if asked for
+        isPolyPending = true;
+
+        for (size_t i = 0; i < slots; ++i)
+            curValues[i] = std::complex<double>(centered[2 * i] * scalingFactorPre,
+                                                centered[2 * i + 1] * scalingFactorPre);
+    }
     else {
         powP = pow(2, -p);
 
@@ -35,8 +35,11 @@ namespace lbcrypto {
 
 struct GLOBALS {
     static bool precomputeCRTTables;
+    // override of precomputeCRTTables set by PrecomputeCRTTablesScope; -1 if none
+    static thread_local int threadPrecomputeCRTTables;
 };
-bool GLOBALS::precomputeCRTTables = true;
+bool GLOBALS::precomputeCRTTables                   = true;
+thread_local int GLOBALS::threadPrecomputeCRTTables = -1;
 //=============================================================================
 void EnablePrecomputeCRTTablesAfterDeserializaton() {
     GLOBALS::precomputeCRTTables = true;
@@ -47,8 +50,19 @@ void DisablePrecomputeCRTTablesAfterDeserializaton() {
 }
 //=============================================================================
 bool PrecomputeCRTTablesAfterDeserializaton() {
+    if (GLOBALS::threadPrecomputeCRTTables >= 0)
+        return GLOBALS::threadPrecomputeCRTTables != 0;
     return GLOBALS::precomputeCRTTables;
 }
 //=============================================================================
+PrecomputeCRTTablesScope::PrecomputeCRTTablesScope(bool precompute)
+    : m_previous(GLOBALS::threadPrecomputeCRTTables) {
+    GLOBALS::threadPrecomputeCRTTables = precompute ? 1 : 0;
+}
+//=============================================================================
+PrecomputeCRTTablesScope::~PrecomputeCRTTablesScope() {
+    GLOBALS::threadPrecomputeCRTTables = m_previous;
+}
+//=============================================================================
 
 }  // namespace lbcrypto
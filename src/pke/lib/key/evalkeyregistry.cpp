@@ -0,0 +1,107 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+#include "key/evalkeyregistry.h"
+
+namespace lbcrypto {
+
+// slots are padded to a cache line so that readers on different threads do
+// not share lines; a slot is reused by a later thread once its thread exits
+struct alignas(64) EvalKeyEpoch::Slot {
+    // epoch the owning thread is reading in, or 0 outside of sections
+    std::atomic<uint64_t> epoch{0};
+    std::atomic<bool> used{true};
+    Slot* next = nullptr;
+    // nesting depth of the sections of the owning thread
+    uint32_t depth = 0;
+};
+
+namespace {
+
+std::atomic<uint64_t> g_epoch{1};
+// slots are never freed, so the list can be walked without a lock
+std::atomic<EvalKeyEpoch::Slot*> g_slots{nullptr};
+
+EvalKeyEpoch::Slot* AcquireSlot() {
+    for (auto slot = g_slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        bool expected = false;
+        if (!slot->used.load(std::memory_order_relaxed) && slot->used.compare_exchange_strong(expected, true))
+            return slot;
+    }
+    auto slot  = new EvalKeyEpoch::Slot();
+    slot->next = g_slots.load(std::memory_order_relaxed);
+    while (!g_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+    return slot;
+}
+
+struct SlotHolder {
+    EvalKeyEpoch::Slot* slot = AcquireSlot();
+
+    ~SlotHolder() {
+        slot->epoch.store(0);
+        slot->depth = 0;
+        slot->used.store(false, std::memory_order_release);
+    }
+};
+
+thread_local SlotHolder t_slot;
+
+}  // namespace
+
+EvalKeyEpoch::EvalKeyEpoch() : m_slot(t_slot.slot) {
+    // the store has to be visible to writers before the reader loads any
+    // pointer, hence sequential consistency
+    if (m_slot->depth++ == 0)
+        m_slot->epoch.store(g_epoch.load());
+}
+
+void EvalKeyEpoch::Leave() {
+    if (m_slot != nullptr && --m_slot->depth == 0)
+        m_slot->epoch.store(0, std::memory_order_release);
+    m_slot = nullptr;
+}
+
+uint64_t EvalKeyEpoch::Advance() {
+    return g_epoch.fetch_add(1) + 1;
+}
+
+uint64_t EvalKeyEpoch::OldestActive() {
+    uint64_t oldest = UINT64_MAX;
+    for (auto slot = g_slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+        uint64_t epoch = slot->epoch.load();
+        if (epoch != 0 && epoch < oldest)
+            oldest = epoch;
+    }
+    return oldest;
+}
+
+}  // namespace lbcrypto
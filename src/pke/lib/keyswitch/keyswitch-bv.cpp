@@ -296,6 +296,48 @@ void KeySwitchBV::KeySwitchInPlace(Ciphertext<DCRTPoly>& ciphertext, const EvalK
     cv.resize(2);
 }
 
+void KeySwitchBV::EvalKeyLevelReduceInPlace(EvalKey<DCRTPoly> evalKey, size_t levels) const {
+    if (levels == 0)
+        return;
+
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(evalKey->GetCryptoParameters());
+
+    std::vector<DCRTPoly> bv(evalKey->GetBVector());
+    std::vector<DCRTPoly> av(evalKey->GetAVector());
+
+    // the key may already have been truncated, so the size is taken from the key itself
+    size_t sizeQ = bv[0].GetNumOfElements();
+    if (levels >= sizeQ)
+        OPENFHE_THROW(config_error, "The number of levels to drop must be smaller than the number of RNS limbs");
+    size_t sizeQl = sizeQ - levels;
+
+    // the number of digits CRTDecompose produces for a ciphertext in basis Ql
+    usint digitSize = cryptoParams->GetDigitSize();
+    usint nWindows  = 0;
+    if (digitSize > 0) {
+        for (usint i = 0; i < sizeQl; i++) {
+            usint qiMSB      = bv[0].GetElementAtIndex(i).GetModulus().GetLengthForBase(2);
+            usint curWindows = qiMSB / digitSize;
+            if (qiMSB % digitSize > 0)
+                curWindows++;
+            nWindows += curWindows;
+        }
+    }
+    else {
+        nWindows = sizeQl;
+    }
+
+    bv.resize(nWindows);
+    av.resize(nWindows);
+    for (usint k = 0; k < nWindows; k++) {
+        av[k].DropLastElements(levels);
+        bv[k].DropLastElements(levels);
+    }
+
+    evalKey->SetAVector(std::move(av));
+    evalKey->SetBVector(std::move(bv));
+}
+
 std::shared_ptr<std::vector<DCRTPoly>> KeySwitchBV::KeySwitchCore(DCRTPoly a, const EvalKey<DCRTPoly> evalKey) const {
     const auto cryptoParamsBase                   = evalKey->GetCryptoParameters();
     std::shared_ptr<std::vector<DCRTPoly>> digits = EvalKeySwitchPrecomputeCore(a, cryptoParamsBase);
@@ -319,8 +361,10 @@ std::shared_ptr<std::vector<DCRTPoly>> KeySwitchBV::EvalFastKeySwitchCore(
     std::vector<DCRTPoly> bv(evalKey->GetBVector());
     std::vector<DCRTPoly> av(evalKey->GetAVector());
 
-    auto sizeQ    = bv[0].GetParams()->GetParams().size();
-    auto sizeQl   = paramsQl->GetParams().size();
+    auto sizeQ  = bv[0].GetParams()->GetParams().size();
+    auto sizeQl = paramsQl->GetParams().size();
+    if (sizeQ < sizeQl || bv.size() < digits->size())
+        OPENFHE_THROW(config_error, "The evaluation key does not support ciphertexts at this level");
     size_t diffQl = sizeQ - sizeQl;
 
     for (size_t k = 0; k < bv.size(); k++) {
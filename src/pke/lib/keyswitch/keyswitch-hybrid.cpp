@@ -310,6 +310,66 @@ void KeySwitchHYBRID::KeySwitchInPlace(Ciphertext<DCRTPoly>& ciphertext, const E
     cv.resize(2);
 }
 
+void KeySwitchHYBRID::EvalKeyLevelReduceInPlace(EvalKey<DCRTPoly> evalKey, size_t levels) const {
+    if (levels == 0)
+        return;
+
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(evalKey->GetCryptoParameters());
+
+    const std::vector<DCRTPoly>& bv = evalKey->GetBVector();
+    const std::vector<DCRTPoly>& av = evalKey->GetAVector();
+
+    // the key may already have been truncated, so the sizes are taken from the key itself
+    const std::shared_ptr<ParmType> paramsKey = bv[0].GetParams();
+
+    size_t sizeP = cryptoParams->GetParamsP()->GetParams().size();
+    size_t sizeQ = paramsKey->GetParams().size() - sizeP;
+    if (levels >= sizeQ)
+        OPENFHE_THROW(config_error, "The number of levels to drop must be smaller than the number of RNS limbs");
+    size_t sizeQl = sizeQ - levels;
+
+    uint32_t alpha = cryptoParams->GetNumPerPartQ();
+    // The number of digits needed for a ciphertext in basis Ql
+    uint32_t numPartQl = ceil((static_cast<double>(sizeQl)) / alpha);
+    if (numPartQl > bv.size())
+        numPartQl = bv.size();
+
+    std::vector<NativeInteger> moduli(sizeQl + sizeP);
+    std::vector<NativeInteger> roots(sizeQl + sizeP);
+    for (size_t i = 0; i < sizeQl; i++) {
+        moduli[i] = paramsKey->GetParams()[i]->GetModulus();
+        roots[i]  = paramsKey->GetParams()[i]->GetRootOfUnity();
+    }
+    for (size_t j = 0; j < sizeP; j++) {
+        moduli[sizeQl + j] = paramsKey->GetParams()[sizeQ + j]->GetModulus();
+        roots[sizeQl + j]  = paramsKey->GetParams()[sizeQ + j]->GetRootOfUnity();
+    }
+    auto paramsQlP = std::make_shared<ParmType>(paramsKey->GetCyclotomicOrder(), moduli, roots);
+
+    std::vector<DCRTPoly> avl(numPartQl);
+    std::vector<DCRTPoly> bvl(numPartQl);
+
+    for (uint32_t part = 0; part < numPartQl; part++) {
+        avl[part] = DCRTPoly(paramsQlP, Format::EVALUATION, true);
+        bvl[part] = DCRTPoly(paramsQlP, Format::EVALUATION, true);
+
+        // The part with basis Ql
+        for (size_t i = 0; i < sizeQl; i++) {
+            avl[part].SetElementAtIndex(i, av[part].GetElementAtIndex(i));
+            bvl[part].SetElementAtIndex(i, bv[part].GetElementAtIndex(i));
+        }
+
+        // The part with basis P
+        for (size_t j = 0; j < sizeP; j++) {
+            avl[part].SetElementAtIndex(sizeQl + j, av[part].GetElementAtIndex(sizeQ + j));
+            bvl[part].SetElementAtIndex(sizeQl + j, bv[part].GetElementAtIndex(sizeQ + j));
+        }
+    }
+
+    evalKey->SetAVector(std::move(avl));
+    evalKey->SetBVector(std::move(bvl));
+}
+
 Ciphertext<DCRTPoly> KeySwitchHYBRID::KeySwitchExt(ConstCiphertext<DCRTPoly> ciphertext, bool addFirst) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertext->GetCryptoParameters());
 
@@ -536,7 +596,11 @@ std::shared_ptr<std::vector<DCRTPoly>> KeySwitchHYBRID::EvalFastKeySwitchCoreExt
 
     size_t sizeQl  = paramsQl->GetParams().size();
     size_t sizeQlP = paramsQlP->GetParams().size();
-    size_t sizeQ   = cryptoParams->GetElementParams()->GetParams().size();
+    // the key may have been truncated by EvalKeyLevelReduceInPlace, so its Q part can be shorter than Q
+    size_t sizeQ = bv[0].GetNumOfElements() - paramsP->GetParams().size();
+
+    if (sizeQ < sizeQl || bv.size() < digits->size())
+        OPENFHE_THROW(config_error, "The evaluation key does not support ciphertexts at this level");
 
     DCRTPoly cTilda0(paramsQlP, Format::EVALUATION, true);
     DCRTPoly cTilda1(paramsQlP, Format::EVALUATION, true);
@@ -159,115 +159,49 @@ uint32_t FindLevelsToDrop(usint multiplicativeDepth, std::shared_ptr<CryptoParam
     return levels;
 };
 
-Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> ciphertext1,
-                                                ConstCiphertext<DCRTPoly> ciphertext2) const {
-    if (!(ciphertext1->GetCryptoParameters() == ciphertext2->GetCryptoParameters())) {
-        std::string errMsg = "AlgorithmSHEBFVrns::EvalMult crypto parameters are not the same";
-        OPENFHE_THROW(config_error, errMsg);
-    }
-
-    Ciphertext<DCRTPoly> ciphertextMult = ciphertext1->CloneEmpty();
-
-    const auto cryptoParams =
-        std::dynamic_pointer_cast<CryptoParametersBFVRNS>(ciphertext1->GetCryptoContext()->GetCryptoParameters());
-
-    std::vector<DCRTPoly> cv1 = ciphertext1->GetElements();
-    std::vector<DCRTPoly> cv2 = ciphertext2->GetElements();
-
-    size_t cv1Size    = cv1.size();
-    size_t cv2Size    = cv2.size();
-    size_t cvMultSize = cv1Size + cv2Size - 1;
-    size_t sizeQ      = cv1[0].GetNumOfElements();
-    // l is index correspinding to leveled parameters in cryptoParameters precomputations in HPSPOVERQLEVELED
-    size_t l = 0;
-
-    std::vector<DCRTPoly> cvMult(cvMultSize);
+// Extends the elements of the first EvalMult operand from basis Q to the basis
+// the tensor product is computed in (EVALUATION format). l is the index of the
+// leveled precomputations used by HPSPOVERQLEVELED.
+static void ExtendFirstMultOperand(std::vector<DCRTPoly>& cv,
+                                   const std::shared_ptr<CryptoParametersBFVRNS> cryptoParams, size_t l) {
+    size_t sizeQ = cv[0].GetNumOfElements();
 
     if (cryptoParams->GetMultiplicationTechnique() == HPS) {
-        for (size_t i = 0; i < cv1Size; i++) {
-            cv1[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(), cryptoParams->GetParamsRl(),
-                                  cryptoParams->GetQlHatInvModq(), cryptoParams->GetQlHatInvModqPrecon(),
-                                  cryptoParams->GetQlHatModr(), cryptoParams->GetalphaQlModr(),
-                                  cryptoParams->GetModrBarrettMu(), cryptoParams->GetqInv(), Format::EVALUATION);
-        }
-
-        for (size_t i = 0; i < cv2Size; i++) {
-            cv2[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(), cryptoParams->GetParamsRl(),
-                                  cryptoParams->GetQlHatInvModq(), cryptoParams->GetQlHatInvModqPrecon(),
-                                  cryptoParams->GetQlHatModr(), cryptoParams->GetalphaQlModr(),
-                                  cryptoParams->GetModrBarrettMu(), cryptoParams->GetqInv(), Format::EVALUATION);
+        for (size_t i = 0; i < cv.size(); i++) {
+            cv[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(), cryptoParams->GetParamsRl(),
+                                 cryptoParams->GetQlHatInvModq(), cryptoParams->GetQlHatInvModqPrecon(),
+                                 cryptoParams->GetQlHatModr(), cryptoParams->GetalphaQlModr(),
+                                 cryptoParams->GetModrBarrettMu(), cryptoParams->GetqInv(), Format::EVALUATION);
         }
     }
     else if (cryptoParams->GetMultiplicationTechnique() == HPSPOVERQ) {
-        for (size_t i = 0; i < cv1Size; i++) {
+        for (size_t i = 0; i < cv.size(); i++) {
             // Expand ciphertext1 from basis Q to PQ.
-            cv1[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(sizeQ - 1), cryptoParams->GetParamsRl(sizeQ - 1),
-                                  cryptoParams->GetQlHatInvModq(sizeQ - 1),
-                                  cryptoParams->GetQlHatInvModqPrecon(sizeQ - 1), cryptoParams->GetQlHatModr(sizeQ - 1),
-                                  cryptoParams->GetalphaQlModr(sizeQ - 1), cryptoParams->GetModrBarrettMu(),
-                                  cryptoParams->GetqInv(), Format::EVALUATION);
-        }
-
-        size_t sizeQ = cv2[0].GetNumOfElements();
-
-        DCRTPoly::CRTBasisExtensionPrecomputations basisPQ(
-            cryptoParams->GetParamsQlRl(sizeQ - 1), cryptoParams->GetParamsRl(sizeQ - 1),
-            cryptoParams->GetParamsQl(sizeQ - 1), cryptoParams->GetmNegRlQHatInvModq(sizeQ - 1),
-            cryptoParams->GetmNegRlQHatInvModqPrecon(sizeQ - 1), cryptoParams->GetqInvModr(),
-            cryptoParams->GetModrBarrettMu(), cryptoParams->GetRlHatInvModr(sizeQ - 1),
-            cryptoParams->GetRlHatInvModrPrecon(sizeQ - 1), cryptoParams->GetRlHatModq(sizeQ - 1),
-            cryptoParams->GetalphaRlModq(sizeQ - 1), cryptoParams->GetModqBarrettMu(), cryptoParams->GetrInv());
-
-        for (size_t i = 0; i < cv2Size; i++) {
-            cv2[i].SetFormat(Format::COEFFICIENT);
-            // Switch ciphertext2 from basis Q to P to PQ.
-            cv2[i].FastExpandCRTBasisPloverQ(basisPQ);
-            cv2[i].SetFormat(Format::EVALUATION);
+            cv[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(sizeQ - 1), cryptoParams->GetParamsRl(sizeQ - 1),
+                                 cryptoParams->GetQlHatInvModq(sizeQ - 1),
+                                 cryptoParams->GetQlHatInvModqPrecon(sizeQ - 1), cryptoParams->GetQlHatModr(sizeQ - 1),
+                                 cryptoParams->GetalphaQlModr(sizeQ - 1), cryptoParams->GetModrBarrettMu(),
+                                 cryptoParams->GetqInv(), Format::EVALUATION);
         }
     }
     else if (cryptoParams->GetMultiplicationTechnique() == HPSPOVERQLEVELED) {
-        size_t c1depth = ciphertext1->GetDepth();
-        size_t c2depth = ciphertext2->GetDepth();
-
-        size_t levels   = std::max(c1depth, c2depth) - 1;
-        double dcrtBits = cv1[0].GetElementAtIndex(0).GetModulus().GetMSB();
-
-        // how many levels to drop
-        uint32_t levelsDropped = FindLevelsToDrop(levels, cryptoParams, dcrtBits, false);
-        l                      = levelsDropped > 0 ? sizeQ - 1 - levelsDropped : sizeQ - 1;
-
-        for (size_t i = 0; i < cv1Size; i++) {
-            cv1[i].SetFormat(Format::COEFFICIENT);
+        for (size_t i = 0; i < cv.size(); i++) {
+            cv[i].SetFormat(Format::COEFFICIENT);
             if (l < sizeQ - 1) {
                 // Drop from basis Q to Q_l.
-                cv1[i] =
-                    cv1[i].ScaleAndRound(cryptoParams->GetParamsQl(l), cryptoParams->GetQlQHatInvModqDivqModq(l),
-                                         cryptoParams->GetQlQHatInvModqDivqFrac(l), cryptoParams->GetModqBarrettMu());
+                cv[i] = cv[i].ScaleAndRound(cryptoParams->GetParamsQl(l), cryptoParams->GetQlQHatInvModqDivqModq(l),
+                                            cryptoParams->GetQlQHatInvModqDivqFrac(l), cryptoParams->GetModqBarrettMu());
             }
             // Expand ciphertext1 from basis Q_l to PQ_l.
-            cv1[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(l), cryptoParams->GetParamsRl(l),
-                                  cryptoParams->GetQlHatInvModq(l), cryptoParams->GetQlHatInvModqPrecon(l),
-                                  cryptoParams->GetQlHatModr(l), cryptoParams->GetalphaQlModr(l),
-                                  cryptoParams->GetModrBarrettMu(), cryptoParams->GetqInv(), Format::EVALUATION);
-        }
-
-        DCRTPoly::CRTBasisExtensionPrecomputations basisPQ(
-            cryptoParams->GetParamsQlRl(l), cryptoParams->GetParamsRl(l), cryptoParams->GetParamsQl(l),
-            cryptoParams->GetmNegRlQHatInvModq(l), cryptoParams->GetmNegRlQHatInvModqPrecon(l),
-            cryptoParams->GetqInvModr(), cryptoParams->GetModrBarrettMu(), cryptoParams->GetRlHatInvModr(l),
-            cryptoParams->GetRlHatInvModrPrecon(l), cryptoParams->GetRlHatModq(l), cryptoParams->GetalphaRlModq(l),
-            cryptoParams->GetModqBarrettMu(), cryptoParams->GetrInv());
-
-        for (size_t i = 0; i < cv2Size; i++) {
-            cv2[i].SetFormat(Format::COEFFICIENT);
-            // Switch ciphertext2 from basis Q to P to PQ.
-            cv2[i].FastExpandCRTBasisPloverQ(basisPQ);
-            cv2[i].SetFormat(Format::EVALUATION);
+            cv[i].ExpandCRTBasis(cryptoParams->GetParamsQlRl(l), cryptoParams->GetParamsRl(l),
+                                 cryptoParams->GetQlHatInvModq(l), cryptoParams->GetQlHatInvModqPrecon(l),
+                                 cryptoParams->GetQlHatModr(l), cryptoParams->GetalphaQlModr(l),
+                                 cryptoParams->GetModrBarrettMu(), cryptoParams->GetqInv(), Format::EVALUATION);
         }
     }
     else {
-        for (size_t i = 0; i < cv1Size; i++) {
-            cv1[i].FastBaseConvqToBskMontgomery(
+        for (size_t i = 0; i < cv.size(); i++) {
+            cv[i].FastBaseConvqToBskMontgomery(
                 cryptoParams->GetParamsBsk(), cryptoParams->GetModuliQ(), cryptoParams->GetModuliBsk(),
                 cryptoParams->GetModbskBarrettMu(), cryptoParams->GetmtildeQHatInvModq(),
                 cryptoParams->GetmtildeQHatInvModqPrecon(), cryptoParams->GetQHatModbsk(),
@@ -275,23 +209,177 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> cipher
                 cryptoParams->GetNegQInvModmtilde(), cryptoParams->GetmtildeInvModbsk(),
                 cryptoParams->GetmtildeInvModbskPrecon());
 
-            cv1[i].SetFormat(Format::EVALUATION);
+            cv[i].SetFormat(Format::EVALUATION);
         }
+    }
+}
 
-        for (size_t i = 0; i < cv2Size; i++) {
-            cv2[i].FastBaseConvqToBskMontgomery(
-                cryptoParams->GetParamsBsk(), cryptoParams->GetModuliQ(), cryptoParams->GetModuliBsk(),
-                cryptoParams->GetModbskBarrettMu(), cryptoParams->GetmtildeQHatInvModq(),
-                cryptoParams->GetmtildeQHatInvModqPrecon(), cryptoParams->GetQHatModbsk(),
-                cryptoParams->GetQHatModmtilde(), cryptoParams->GetQModbsk(), cryptoParams->GetQModbskPrecon(),
-                cryptoParams->GetNegQInvModmtilde(), cryptoParams->GetmtildeInvModbsk(),
-                cryptoParams->GetmtildeInvModbskPrecon());
+// The basis ExtendFirstMultOperand extends to; used to check that a
+// precomputed operand can be used for the multiplication at hand
+static std::shared_ptr<DCRTPoly::Params> FirstMultOperandParams(
+    const std::shared_ptr<CryptoParametersBFVRNS> cryptoParams, size_t sizeQ, size_t l) {
+    switch (cryptoParams->GetMultiplicationTechnique()) {
+        case HPS:
+            return cryptoParams->GetParamsQlRl();
+        case HPSPOVERQ:
+            return cryptoParams->GetParamsQlRl(sizeQ - 1);
+        case HPSPOVERQLEVELED:
+            return cryptoParams->GetParamsQlRl(l);
+        default:
+            return cryptoParams->GetParamsBsk();
+    }
+}
+
+// The HPSPOVERQLEVELED level index for a product of ciphertexts of the given depth
+static size_t FindMultLevelIndex(size_t depth, const std::shared_ptr<CryptoParametersBFVRNS> cryptoParams,
+                                 const DCRTPoly& element) {
+    size_t sizeQ    = element.GetNumOfElements();
+    double dcrtBits = element.GetElementAtIndex(0).GetModulus().GetMSB();
+
+    // how many levels to drop
+    uint32_t levelsDropped = FindLevelsToDrop(depth - 1, cryptoParams, dcrtBits, false);
+    return levelsDropped > 0 ? sizeQ - 1 - levelsDropped : sizeQ - 1;
+}
+
+// Computes the tensor product of two ciphertexts in evaluation representation
+// one CRT tower at a time: all products for a tower are accumulated and
+// converted to coefficient representation while the tower is still in cache,
+// rather than in separate full-size passes over the extended basis. The
+// parameters of the operands must describe all of their towers
+static std::vector<DCRTPoly> TensorProductToCoefficient(const std::vector<DCRTPoly>& cv1,
+                                                        const std::vector<DCRTPoly>& cv2) {
+    size_t cv1Size    = cv1.size();
+    size_t cv2Size    = cv2.size();
+    size_t cvMultSize = cv1Size + cv2Size - 1;
+    size_t sizeQR     = cv1[0].GetNumOfElements();
+
+    std::vector<DCRTPoly> cvMult;
+    cvMult.reserve(cvMultSize);
+    for (size_t k = 0; k < cvMultSize; k++)
+        cvMult.emplace_back(cv1[0].GetParams(), Format::COEFFICIENT, false);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < sizeQR; i++) {
+        for (size_t k = 0; k < cvMultSize; k++) {
+            size_t jBegin = (k < cv2Size) ? 0 : k - cv2Size + 1;
+            size_t jEnd   = std::min(k, cv1Size - 1);
+
+            NativePoly tower = cv1[jBegin].GetElementAtIndex(i);
+            tower *= cv2[k - jBegin].GetElementAtIndex(i);
+            for (size_t j = jBegin + 1; j <= jEnd; j++) {
+                NativePoly product = cv1[j].GetElementAtIndex(i);
+                product *= cv2[k - j].GetElementAtIndex(i);
+                tower += product;
+            }
+            tower.SetFormat(Format::COEFFICIENT);
+            cvMult[k].SetElementAtIndex(i, std::move(tower));
+        }
+    }
+
+    return cvMult;
+}
+
+Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> ciphertext1,
+                                                ConstCiphertext<DCRTPoly> ciphertext2) const {
+    return EvalMult(ciphertext1, ciphertext2, nullptr, nullptr);
+}
+
+std::shared_ptr<std::vector<DCRTPoly>> LeveledSHEBFVRNS::EvalMultPrecompute(
+    ConstCiphertext<DCRTPoly> ciphertext) const {
+    const auto cryptoParams =
+        std::dynamic_pointer_cast<CryptoParametersBFVRNS>(ciphertext->GetCryptoContext()->GetCryptoParameters());
+
+    std::vector<DCRTPoly> cv = ciphertext->GetElements();
+
+    // for HPSPOVERQLEVELED the level depends on both operands; the one for a product
+    // with a ciphertext of the same or lower depth is precomputed
+    size_t l = 0;
+    if (cryptoParams->GetMultiplicationTechnique() == HPSPOVERQLEVELED)
+        l = FindMultLevelIndex(ciphertext->GetDepth(), cryptoParams, cv[0]);
+
+    ExtendFirstMultOperand(cv, cryptoParams, l);
+
+    return std::make_shared<std::vector<DCRTPoly>>(std::move(cv));
+}
+
+Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> ciphertext1,
+                                                ConstCiphertext<DCRTPoly> ciphertext2,
+                                                std::shared_ptr<std::vector<DCRTPoly>> precomp1,
+                                                std::shared_ptr<std::vector<DCRTPoly>> precomp2) const {
+    if (!(ciphertext1->GetCryptoParameters() == ciphertext2->GetCryptoParameters())) {
+        std::string errMsg = "AlgorithmSHEBFVrns::EvalMult crypto parameters are not the same";
+        OPENFHE_THROW(config_error, errMsg);
+    }
+
+    Ciphertext<DCRTPoly> ciphertextMult = ciphertext1->CloneEmpty();
+
+    const auto cryptoParams =
+        std::dynamic_pointer_cast<CryptoParametersBFVRNS>(ciphertext1->GetCryptoContext()->GetCryptoParameters());
+
+    MultiplicationTechnique multTech = cryptoParams->GetMultiplicationTechnique();
+    bool symmetric                   = (multTech == HPS || multTech == BEHZ);
+
+    // With HPSPOVERQ* only the first operand is extended to basis PQ, so a
+    // precomputed second operand is moved to the first position
+    if (!symmetric && precomp1 == nullptr && precomp2 != nullptr) {
+        std::swap(ciphertext1, ciphertext2);
+        std::swap(precomp1, precomp2);
+    }
+
+    size_t cv1Size    = ciphertext1->GetElements().size();
+    size_t cv2Size    = ciphertext2->GetElements().size();
+    size_t cvMultSize = cv1Size + cv2Size - 1;
+    size_t sizeQ      = ciphertext1->GetElements()[0].GetNumOfElements();
+    // l is index correspinding to leveled parameters in cryptoParameters precomputations in HPSPOVERQLEVELED
+    size_t l = 0;
+    if (multTech == HPSPOVERQLEVELED)
+        l = FindMultLevelIndex(std::max(ciphertext1->GetDepth(), ciphertext2->GetDepth()), cryptoParams,
+                               ciphertext1->GetElements()[0]);
+
+    // A precomputed operand is used as is if it was extended to the basis needed here
+    auto paramsExt = FirstMultOperandParams(cryptoParams, sizeQ, l);
+    auto usable    = [&](const std::shared_ptr<std::vector<DCRTPoly>>& precomp, size_t size) {
+        return precomp != nullptr && precomp->size() == size && (*precomp)[0].GetParams() == paramsExt;
+    };
+
+    std::vector<DCRTPoly> cv1Ext;
+    if (!usable(precomp1, cv1Size)) {
+        cv1Ext = ciphertext1->GetElements();
+        ExtendFirstMultOperand(cv1Ext, cryptoParams, l);
+    }
+    const std::vector<DCRTPoly>& cv1 = usable(precomp1, cv1Size) ? *precomp1 : cv1Ext;
 
-            cv2[i].SetFormat(Format::EVALUATION);
+    std::vector<DCRTPoly> cv2Ext;
+    bool useprecomp2 = symmetric && usable(precomp2, cv2Size);
+    if (!useprecomp2) {
+        cv2Ext = ciphertext2->GetElements();
+        if (symmetric) {
+            ExtendFirstMultOperand(cv2Ext, cryptoParams, l);
+        }
+        else {
+            size_t sizeQ2 = (multTech == HPSPOVERQ) ? cv2Ext[0].GetNumOfElements() - 1 : l;
+
+            DCRTPoly::CRTBasisExtensionPrecomputations basisPQ(
+                cryptoParams->GetParamsQlRl(sizeQ2), cryptoParams->GetParamsRl(sizeQ2),
+                cryptoParams->GetParamsQl(sizeQ2), cryptoParams->GetmNegRlQHatInvModq(sizeQ2),
+                cryptoParams->GetmNegRlQHatInvModqPrecon(sizeQ2), cryptoParams->GetqInvModr(),
+                cryptoParams->GetModrBarrettMu(), cryptoParams->GetRlHatInvModr(sizeQ2),
+                cryptoParams->GetRlHatInvModrPrecon(sizeQ2), cryptoParams->GetRlHatModq(sizeQ2),
+                cryptoParams->GetalphaRlModq(sizeQ2), cryptoParams->GetModqBarrettMu(), cryptoParams->GetrInv());
+
+            for (size_t i = 0; i < cv2Size; i++) {
+                cv2Ext[i].SetFormat(Format::COEFFICIENT);
+                // Switch ciphertext2 from basis Q to P to PQ.
+                cv2Ext[i].FastExpandCRTBasisPloverQ(basisPQ);
+                cv2Ext[i].SetFormat(Format::EVALUATION);
+            }
         }
     }
+    const std::vector<DCRTPoly>& cv2 = useprecomp2 ? *precomp2 : cv2Ext;
 
 #ifdef USE_KARATSUBA
+    std::vector<DCRTPoly> cvMult(cvMultSize);
+
 
     if (cv1Size == 2 && cv2Size == 2) {
         // size of each ciphertxt = 2, use Karatsuba
@@ -319,16 +407,25 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> cipher
         }
     }
 #else
-    std::vector<bool> isFirstAdd(cvMultSize, true);
+    std::vector<DCRTPoly> cvMult;
+    if (multTech != BEHZ) {
+        cvMult = TensorProductToCoefficient(cv1, cv2);
+    }
+    else {
+        // operands extended to {Q, Bsk} keep the parameters of Bsk only, so
+        // their towers cannot be rebuilt from the parameters
+        cvMult.resize(cvMultSize);
+        std::vector<bool> isFirstAdd(cvMultSize, true);
 
-    for (size_t i = 0; i < cv1Size; i++) {
-        for (size_t j = 0; j < cv2Size; j++) {
-            if (isFirstAdd[i + j] == true) {
-                cvMult[i + j]     = cv1[i] * cv2[j];
-                isFirstAdd[i + j] = false;
-            }
-            else {
-                cvMult[i + j] += cv1[i] * cv2[j];
+        for (size_t i = 0; i < cv1Size; i++) {
+            for (size_t j = 0; j < cv2Size; j++) {
+                if (isFirstAdd[i + j] == true) {
+                    cvMult[i + j]     = cv1[i] * cv2[j];
+                    isFirstAdd[i + j] = false;
+                }
+                else {
+                    cvMult[i + j] += cv1[i] * cv2[j];
+                }
             }
         }
     }
@@ -338,17 +435,13 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> cipher
         for (size_t i = 0; i < cvMultSize; i++) {
             // converts to coefficient representation before rounding
             cvMult[i].SetFormat(Format::COEFFICIENT);
-            // Performs the scaling by t/Q followed by rounding; the result is in the
-            // CRT basis P
-            cvMult[i] =
-                cvMult[i].ScaleAndRound(cryptoParams->GetParamsRl(), cryptoParams->GettRSHatInvModsDivsModr(),
-                                        cryptoParams->GettRSHatInvModsDivsFrac(), cryptoParams->GetModrBarrettMu());
-
-            // Converts from the CRT basis P to Q
-            cvMult[i] = cvMult[i].SwitchCRTBasis(cryptoParams->GetElementParams(), cryptoParams->GetRlHatInvModr(),
-                                                 cryptoParams->GetRlHatInvModrPrecon(), cryptoParams->GetRlHatModq(),
-                                                 cryptoParams->GetalphaRlModq(), cryptoParams->GetModqBarrettMu(),
-                                                 cryptoParams->GetrInv());
+            // Performs the scaling by t/Q followed by rounding and converts the
+            // result from the CRT basis P to Q in the same pass
+            cvMult[i] = cvMult[i].ScaleAndRoundSwitchCRTBasis(
+                cryptoParams->GetParamsRl(), cryptoParams->GetElementParams(), cryptoParams->GettRSHatInvModsDivsModr(),
+                cryptoParams->GettRSHatInvModsDivsFrac(), cryptoParams->GetModrBarrettMu(),
+                cryptoParams->GetRlHatInvModr(), cryptoParams->GetRlHatInvModrPrecon(), cryptoParams->GetRlHatModq(),
+                cryptoParams->GetalphaRlModq(), cryptoParams->GetModqBarrettMu(), cryptoParams->GetrInv());
         }
     }
     else if (cryptoParams->GetMultiplicationTechnique() == HPSPOVERQ) {
@@ -626,17 +719,13 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalSquare(ConstCiphertext<DCRTPoly> ciph
         for (size_t i = 0; i < cvSqSize; i++) {
             // converts to coefficient representation before rounding
             cvSquare[i].SetFormat(Format::COEFFICIENT);
-            // Performs the scaling by t/Q followed by rounding; the result is in the
-            // CRT basis P
-            cvSquare[i] =
-                cvSquare[i].ScaleAndRound(cryptoParams->GetParamsRl(), cryptoParams->GettRSHatInvModsDivsModr(),
-                                          cryptoParams->GettRSHatInvModsDivsFrac(), cryptoParams->GetModrBarrettMu());
-
-            // Converts from the CRT basis P to Q
-            cvSquare[i] = cvSquare[i].SwitchCRTBasis(cryptoParams->GetElementParams(), cryptoParams->GetRlHatInvModr(),
-                                                     cryptoParams->GetRlHatInvModrPrecon(),
-                                                     cryptoParams->GetRlHatModq(), cryptoParams->GetalphaRlModq(),
-                                                     cryptoParams->GetModqBarrettMu(), cryptoParams->GetrInv());
+            // Performs the scaling by t/Q followed by rounding and converts the
+            // result from the CRT basis P to Q in the same pass
+            cvSquare[i] = cvSquare[i].ScaleAndRoundSwitchCRTBasis(
+                cryptoParams->GetParamsRl(), cryptoParams->GetElementParams(), cryptoParams->GettRSHatInvModsDivsModr(),
+                cryptoParams->GettRSHatInvModsDivsFrac(), cryptoParams->GetModrBarrettMu(),
+                cryptoParams->GetRlHatInvModr(), cryptoParams->GetRlHatInvModrPrecon(), cryptoParams->GetRlHatModq(),
+                cryptoParams->GetalphaRlModq(), cryptoParams->GetModqBarrettMu(), cryptoParams->GetrInv());
         }
     }
     else if (cryptoParams->GetMultiplicationTechnique() == HPSPOVERQ) {
@@ -701,6 +790,16 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> cipher
     return ciphertext;
 }
 
+Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalMult(ConstCiphertext<DCRTPoly> ciphertext1,
+                                                ConstCiphertext<DCRTPoly> ciphertext2,
+                                                const std::shared_ptr<std::vector<DCRTPoly>> precomp1,
+                                                const std::shared_ptr<std::vector<DCRTPoly>> precomp2,
+                                                const EvalKey<DCRTPoly> evalKey) const {
+    Ciphertext<DCRTPoly> ciphertext = EvalMult(ciphertext1, ciphertext2, precomp1, precomp2);
+    RelinearizeCore(ciphertext, evalKey);
+    return ciphertext;
+}
+
 void LeveledSHEBFVRNS::EvalMultInPlace(Ciphertext<DCRTPoly>& ciphertext1, ConstCiphertext<DCRTPoly> ciphertext2,
                                        const EvalKey<DCRTPoly> evalKey) const {
     ciphertext1 = EvalMult(ciphertext1, ciphertext2);
@@ -732,20 +831,18 @@ void LeveledSHEBFVRNS::EvalMultCoreInPlace(Ciphertext<DCRTPoly>& ciphertext, con
 }
 
 Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalAutomorphism(ConstCiphertext<DCRTPoly> ciphertext, usint i,
-                                                        const std::map<usint, EvalKey<DCRTPoly>>& evalKeyMap,
-                                                        CALLER_INFO_ARGS_CPP) const {
+                                                        const EvalKey<DCRTPoly>& evalKey) const {
     const std::vector<DCRTPoly>& cv = ciphertext->GetElements();
 
     usint N = cv[0].GetRingDimension();
 
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, i, &vec);
+    const std::vector<usint>& vec = GetAutoMap(N, i);
 
     auto algo = ciphertext->GetCryptoContext()->GetScheme();
 
     Ciphertext<DCRTPoly> result = ciphertext->Clone();
 
-    RelinearizeCore(result, evalKeyMap.at(i));
+    RelinearizeCore(result, evalKey);
 
     std::vector<DCRTPoly>& rcv = result->GetElements();
 
@@ -790,7 +887,8 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalFastRotation(ConstCiphertext<DCRTPoly
 
     usint autoIndex = FindAutomorphismIndex(index, m);
 
-    auto evalKey = cc->GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag()).find(autoIndex)->second;
+    auto keys           = cc->ReadEvalKeys();
+    const auto& evalKey = keys.GetAutomorphismKey(ciphertext->GetKeyTag(), autoIndex);
 
     auto algo                       = cc->GetScheme();
     const std::vector<DCRTPoly>& cv = ciphertext->GetElements();
@@ -815,8 +913,7 @@ Ciphertext<DCRTPoly> LeveledSHEBFVRNS::EvalFastRotation(ConstCiphertext<DCRTPoly
     }
 
     usint N = cryptoParams->GetElementParams()->GetRingDimension();
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, autoIndex, &vec);
+    const std::vector<usint>& vec = GetAutoMap(N, autoIndex);
 
     (*ba)[0] += cv[0];
 
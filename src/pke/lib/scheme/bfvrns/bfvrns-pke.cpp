@@ -41,6 +41,68 @@ BFV implementation. See https://eprint.iacr.org/2021/204 for details.
 
 namespace lbcrypto {
 
+/**
+ * Lifts a plaintext given in COEFFICIENT format over Q to the basis Qr used by
+ * EXTENDED encryption. The plaintext coefficients are small (mod t), so each
+ * one is identified from the first tower as either x or Q - x with
+ * 0 <= x < q_0, and every other tower has to agree with that value; otherwise
+ * a coefficient such as x + k * q_0 * q_1 would pass for x. Only the r tower
+ * has to be computed. Returns false if a coefficient does not have this form;
+ * the caller then has to fall back to CRT interpolation.
+ */
+static bool LiftPlaintextToQr(const DCRTPoly& ptxt, const std::shared_ptr<DCRTPoly::Params> paramsQr,
+                              DCRTPoly& lifted) {
+    const size_t sizeQ = ptxt.GetNumOfElements();
+    const usint n      = ptxt.GetRingDimension();
+
+    const auto& q0Poly     = ptxt.GetElementAtIndex(0);
+    const NativeInteger q0 = q0Poly.GetModulus();
+    const NativeInteger r  = paramsQr->GetParams()[sizeQ]->GetModulus();
+
+    // [Q]_r, used for the coefficients that are stored as Q - x
+    NativeInteger QModr(1);
+    for (size_t i = 0; i < sizeQ; i++)
+        QModr = QModr.ModMul(ptxt.GetElementAtIndex(i).GetModulus().Mod(r), r);
+
+    NativeVector rVec(n, r);
+    bool ok = true;
+#pragma omp parallel for reduction(&& : ok)
+    for (usint j = 0; j < n; j++) {
+        const NativeInteger& x0 = q0Poly[j];
+        // the coefficient is x0 if the other towers agree, or Q - (q0 - x0) otherwise
+        bool positive         = true;
+        bool negative         = true;
+        const NativeInteger x = q0 - x0;
+        for (size_t i = 1; i < sizeQ && (positive || negative); i++) {
+            const NativeInteger& qi = ptxt.GetElementAtIndex(i).GetModulus();
+            const NativeInteger& xi = ptxt.GetElementAtIndex(i)[j];
+            positive                = positive && xi == x0.Mod(qi);
+            negative                = negative && xi == qi.ModSub(x.Mod(qi), qi);
+        }
+        if (positive)
+            rVec[j] = x0.Mod(r);
+        else if (negative)
+            rVec[j] = QModr.ModSub(x.Mod(r), r);
+        else
+            ok = false;
+    }
+    if (!ok)
+        return false;
+
+    lifted = DCRTPoly(paramsQr, Format::COEFFICIENT);
+#pragma omp parallel for
+    for (size_t i = 0; i < sizeQ; i++) {
+        NativePoly tower(paramsQr->GetParams()[i], Format::COEFFICIENT);
+        tower.SetValues(ptxt.GetElementAtIndex(i).GetValues(), Format::COEFFICIENT);
+        lifted.SetElementAtIndex(i, std::move(tower));
+    }
+    NativePoly rTower(paramsQr->GetParams()[sizeQ], Format::COEFFICIENT);
+    rTower.SetValues(std::move(rVec), Format::COEFFICIENT);
+    lifted.SetElementAtIndex(sizeQ, std::move(rTower));
+
+    return true;
+}
+
 KeyPair<DCRTPoly> PKEBFVRNS::KeyGen(CryptoContext<DCRTPoly> cc, bool makeSparse) {
     KeyPair<DCRTPoly> keyPair(std::make_shared<PublicKeyImpl<DCRTPoly>>(cc),
                               std::make_shared<PrivateKeyImpl<DCRTPoly>>(cc));
@@ -107,9 +169,12 @@ Ciphertext<DCRTPoly> PKEBFVRNS::Encrypt(DCRTPoly ptxt, const PrivateKey<DCRTPoly
     if (cryptoParams->GetEncryptionTechnique() == EXTENDED) {
         encParams = cryptoParams->GetParamsQr();
         ptxt.SetFormat(Format::COEFFICIENT);
-        Poly bigPtxt = ptxt.CRTInterpolate();
-        DCRTPoly plain(bigPtxt, encParams);
-        ptxt     = plain;
+        DCRTPoly plain;
+        if (!LiftPlaintextToQr(ptxt, encParams, plain)) {
+            Poly bigPtxt = ptxt.CRTInterpolate();
+            plain        = DCRTPoly(bigPtxt, encParams);
+        }
+        ptxt     = std::move(plain);
         tInvModq = cryptoParams->GettInvModqr();
     }
     ptxt.SetFormat(Format::COEFFICIENT);
@@ -159,9 +224,12 @@ Ciphertext<DCRTPoly> PKEBFVRNS::Encrypt(DCRTPoly ptxt, const PublicKey<DCRTPoly>
     if (cryptoParams->GetEncryptionTechnique() == EXTENDED) {
         encParams = cryptoParams->GetParamsQr();
         ptxt.SetFormat(Format::COEFFICIENT);
-        Poly bigPtxt = ptxt.CRTInterpolate();
-        DCRTPoly plain(bigPtxt, encParams);
-        ptxt     = plain;
+        DCRTPoly plain;
+        if (!LiftPlaintextToQr(ptxt, encParams, plain)) {
+            Poly bigPtxt = ptxt.CRTInterpolate();
+            plain        = DCRTPoly(bigPtxt, encParams);
+        }
+        ptxt     = std::move(plain);
         tInvModq = cryptoParams->GettInvModqr();
     }
     ptxt.SetFormat(Format::COEFFICIENT);
@@ -38,6 +38,17 @@
 #include "cryptocontext.h"
 #include "ciphertext.h"
 #include "math/dftransform.h"
+#include "utils/hashutil.h"
+#include "utils/serial.h"
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+CEREAL_CLASS_VERSION(lbcrypto::CKKSBootstrapPrecom, lbcrypto::CKKSBootstrapPrecom::SerializedVersion());
 
 namespace lbcrypto {
 
@@ -46,7 +57,7 @@ namespace lbcrypto {
 //------------------------------------------------------------------------------
 
 void FHECKKSRNS::EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::vector<uint32_t> levelBudget,
-                                    std::vector<uint32_t> dim1, uint32_t numSlots) {
+                                    std::vector<uint32_t> dim1, uint32_t numSlots, const std::string& cacheDir) {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
 
     if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
@@ -60,6 +71,37 @@ void FHECKKSRNS::EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::
     uint32_t M     = cc.GetCyclotomicOrder();
     uint32_t slots = (numSlots == 0) ? M / 4 : numSlots;
 
+    std::string cacheFile;
+    std::string cacheKey;
+    if (!cacheDir.empty()) {
+        cacheKey  = GetBootstrapPrecomCacheKey(cc, levelBudget, dim1, slots);
+        cacheFile = cacheDir + "/" + HashUtil::HashString(cacheKey) + ".bin";
+
+        std::ifstream file(cacheFile, std::ios::in | std::ios::binary);
+        if (file.is_open()) {
+            // an entry that is unreadable or was written for other parameters is recomputed and
+            // overwritten below
+            try {
+                std::string storedKey;
+                Serial::Deserialize(storedKey, file, SerType::BINARY);
+                if (storedKey == cacheKey) {
+                    auto cached = std::make_shared<CKKSBootstrapPrecom>();
+                    Serial::Deserialize(*cached, file, SerType::BINARY);
+                    if (cached->m_slots == slots && cached->m_dim1 == dim1[0]) {
+                        m_bootPrecomMap[slots] = cached;
+                        return;
+                    }
+                }
+                std::cerr << "\nWarning, the cached bootstrapping precomputations in " << cacheFile
+                          << " do not match the parameters and are recomputed" << std::endl;
+            }
+            catch (const std::exception& e) {
+                std::cerr << "\nWarning, the cached bootstrapping precomputations in " << cacheFile
+                          << " could not be loaded (" << e.what() << ") and are recomputed" << std::endl;
+            }
+        }
+    }
+
     m_bootPrecomMap[slots]                      = std::make_shared<CKKSBootstrapPrecom>();
     std::shared_ptr<CKKSBootstrapPrecom> precom = m_bootPrecomMap[slots];
 
@@ -174,6 +216,27 @@ void FHECKKSRNS::EvalBootstrapSetup(const CryptoContextImpl<DCRTPoly>& cc, std::
         precom->m_U0hatTPreFFT = EvalCoeffsToSlotsPrecompute(cc, ksiPows, rotGroup, false, scaleEnc, lEnc);
         precom->m_U0PreFFT     = EvalSlotsToCoeffsPrecompute(cc, ksiPows, rotGroup, false, scaleDec, lDec);
     }
+
+    if (!cacheFile.empty()) {
+        // write to a unique temporary file first and rename it so that concurrent workers
+        // sharing the cache never observe a partially written entry
+        std::random_device rd;
+        std::string tmpFile = cacheFile + ".tmp" + std::to_string(rd());
+        bool stored         = false;
+        {
+            std::ofstream file(tmpFile, std::ios::out | std::ios::binary);
+            if (file.is_open()) {
+                Serial::Serialize(cacheKey, file, SerType::BINARY);
+                Serial::Serialize(*precom, file, SerType::BINARY);
+                stored = file.good();
+            }
+        }
+        if (!stored || std::rename(tmpFile.c_str(), cacheFile.c_str()) != 0) {
+            std::remove(tmpFile.c_str());
+            std::cerr << "\nWarning, the bootstrapping precomputations could not be stored in " << cacheFile
+                      << std::endl;
+        }
+    }
 }
 
 std::shared_ptr<std::map<usint, EvalKey<DCRTPoly>>> FHECKKSRNS::EvalBootstrapKeyGen(
@@ -203,6 +266,92 @@ std::shared_ptr<std::map<usint, EvalKey<DCRTPoly>>> FHECKKSRNS::EvalBootstrapKey
 }
 
 Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly> ciphertext) const {
+    return EvalBootstrapInternal(ciphertext, false);
+}
+
+std::vector<Ciphertext<DCRTPoly>> FHECKKSRNS::EvalBootstrap(
+    const std::vector<Ciphertext<DCRTPoly>>& ciphertexts) const {
+    if (ciphertexts.empty())
+        OPENFHE_THROW(config_error, "EvalBootstrap: no ciphertexts to bootstrap");
+
+    const size_t size      = ciphertexts.size();
+    const size_t numPacked = (size + 1) / 2;
+
+    // the inputs and keys are validated here so that the common failures are reported
+    // before any work starts; anything thrown later inside the parallel region is
+    // captured and rethrown after it, as an exception must not leave an OpenMP region
+    for (size_t i = 0; i < size; i++) {
+        uint32_t slots = ciphertexts[i]->GetSlots();
+        if (m_bootPrecomMap.find(slots) == m_bootPrecomMap.end()) {
+            std::string errorMsg(std::string("Precomputations for ") + std::to_string(slots) +
+                                 std::string(" slots were not generated") +
+                                 std::string(" Need to call EvalBootstrapSetup and then EvalBootstrapKeyGen to proceed"));
+            OPENFHE_THROW(type_error, errorMsg);
+        }
+        if ((i % 2 == 1) && (slots != ciphertexts[i - 1]->GetSlots()))
+            OPENFHE_THROW(config_error, "EvalBootstrap: ciphertexts packed together must have the same number of slots");
+    }
+
+    auto cc         = ciphertexts[0]->GetCryptoContext();
+    auto algo       = cc->GetScheme();
+    uint32_t M      = cc->GetCyclotomicOrder();
+    auto evalKeyMap = cc->GetEvalAutomorphismKeyMapPtr(ciphertexts[0]->GetKeyTag());
+
+    if (size > 1) {
+        const auto cryptoParams =
+            std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertexts[0]->GetCryptoParameters());
+        if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
+            OPENFHE_THROW(config_error, "CKKS Bootstrapping is only supported for the Hybrid key switching method.");
+
+        // same as the scaling computed in EvalBootstrapInternal; halving it requires at least one spare bit
+        double q   = cryptoParams->GetElementParams()->GetParams()[0]->GetModulus().ConvertToDouble();
+        double deg = std::round(std::log2(q / std::pow(2, cryptoParams->GetPlaintextModulus())));
+        if (deg < 1)
+            OPENFHE_THROW(config_error,
+                          "Packed bootstrapping requires the first modulus to be larger than the scaling factor.");
+
+        // a packed pair is split with a conjugation
+        if (evalKeyMap->find(M - 1) == evalKeyMap->end())
+            OPENFHE_THROW(config_error,
+                          "EvalBootstrap: the conjugation key was not generated. Call EvalBootstrapKeyGen to proceed");
+    }
+
+    std::vector<Ciphertext<DCRTPoly>> result(size);
+
+    std::exception_ptr exception;
+#pragma omp parallel for if (numPacked > 1)
+    for (size_t i = 0; i < numPacked; i++) {
+        try {
+            if (2 * i + 1 == size) {
+                result[2 * i] = EvalBootstrapInternal(ciphertexts[2 * i], false);
+                continue;
+            }
+
+            // the messages are real, so they can be packed as ct1 + i * ct2;
+            // multiplying by X^(M/4) multiplies every slot by the imaginary unit
+            auto packed = cc->EvalAdd(ciphertexts[2 * i], algo->MultByMonomial(ciphertexts[2 * i + 1], M / 4));
+
+            // the halved result gives Re = boot + conj(boot) and Im = -i * (boot - conj(boot))
+            auto boot = EvalBootstrapInternal(packed, true);
+            auto conj = Conjugate(boot, *evalKeyMap);
+
+            result[2 * i]     = cc->EvalAdd(boot, conj);
+            result[2 * i + 1] = cc->EvalSub(boot, conj);
+            algo->MultByMonomialInPlace(result[2 * i + 1], 3 * M / 4);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return result;
+}
+
+Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrapInternal(ConstCiphertext<DCRTPoly> ciphertext, bool halveResult) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertext->GetCryptoParameters());
 
     if (cryptoParams->GetKeySwitchTechnique() != HYBRID)
@@ -269,6 +418,14 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly> ciphert
     double pre      = 1. / post;
     uint64_t scalar = std::llround(post);
 
+    // post is a power of two, so the halving is exact and consumes no level
+    if (halveResult) {
+        if (scalar < 2)
+            OPENFHE_THROW(config_error,
+                          "Packed bootstrapping requires the first modulus to be larger than the scaling factor.");
+        scalar >>= 1;
+    }
+
     //------------------------------------------------------------------------------
     // RAISING THE MODULUS
     //------------------------------------------------------------------------------
@@ -354,8 +511,8 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly> ciphert
         auto ctxtEnc = (isLTBootstrap) ? EvalLinearTransform(precom->m_U0hatTPre, raised) :
                                          EvalCoeffsToSlots(precom->m_U0hatTPreFFT, raised);
 
-        auto evalKeyMap = cc->GetEvalAutomorphismKeyMap(ctxtEnc->GetKeyTag());
-        auto conj       = Conjugate(ctxtEnc, evalKeyMap);
+        auto evalKeyMap = cc->GetEvalAutomorphismKeyMapPtr(ctxtEnc->GetKeyTag());
+        auto conj       = Conjugate(ctxtEnc, *evalKeyMap);
         auto ctxtEncI   = cc->EvalSub(ctxtEnc, conj);
         cc->EvalAddInPlace(ctxtEnc, conj);
         algo->MultByMonomialInPlace(ctxtEncI, 3 * M / 4);
@@ -448,8 +605,8 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalBootstrap(ConstCiphertext<DCRTPoly> ciphert
         auto ctxtEnc = (isLTBootstrap) ? EvalLinearTransform(precom->m_U0hatTPre, raised) :
                                          EvalCoeffsToSlots(precom->m_U0hatTPreFFT, raised);
 
-        auto evalKeyMap = cc->GetEvalAutomorphismKeyMap(ctxtEnc->GetKeyTag());
-        auto conj       = Conjugate(ctxtEnc, evalKeyMap);
+        auto evalKeyMap = cc->GetEvalAutomorphismKeyMapPtr(ctxtEnc->GetKeyTag());
+        auto conj       = Conjugate(ctxtEnc, *evalKeyMap);
         cc->EvalAddInPlace(ctxtEnc, conj);
 
         if (cryptoParams->GetScalingTechnique() == FIXEDMANUAL) {
@@ -924,7 +1081,9 @@ std::vector<ConstPlaintext> FHECKKSRNS::EvalLinearTransformPrecompute(
 
     if (orientation == 0) {
         // vertical concatenation - used during homomorphic encoding
-        // #pragma omp parallel for
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    #pragma omp parallel for
+#endif
         for (int j = 0; j < gStep; j++) {
             int offset = -bStep * j;
             for (int i = 0; i < bStep; i++) {
@@ -1073,44 +1232,44 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecompute
         auto coeff = CoeffEncodingCollapse(A, rotGroup, levelBudget, flag_i);
 
         for (int32_t s = levelBudget - 1; s > stop; s--) {
-            for (int32_t i = 0; i < b; i++) {
 #if !defined(__MINGW32__) && !defined(__MINGW64__)
     #pragma omp parallel for
 #endif
-                for (int32_t j = 0; j < g; j++) {
-                    if (g * i + j != int32_t(numRotations)) {
-                        uint32_t rot =
-                            ReduceRotation(-g * i * (1 << ((s - flagRem) * layersCollapse + remCollapse)), slots);
-                        if ((flagRem == 0) && (s == stop + 1)) {
-                            // do the scaling only at the last set of coefficients
-                            for (uint32_t k = 0; k < slots; k++) {
-                                coeff[s][g * i + j][k] *= scale;
-                            }
+            for (int32_t ij = 0; ij < b * g; ij++) {
+                int32_t i = ij / g;
+                int32_t j = ij % g;
+                if (g * i + j != int32_t(numRotations)) {
+                    uint32_t rot =
+                        ReduceRotation(-g * i * (1 << ((s - flagRem) * layersCollapse + remCollapse)), slots);
+                    if ((flagRem == 0) && (s == stop + 1)) {
+                        // do the scaling only at the last set of coefficients
+                        for (uint32_t k = 0; k < slots; k++) {
+                            coeff[s][g * i + j][k] *= scale;
                         }
+                    }
 
-                        auto rotateTemp = Rotate(coeff[s][g * i + j], rot);
+                    auto rotateTemp = Rotate(coeff[s][g * i + j], rot);
 
-                        result[s][g * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[s - stop], rotateTemp, 1, level0 - s, rotateTemp.size());
-                    }
+                    result[s][g * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[s - stop], rotateTemp, 1, level0 - s, rotateTemp.size());
                 }
             }
         }
 
         if (flagRem) {
-            for (int32_t i = 0; i < bRem; i++) {
 #pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
-                    if (gRem * i + j != int32_t(numRotationsRem)) {
-                        uint32_t rot = ReduceRotation(-gRem * i, slots);
-                        for (uint32_t k = 0; k < slots; k++) {
-                            coeff[stop][gRem * i + j][k] *= scale;
-                        }
-
-                        auto rotateTemp = Rotate(coeff[stop][gRem * i + j], rot);
-                        result[stop][gRem * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[0], rotateTemp, 1, level0, rotateTemp.size());
+            for (int32_t ij = 0; ij < bRem * gRem; ij++) {
+                int32_t i = ij / gRem;
+                int32_t j = ij % gRem;
+                if (gRem * i + j != int32_t(numRotationsRem)) {
+                    uint32_t rot = ReduceRotation(-gRem * i, slots);
+                    for (uint32_t k = 0; k < slots; k++) {
+                        coeff[stop][gRem * i + j][k] *= scale;
                     }
+
+                    auto rotateTemp = Rotate(coeff[stop][gRem * i + j], rot);
+                    result[stop][gRem * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[0], rotateTemp, 1, level0, rotateTemp.size());
                 }
             }
         }
@@ -1124,51 +1283,51 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalCoeffsToSlotsPrecompute
         auto coeffi = CoeffEncodingCollapse(A, rotGroup, levelBudget, true);
 
         for (int32_t s = levelBudget - 1; s > stop; s--) {
-            for (int32_t i = 0; i < b; i++) {
 #if !defined(__MINGW32__) && !defined(__MINGW64__)
     #pragma omp parallel for
 #endif
-                for (int32_t j = 0; j < g; j++) {
-                    if (g * i + j != int32_t(numRotations)) {
-                        uint32_t rot =
-                            ReduceRotation(-g * i * (1 << ((s - flagRem) * layersCollapse + remCollapse)), M / 4);
-                        // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
-                        auto clearTemp  = coeff[s][g * i + j];
-                        auto clearTempi = coeffi[s][g * i + j];
-                        clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
-                        if ((flagRem == 0) && (s == stop + 1)) {
-                            // do the scaling only at the last set of coefficients
-                            for (uint32_t k = 0; k < clearTemp.size(); k++) {
-                                clearTemp[k] *= scale;
-                            }
+            for (int32_t ij = 0; ij < b * g; ij++) {
+                int32_t i = ij / g;
+                int32_t j = ij % g;
+                if (g * i + j != int32_t(numRotations)) {
+                    uint32_t rot =
+                        ReduceRotation(-g * i * (1 << ((s - flagRem) * layersCollapse + remCollapse)), M / 4);
+                    // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
+                    auto clearTemp  = coeff[s][g * i + j];
+                    auto clearTempi = coeffi[s][g * i + j];
+                    clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
+                    if ((flagRem == 0) && (s == stop + 1)) {
+                        // do the scaling only at the last set of coefficients
+                        for (uint32_t k = 0; k < clearTemp.size(); k++) {
+                            clearTemp[k] *= scale;
                         }
-
-                        auto rotateTemp = Rotate(clearTemp, rot);
-                        result[s][g * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[s - stop], rotateTemp, 1, level0 - s, rotateTemp.size());
                     }
+
+                    auto rotateTemp = Rotate(clearTemp, rot);
+                    result[s][g * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[s - stop], rotateTemp, 1, level0 - s, rotateTemp.size());
                 }
             }
         }
 
         if (flagRem) {
-            for (int32_t i = 0; i < bRem; i++) {
 #pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
-                    if (gRem * i + j != int32_t(numRotationsRem)) {
-                        uint32_t rot = ReduceRotation(-gRem * i, M / 4);
-                        // concatenate the coefficients on their third dimension, which corresponds to the # of slots
-                        auto clearTemp  = coeff[stop][gRem * i + j];
-                        auto clearTempi = coeffi[stop][gRem * i + j];
-                        clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
-                        for (uint32_t k = 0; k < clearTemp.size(); k++) {
-                            clearTemp[k] *= scale;
-                        }
-
-                        auto rotateTemp = Rotate(clearTemp, rot);
-                        result[stop][gRem * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[0], rotateTemp, 1, level0, rotateTemp.size());
+            for (int32_t ij = 0; ij < bRem * gRem; ij++) {
+                int32_t i = ij / gRem;
+                int32_t j = ij % gRem;
+                if (gRem * i + j != int32_t(numRotationsRem)) {
+                    uint32_t rot = ReduceRotation(-gRem * i, M / 4);
+                    // concatenate the coefficients on their third dimension, which corresponds to the # of slots
+                    auto clearTemp  = coeff[stop][gRem * i + j];
+                    auto clearTempi = coeffi[stop][gRem * i + j];
+                    clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
+                    for (uint32_t k = 0; k < clearTemp.size(); k++) {
+                        clearTemp[k] *= scale;
                     }
+
+                    auto rotateTemp = Rotate(clearTemp, rot);
+                    result[stop][gRem * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[0], rotateTemp, 1, level0, rotateTemp.size());
                 }
             }
         }
@@ -1269,41 +1428,41 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
         auto coeff = CoeffDecodingCollapse(A, rotGroup, levelBudget, flag_i);
 
         for (int32_t s = 0; s < levelBudget - flagRem; s++) {
-            for (int32_t i = 0; i < b; i++) {
 #pragma omp parallel for
-                for (int32_t j = 0; j < g; j++) {
-                    if (g * i + j != int32_t(numRotations)) {
-                        uint32_t rot = ReduceRotation(-g * i * (1 << (s * layersCollapse)), slots);
-                        if ((flagRem == 0) && (s == levelBudget - flagRem - 1)) {
-                            // do the scaling only at the last set of coefficients
-                            for (uint32_t k = 0; k < slots; k++) {
-                                coeff[s][g * i + j][k] *= scale;
-                            }
+            for (int32_t ij = 0; ij < b * g; ij++) {
+                int32_t i = ij / g;
+                int32_t j = ij % g;
+                if (g * i + j != int32_t(numRotations)) {
+                    uint32_t rot = ReduceRotation(-g * i * (1 << (s * layersCollapse)), slots);
+                    if ((flagRem == 0) && (s == levelBudget - flagRem - 1)) {
+                        // do the scaling only at the last set of coefficients
+                        for (uint32_t k = 0; k < slots; k++) {
+                            coeff[s][g * i + j][k] *= scale;
                         }
-
-                        auto rotateTemp = Rotate(coeff[s][g * i + j], rot);
-                        result[s][g * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                     }
+
+                    auto rotateTemp = Rotate(coeff[s][g * i + j], rot);
+                    result[s][g * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                 }
             }
         }
 
         if (flagRem) {
             int32_t s = levelBudget - flagRem;
-            for (int32_t i = 0; i < bRem; i++) {
 #pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
-                    if (gRem * i + j != int32_t(numRotationsRem)) {
-                        uint32_t rot = ReduceRotation(-gRem * i * (1 << (s * layersCollapse)), slots);
-                        for (uint32_t k = 0; k < slots; k++) {
-                            coeff[s][gRem * i + j][k] *= scale;
-                        }
-
-                        auto rotateTemp = Rotate(coeff[s][gRem * i + j], rot);
-                        result[s][gRem * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
+            for (int32_t ij = 0; ij < bRem * gRem; ij++) {
+                int32_t i = ij / gRem;
+                int32_t j = ij % gRem;
+                if (gRem * i + j != int32_t(numRotationsRem)) {
+                    uint32_t rot = ReduceRotation(-gRem * i * (1 << (s * layersCollapse)), slots);
+                    for (uint32_t k = 0; k < slots; k++) {
+                        coeff[s][gRem * i + j][k] *= scale;
                     }
+
+                    auto rotateTemp = Rotate(coeff[s][gRem * i + j], rot);
+                    result[s][gRem * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                 }
             }
         }
@@ -1317,49 +1476,49 @@ std::vector<std::vector<ConstPlaintext>> FHECKKSRNS::EvalSlotsToCoeffsPrecompute
         auto coeffi = CoeffDecodingCollapse(A, rotGroup, levelBudget, true);
 
         for (int32_t s = 0; s < levelBudget - flagRem; s++) {
-            for (int32_t i = 0; i < b; i++) {
 #pragma omp parallel for
-                for (int32_t j = 0; j < g; j++) {
-                    if (g * i + j != int32_t(numRotations)) {
-                        uint32_t rot = ReduceRotation(-g * i * (1 << (s * layersCollapse)), M / 4);
-                        // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
-                        auto clearTemp  = coeff[s][g * i + j];
-                        auto clearTempi = coeffi[s][g * i + j];
-                        clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
-                        if ((flagRem == 0) && (s == levelBudget - flagRem - 1)) {
-                            // do the scaling only at the last set of coefficients
-                            for (uint32_t k = 0; k < clearTemp.size(); k++) {
-                                clearTemp[k] *= scale;
-                            }
+            for (int32_t ij = 0; ij < b * g; ij++) {
+                int32_t i = ij / g;
+                int32_t j = ij % g;
+                if (g * i + j != int32_t(numRotations)) {
+                    uint32_t rot = ReduceRotation(-g * i * (1 << (s * layersCollapse)), M / 4);
+                    // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
+                    auto clearTemp  = coeff[s][g * i + j];
+                    auto clearTempi = coeffi[s][g * i + j];
+                    clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
+                    if ((flagRem == 0) && (s == levelBudget - flagRem - 1)) {
+                        // do the scaling only at the last set of coefficients
+                        for (uint32_t k = 0; k < clearTemp.size(); k++) {
+                            clearTemp[k] *= scale;
                         }
-
-                        auto rotateTemp = Rotate(clearTemp, rot);
-                        result[s][g * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                     }
+
+                    auto rotateTemp = Rotate(clearTemp, rot);
+                    result[s][g * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                 }
             }
         }
 
         if (flagRem) {
             int32_t s = levelBudget - flagRem;
-            for (int32_t i = 0; i < bRem; i++) {
 #pragma omp parallel for
-                for (int32_t j = 0; j < gRem; j++) {
-                    if (gRem * i + j != int32_t(numRotationsRem)) {
-                        uint32_t rot = ReduceRotation(-gRem * i * (1 << (s * layersCollapse)), M / 4);
-                        // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
-                        auto clearTemp  = coeff[s][gRem * i + j];
-                        auto clearTempi = coeffi[s][gRem * i + j];
-                        clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
-                        for (uint32_t k = 0; k < clearTemp.size(); k++) {
-                            clearTemp[k] *= scale;
-                        }
-
-                        auto rotateTemp = Rotate(clearTemp, rot);
-                        result[s][gRem * i + j] =
-                            MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
+            for (int32_t ij = 0; ij < bRem * gRem; ij++) {
+                int32_t i = ij / gRem;
+                int32_t j = ij % gRem;
+                if (gRem * i + j != int32_t(numRotationsRem)) {
+                    uint32_t rot = ReduceRotation(-gRem * i * (1 << (s * layersCollapse)), M / 4);
+                    // concatenate the coefficients horizontally on their third dimension, which corresponds to the # of slots
+                    auto clearTemp  = coeff[s][gRem * i + j];
+                    auto clearTempi = coeffi[s][gRem * i + j];
+                    clearTemp.insert(clearTemp.end(), clearTempi.begin(), clearTempi.end());
+                    for (uint32_t k = 0; k < clearTemp.size(); k++) {
+                        clearTemp[k] *= scale;
                     }
+
+                    auto rotateTemp = Rotate(clearTemp, rot);
+                    result[s][gRem * i + j] =
+                        MakeAuxPlaintext(cc, paramsVector[s], rotateTemp, 1, level0 + s, rotateTemp.size());
                 }
             }
         }
@@ -1426,8 +1585,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalLinearTransform(const std::vector<ConstPlai
             inner = cc->KeySwitchDown(inner);
             // Find the automorphism index that corresponds to rotation index index.
             usint autoIndex = FindAutomorphismIndex2nComplex(bStep * j, M);
-            std::vector<usint> map(N);
-            PrecomputeAutoMap(N, autoIndex, &map);
+            const std::vector<usint>& map = GetAutoMap(N, autoIndex);
             DCRTPoly firstCurrent = inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
             first += firstCurrent;
 
@@ -1567,8 +1725,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
                     inner = cc->KeySwitchDown(inner);
                     // Find the automorphism index that corresponds to rotation index index.
                     usint autoIndex = FindAutomorphismIndex2nComplex(rot_out[s][i], M);
-                    std::vector<usint> map(N);
-                    PrecomputeAutoMap(N, autoIndex, &map);
+                    const std::vector<usint>& map = GetAutoMap(N, autoIndex);
                     first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
                     auto innerDigits = cc->EvalFastRotationPrecompute(inner);
                     EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[s][i], innerDigits, false));
@@ -1630,8 +1787,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalCoeffsToSlots(const std::vector<std::vector
                     inner = cc->KeySwitchDown(inner);
                     // Find the automorphism index that corresponds to rotation index index.
                     usint autoIndex = FindAutomorphismIndex2nComplex(rot_out[stop][i], M);
-                    std::vector<usint> map(N);
-                    PrecomputeAutoMap(N, autoIndex, &map);
+                    const std::vector<usint>& map = GetAutoMap(N, autoIndex);
                     first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
                     auto innerDigits = cc->EvalFastRotationPrecompute(inner);
                     EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[stop][i], innerDigits, false));
@@ -1780,8 +1936,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
                     inner = cc->KeySwitchDown(inner);
                     // Find the automorphism index that corresponds to rotation index index.
                     usint autoIndex = FindAutomorphismIndex2nComplex(rot_out[s][i], M);
-                    std::vector<usint> map(N);
-                    PrecomputeAutoMap(N, autoIndex, &map);
+                    const std::vector<usint>& map = GetAutoMap(N, autoIndex);
                     first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
                     auto innerDigits = cc->EvalFastRotationPrecompute(inner);
                     EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[s][i], innerDigits, false));
@@ -1843,8 +1998,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::EvalSlotsToCoeffs(const std::vector<std::vector
                     inner = cc->KeySwitchDown(inner);
                     // Find the automorphism index that corresponds to rotation index index.
                     usint autoIndex = FindAutomorphismIndex2nComplex(rot_out[s][i], M);
-                    std::vector<usint> map(N);
-                    PrecomputeAutoMap(N, autoIndex, &map);
+                    const std::vector<usint>& map = GetAutoMap(N, autoIndex);
                     first += inner->GetElements()[0].AutomorphismTransform(autoIndex, map);
                     auto innerDigits = cc->EvalFastRotationPrecompute(inner);
                     EvalAddExtInPlace(outer, cc->EvalFastRotationExt(inner, rot_out[s][i], innerDigits, false));
@@ -1885,6 +2039,39 @@ uint32_t FHECKKSRNS::GetBootstrapDepth(uint32_t approxModDepth, const std::vecto
     return GetBootstrapDepth(approxModDepth, levelBudget, cryptoParams->GetSecretKeyDist());
 }
 
+std::string FHECKKSRNS::GetBootstrapPrecomCacheKey(const CryptoContextImpl<DCRTPoly>& cc,
+                                                   const std::vector<uint32_t>& levelBudget,
+                                                   const std::vector<uint32_t>& dim1, uint32_t slots) const {
+    const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(cc.GetCryptoParameters());
+
+    std::stringstream s;
+    s << std::setprecision(17);
+    s << CKKSBootstrapPrecom().SerializedObjectName() << " v" << CKKSBootstrapPrecom::SerializedVersion()
+      << " NATIVEINT " << NATIVEINT << " M " << cc.GetCyclotomicOrder();
+
+    s << " Q";
+    const auto& paramsQ = cryptoParams->GetElementParams()->GetParams();
+    for (const auto& p : paramsQ)
+        s << " " << p->GetModulus() << ":" << p->GetRootOfUnity();
+    s << " P";
+    for (const auto& p : cryptoParams->GetParamsP()->GetParams())
+        s << " " << p->GetModulus() << ":" << p->GetRootOfUnity();
+
+    s << " " << cryptoParams->GetScalingTechnique() << " " << cryptoParams->GetSecretKeyDist() << " SF";
+    for (uint32_t l = 0; l < paramsQ.size(); l++)
+        s << " " << cryptoParams->GetScalingFactorReal(l);
+
+    s << " budget";
+    for (auto b : levelBudget)
+        s << " " << b;
+    s << " dim1";
+    for (auto d : dim1)
+        s << " " << d;
+    s << " slots " << slots;
+
+    return s.str();
+}
+
 void FHECKKSRNS::AdjustCiphertext(Ciphertext<DCRTPoly>& ciphertext, double correction) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersCKKSRNS>(ciphertext->GetCryptoParameters());
 
@@ -2284,8 +2471,7 @@ EvalKey<DCRTPoly> FHECKKSRNS::ConjugateKeyGen(const PrivateKey<DCRTPoly> private
     PrivateKey<DCRTPoly> privateKeyPermuted = std::make_shared<PrivateKeyImpl<DCRTPoly>>(cc);
 
     usint index = 2 * N - 1;
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, index, &vec);
+    const std::vector<usint>& vec = GetAutoMap(N, index);
 
     DCRTPoly sPermuted = s.AutomorphismTransform(index, vec);
 
@@ -2300,8 +2486,7 @@ Ciphertext<DCRTPoly> FHECKKSRNS::Conjugate(ConstCiphertext<DCRTPoly> ciphertext,
     const std::vector<DCRTPoly>& cv = ciphertext->GetElements();
     usint N                         = cv[0].GetRingDimension();
 
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, 2 * N - 1, &vec);
+    const std::vector<usint>& vec = GetAutoMap(N, 2 * N - 1);
 
     auto algo = ciphertext->GetCryptoContext()->GetScheme();
 
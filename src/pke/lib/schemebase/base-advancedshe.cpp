@@ -441,6 +441,197 @@ Ciphertext<Element> AdvancedSHEBase<Element>::EvalMerge(const std::vector<Cipher
     return ciphertextMerged;
 }
 
+// BFV is scale-invariant and has no modulus reduction, so only BGV/CKKS rescale the masked products
+template <class Element>
+static void MatMultRescaleInPlace(Ciphertext<Element>& ciphertext) {
+    auto cc = ciphertext->GetCryptoContext();
+    if (cc->getSchemeId() != "BFVRNS")
+        cc->GetScheme()->ModReduceInPlace(ciphertext, BASE_NUM_LEVELS_TO_DROP);
+}
+
+template <class Element>
+void AdvancedSHEBase<Element>::EvalMatMultSetup(const CryptoContextImpl<Element>& cc, uint32_t dim) {
+    const uint32_t n = dim * dim;
+    const uint32_t N = cc.GetRingDimension();
+
+    // N / 2 is a power of two, so dividing it also makes dim * dim (and dim) a power of two
+    if (dim < 2 || (N / 2) % n != 0)
+        OPENFHE_THROW(config_error, "EvalMatMultSetup: dim = " + std::to_string(dim) +
+                                        " has to be at least 2, and dim * dim = " + std::to_string(n) +
+                                        " has to divide the number of slots " + std::to_string(N / 2));
+
+    const bool isCKKS = (cc.getSchemeId() == "CKKSRNS");
+
+    // CKKS encodes the masks sparsely with d * d slots (which replicates them across all slots),
+    // BFV/BGV masks are replicated explicitly across both rows of the plaintext matrix
+    auto makeMask = [&](const std::function<bool(uint32_t, uint32_t)>& isSet) -> ConstPlaintext {
+        if (isCKKS) {
+            std::vector<double> mask(n);
+            for (uint32_t l = 0; l < n; l++)
+                mask[l] = isSet(l / dim, l % dim) ? 1 : 0;
+            return cc.MakeCKKSPackedPlaintext(mask, 1, 0, nullptr, n);
+        }
+        std::vector<int64_t> mask(N);
+        for (uint32_t l = 0; l < N; l++)
+            mask[l] = isSet((l % n) / dim, l % dim) ? 1 : 0;
+        return cc.MakePackedPlaintext(mask);
+    };
+
+    auto precom   = std::make_shared<MatMultPrecom>();
+    precom->m_dim = dim;
+    precom->m_sigmaLeft.resize(dim);
+    precom->m_sigmaRight.resize(dim);
+    precom->m_tau.resize(dim);
+    precom->m_phiLeft.resize(dim);
+    precom->m_phiRight.resize(dim);
+
+    for (uint32_t k = 0; k < dim; k++) {
+        precom->m_sigmaLeft[k] = makeMask([&](uint32_t i, uint32_t j) { return i == k && j < dim - k; });
+        precom->m_tau[k]       = makeMask([&](uint32_t i, uint32_t j) { return j == k; });
+        if (k > 0) {
+            precom->m_sigmaRight[k] = makeMask([&](uint32_t i, uint32_t j) { return i == k && j >= dim - k; });
+            precom->m_phiLeft[k]    = makeMask([&](uint32_t i, uint32_t j) { return j < dim - k; });
+            precom->m_phiRight[k]   = makeMask([&](uint32_t i, uint32_t j) { return j >= dim - k; });
+        }
+    }
+
+    m_matMultPrecomMap[dim] = precom;
+}
+
+template <class Element>
+std::vector<int32_t> AdvancedSHEBase<Element>::FindMatMultRotationIndices(uint32_t dim) const {
+    const int32_t d = dim;
+    const int32_t n = d * d;
+
+    // rotations by k and k - d (mod d * d) for the row/column shifts, by d * k for the column/row shifts
+    std::vector<int32_t> indices;
+    indices.reserve(3 * (d - 1));
+    for (int32_t k = 1; k < d; k++) {
+        indices.push_back(k);
+        indices.push_back(n - k);
+        indices.push_back(d * k);
+    }
+
+    return indices;
+}
+
+template <class Element>
+Ciphertext<Element> AdvancedSHEBase<Element>::EvalMatMult(ConstCiphertext<Element> ciphertext1,
+                                                          ConstCiphertext<Element> ciphertext2, uint32_t dim,
+                                                          const std::map<usint, EvalKey<Element>>& evalKeyMap,
+                                                          const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    auto precom = GetMatMultPrecom(ciphertext1, dim, evalKeyMap);
+    auto algo   = ciphertext1->GetCryptoContext()->GetScheme();
+
+    std::vector<Ciphertext<Element>> left  = EvalMatMultPermuteLeft(ciphertext1, *precom);
+    std::vector<Ciphertext<Element>> right = EvalMatMultPermuteRight(ciphertext2, *precom);
+
+    Ciphertext<Element> result;
+    EvalMatMultAccumulate(left, right, result);
+
+    algo->RelinearizeInPlace(result, evalKeyVec);
+    MatMultRescaleInPlace(result);
+
+    return result;
+}
+
+template <class Element>
+std::vector<std::vector<Ciphertext<Element>>> AdvancedSHEBase<Element>::EvalMatMultBlocks(
+    const std::vector<std::vector<Ciphertext<Element>>>& blocks1,
+    const std::vector<std::vector<Ciphertext<Element>>>& blocks2, uint32_t dim,
+    const std::map<usint, EvalKey<Element>>& evalKeyMap, const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    const size_t rows  = blocks1.size();
+    const size_t inner = blocks2.size();
+    const size_t cols  = (inner > 0) ? blocks2[0].size() : 0;
+
+    if (rows == 0 || inner == 0 || cols == 0)
+        OPENFHE_THROW(config_error, "EvalMatMultBlocks: the block matrices cannot be empty");
+    for (const auto& row : blocks1) {
+        if (row.size() != inner)
+            OPENFHE_THROW(config_error, "EvalMatMultBlocks: the inner block dimensions do not match");
+        for (const auto& block : row) {
+            if (!block)
+                OPENFHE_THROW(config_error, "EvalMatMultBlocks: input block is nullptr");
+        }
+    }
+    for (const auto& row : blocks2) {
+        if (row.size() != cols)
+            OPENFHE_THROW(config_error, "EvalMatMultBlocks: all block rows of the second matrix must have equal size");
+        for (const auto& block : row) {
+            if (!block)
+                OPENFHE_THROW(config_error, "EvalMatMultBlocks: input block is nullptr");
+        }
+    }
+
+    auto precom = GetMatMultPrecom(blocks1[0][0], dim, evalKeyMap);
+    auto algo   = blocks1[0][0]->GetCryptoContext()->GetScheme();
+
+    // every input block is permuted once and reused for all the output blocks it contributes to
+    std::vector<std::vector<std::vector<Ciphertext<Element>>>> left(rows,
+                                                                    std::vector<std::vector<Ciphertext<Element>>>(inner));
+    std::vector<std::vector<std::vector<Ciphertext<Element>>>> right(inner,
+                                                                     std::vector<std::vector<Ciphertext<Element>>>(cols));
+
+    // exceptions cannot leave an OpenMP region, so the first one is rethrown after the loop
+    std::exception_ptr exception;
+#pragma omp parallel for
+    for (size_t idx = 0; idx < rows * inner; idx++) {
+        try {
+            left[idx / inner][idx % inner] = EvalMatMultPermuteLeft(blocks1[idx / inner][idx % inner], *precom);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+#pragma omp parallel for
+    for (size_t idx = 0; idx < inner * cols; idx++) {
+        try {
+            right[idx / cols][idx % cols] = EvalMatMultPermuteRight(blocks2[idx / cols][idx % cols], *precom);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    std::vector<std::vector<Ciphertext<Element>>> result(rows, std::vector<Ciphertext<Element>>(cols));
+
+#pragma omp parallel for
+    for (size_t idx = 0; idx < rows * cols; idx++) {
+        try {
+            const size_t i = idx / cols;
+            const size_t j = idx % cols;
+
+            // relinearize and rescale only once per output block
+            Ciphertext<Element> sum;
+            for (size_t l = 0; l < inner; l++)
+                EvalMatMultAccumulate(left[i][l], right[l][j], sum);
+
+            algo->RelinearizeInPlace(sum, evalKeyVec);
+            MatMultRescaleInPlace(sum);
+
+            result[i][j] = sum;
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return result;
+}
+
 template <class Element>
 std::vector<usint> AdvancedSHEBase<Element>::GenerateIndices_2n(usint batchSize, usint m) const {
     // stores automorphism indices needed for EvalSum
@@ -609,6 +800,151 @@ Ciphertext<Element> AdvancedSHEBase<Element>::EvalSum2nComplexCols(
     return newCiphertext;
 }
 
+template <class Element>
+std::shared_ptr<MatMultPrecom> AdvancedSHEBase<Element>::GetMatMultPrecom(
+    ConstCiphertext<Element> ciphertext, uint32_t dim, const std::map<usint, EvalKey<Element>>& evalKeyMap) const {
+    auto pair = m_matMultPrecomMap.find(dim);
+    if (pair == m_matMultPrecomMap.end()) {
+        std::string errorMsg(std::string("Precomputations for ") + std::to_string(dim) + "x" + std::to_string(dim) +
+                             std::string(" matrices were not generated") +
+                             std::string(" Need to call EvalMatMultSetup and then EvalMatMultKeyGen to proceed"));
+        OPENFHE_THROW(type_error, errorMsg);
+    }
+
+    // EvalFastRotation does not check for missing keys, so all of them are validated upfront
+    const auto cc = ciphertext->GetCryptoContext();
+    usint M       = cc->GetCyclotomicOrder();
+    for (auto index : FindMatMultRotationIndices(dim)) {
+        if (evalKeyMap.find(cc->GetScheme()->FindAutomorphismIndex(index, M)) == evalKeyMap.end())
+            OPENFHE_THROW(config_error, "EvalMatMult: the rotation key for index " + std::to_string(index) +
+                                            " was not generated. Need to call EvalMatMultKeyGen to proceed");
+    }
+
+    return pair->second;
+}
+
+template <class Element>
+std::vector<Ciphertext<Element>> AdvancedSHEBase<Element>::EvalMatMultPermuteLeft(ConstCiphertext<Element> ciphertext,
+                                                                                  const MatMultPrecom& precom) const {
+    const uint32_t d = precom.m_dim;
+    const uint32_t n = d * d;
+
+    auto cc   = ciphertext->GetCryptoContext();
+    auto algo = cc->GetScheme();
+    usint M   = cc->GetCyclotomicOrder();
+
+    // sigma(A)[i][j] = A[i][i + j mod d]
+    auto digits = algo->EvalFastRotationPrecompute(ciphertext);
+    std::vector<Ciphertext<Element>> terms(2 * d - 1);
+    std::exception_ptr exception;
+#pragma omp parallel for
+    for (uint32_t i = 0; i < d; i++) {
+        try {
+            terms[i] = algo->EvalMult(algo->EvalFastRotation(ciphertext, i, M, digits), precom.m_sigmaLeft[i]);
+            if (i > 0)
+                terms[d + i - 1] =
+                    algo->EvalMult(algo->EvalFastRotation(ciphertext, n + i - d, M, digits), precom.m_sigmaRight[i]);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+    Ciphertext<Element> sigma = EvalAddMany(terms);
+    MatMultRescaleInPlace(sigma);
+
+    // phi^k(sigma(A))[i][j] = sigma(A)[i][j + k mod d]
+    std::vector<Ciphertext<Element>> result(d);
+    result[0] = sigma;
+    digits    = algo->EvalFastRotationPrecompute(sigma);
+#pragma omp parallel for
+    for (uint32_t k = 1; k < d; k++) {
+        try {
+            result[k] = algo->EvalAdd(algo->EvalMult(algo->EvalFastRotation(sigma, k, M, digits), precom.m_phiLeft[k]),
+                                      algo->EvalMult(algo->EvalFastRotation(sigma, n + k - d, M, digits),
+                                                     precom.m_phiRight[k]));
+            MatMultRescaleInPlace(result[k]);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return result;
+}
+
+template <class Element>
+std::vector<Ciphertext<Element>> AdvancedSHEBase<Element>::EvalMatMultPermuteRight(ConstCiphertext<Element> ciphertext,
+                                                                                   const MatMultPrecom& precom) const {
+    const uint32_t d = precom.m_dim;
+
+    auto cc   = ciphertext->GetCryptoContext();
+    auto algo = cc->GetScheme();
+    usint M   = cc->GetCyclotomicOrder();
+
+    // tau(B)[i][j] = B[i + j mod d][j]
+    auto digits = algo->EvalFastRotationPrecompute(ciphertext);
+    std::vector<Ciphertext<Element>> terms(d);
+    std::exception_ptr exception;
+#pragma omp parallel for
+    for (uint32_t j = 0; j < d; j++) {
+        try {
+            terms[j] = algo->EvalMult(algo->EvalFastRotation(ciphertext, d * j, M, digits), precom.m_tau[j]);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+    Ciphertext<Element> tau = EvalAddMany(terms);
+    MatMultRescaleInPlace(tau);
+
+    // psi^k(tau(B))[i][j] = tau(B)[i + k mod d][j] is a plain rotation by d * k
+    std::vector<Ciphertext<Element>> result(d);
+    result[0] = tau;
+    digits    = algo->EvalFastRotationPrecompute(tau);
+#pragma omp parallel for
+    for (uint32_t k = 1; k < d; k++) {
+        try {
+            result[k] = algo->EvalFastRotation(tau, d * k, M, digits);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return result;
+}
+
+template <class Element>
+void AdvancedSHEBase<Element>::EvalMatMultAccumulate(const std::vector<Ciphertext<Element>>& left,
+                                                     const std::vector<Ciphertext<Element>>& right,
+                                                     Ciphertext<Element>& result) const {
+    auto algo = left[0]->GetCryptoContext()->GetScheme();
+
+    for (size_t k = 0; k < left.size(); k++) {
+        auto product = algo->EvalMult(left[k], right[k]);
+        if (result)
+            result = algo->EvalAdd(result, product);
+        else
+            result = product;
+    }
+}
+
 }  // namespace lbcrypto
 
 // the code below is from base-advancedshe-impl.cpp
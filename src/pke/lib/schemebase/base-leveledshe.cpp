@@ -402,6 +402,8 @@ std::shared_ptr<std::map<usint, EvalKey<Element>>> LeveledSHEBase<Element>::Eval
         usint index = NativeInteger(indexList[i]).ModInverse(2 * N).ConvertToInt();
         std::vector<usint> vec(N);
         PrecomputeAutoMap(N, index, &vec);
+        // the map for indexList[i] itself is the one EvalAutomorphism will use with this key
+        GetAutoMap(N, indexList[i]);
 
         Element sPermuted = s.AutomorphismTransform(index, vec);
         privateKeyPermuted->SetPrivateElement(sPermuted);
@@ -415,6 +417,12 @@ template <class Element>
 Ciphertext<Element> LeveledSHEBase<Element>::EvalAutomorphism(ConstCiphertext<Element> ciphertext, usint i,
                                                               const std::map<usint, EvalKey<Element>>& evalKeyMap,
                                                               CALLER_INFO_ARGS_CPP) const {
+    return EvalAutomorphism(ciphertext, i, evalKeyMap.at(i));
+}
+
+template <class Element>
+Ciphertext<Element> LeveledSHEBase<Element>::EvalAutomorphism(ConstCiphertext<Element> ciphertext, usint i,
+                                                              const EvalKey<Element>& evalKey) const {
     const std::vector<Element>& cv = ciphertext->GetElements();
 
     // we already have checks on higher level?
@@ -436,14 +444,13 @@ Ciphertext<Element> LeveledSHEBase<Element>::EvalAutomorphism(ConstCiphertext<El
     //        not_available_error,
     //        "automorphism indices higher than 2*n are not allowed " + CALLER_INFO);
 
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, i, &vec);
+    const std::vector<usint>& vec = GetAutoMap(N, i);
 
     auto algo = ciphertext->GetCryptoContext()->GetScheme();
 
     Ciphertext<Element> result = ciphertext->Clone();
 
-    algo->KeySwitchInPlace(result, evalKeyMap.at(i));
+    algo->KeySwitchInPlace(result, evalKey);
 
     std::vector<Element>& rcv = result->GetElements();
 
@@ -475,7 +482,8 @@ Ciphertext<Element> LeveledSHEBase<Element>::EvalFastRotation(
 
     usint autoIndex = FindAutomorphismIndex(index, m);
 
-    auto evalKey = cc->GetEvalAutomorphismKeyMap(ciphertext->GetKeyTag()).find(autoIndex)->second;
+    auto keys           = cc->ReadEvalKeys();
+    const auto& evalKey = keys.GetAutomorphismKey(ciphertext->GetKeyTag(), autoIndex);
 
     auto algo                       = cc->GetScheme();
     const std::vector<DCRTPoly>& cv = ciphertext->GetElements();
@@ -485,8 +493,7 @@ Ciphertext<Element> LeveledSHEBase<Element>::EvalFastRotation(
     const auto cryptoParams = ciphertext->GetCryptoParameters();
 
     usint N = cryptoParams->GetElementParams()->GetRingDimension();
-    std::vector<usint> vec(N);
-    PrecomputeAutoMap(N, autoIndex, &vec);
+    const std::vector<usint>& vec = GetAutoMap(N, autoIndex);
 
     (*ba)[0] += cv[0];
 
@@ -267,13 +267,7 @@ DecryptResult MultipartyBase<Element>::MultipartyDecryptFusion(const std::vector
     const auto cryptoParams =
         std::dynamic_pointer_cast<CryptoParametersRLWE<Element>>(ciphertextVec[0]->GetCryptoParameters());
 
-    const std::vector<Element>& cv0 = ciphertextVec[0]->GetElements();
-
-    Element b = cv0[0];
-    for (size_t i = 1; i < ciphertextVec.size(); i++) {
-        const std::vector<Element>& cvi = ciphertextVec[i]->GetElements();
-        b += cvi[0];
-    }
+    Element b = FusePartialDecryptions(ciphertextVec);
     b.SetFormat(Format::COEFFICIENT);
 
     *plaintext = b.ToNativePoly();
@@ -414,6 +408,228 @@ std::shared_ptr<std::map<usint, EvalKey<Element>>> MultipartyBase<Element>::Mult
     return EvalKeyMapSum;
 }
 
+template <class Element>
+PublicKey<Element> MultipartyBase<Element>::MultiAddPubKeys(const std::vector<PublicKey<Element>>& publicKeyVec) const {
+    const auto cc = publicKeyVec[0]->GetCryptoContext();
+
+    PublicKey<Element> publicKeySum = std::make_shared<PublicKeyImpl<Element>>(cc);
+
+    const std::vector<Element>& pk0 = publicKeyVec[0]->GetPublicElements();
+
+    Element b = pk0[0];
+    std::vector<const Element*> summands;
+    summands.reserve(publicKeyVec.size() - 1);
+    for (size_t i = 1; i < publicKeyVec.size(); i++)
+        summands.push_back(&publicKeyVec[i]->GetPublicElements()[0]);
+    AddElementsInPlace(&b, 1, summands);
+
+    publicKeySum->SetPublicElementAtIndex(0, std::move(b));
+    publicKeySum->SetPublicElementAtIndex(1, pk0[1]);
+
+    return publicKeySum;
+}
+
+template <class Element>
+EvalKey<Element> MultipartyBase<Element>::MultiAddEvalKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    const auto cc = evalKeyVec[0]->GetCryptoContext();
+
+    EvalKey<Element> evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(cc);
+
+    std::vector<Element> b = evalKeyVec[0]->GetBVector();
+
+    std::vector<const Element*> summands;
+    summands.reserve(evalKeyVec.size() - 1);
+    for (size_t i = 1; i < evalKeyVec.size(); i++) {
+        const std::vector<Element>& bi = evalKeyVec[i]->GetBVector();
+        if (bi.size() != b.size())
+            OPENFHE_THROW(config_error, "Evaluation keys have different numbers of elements");
+        summands.push_back(bi.data());
+    }
+    AddElementsInPlace(b.data(), b.size(), summands);
+
+    evalKeySum->SetAVector(evalKeyVec[0]->GetAVector());
+    evalKeySum->SetBVector(std::move(b));
+
+    return evalKeySum;
+}
+
+template <class Element>
+EvalKey<Element> MultipartyBase<Element>::MultiAddEvalMultKeys(const std::vector<EvalKey<Element>>& evalKeyVec) const {
+    const auto cc = evalKeyVec[0]->GetCryptoContext();
+
+    EvalKey<Element> evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(cc);
+
+    std::vector<Element> a = evalKeyVec[0]->GetAVector();
+    std::vector<Element> b = evalKeyVec[0]->GetBVector();
+
+    std::vector<const Element*> summandsA;
+    std::vector<const Element*> summandsB;
+    summandsA.reserve(evalKeyVec.size() - 1);
+    summandsB.reserve(evalKeyVec.size() - 1);
+    for (size_t i = 1; i < evalKeyVec.size(); i++) {
+        const std::vector<Element>& ai = evalKeyVec[i]->GetAVector();
+        const std::vector<Element>& bi = evalKeyVec[i]->GetBVector();
+        if (ai.size() != a.size() || bi.size() != b.size())
+            OPENFHE_THROW(config_error, "Evaluation keys have different numbers of elements");
+        summandsA.push_back(ai.data());
+        summandsB.push_back(bi.data());
+    }
+    AddElementsInPlace(a.data(), a.size(), summandsA);
+    AddElementsInPlace(b.data(), b.size(), summandsB);
+
+    evalKeySum->SetAVector(std::move(a));
+    evalKeySum->SetBVector(std::move(b));
+
+    return evalKeySum;
+}
+
+template <class Element>
+std::shared_ptr<std::map<usint, EvalKey<Element>>> MultipartyBase<Element>::MultiAddEvalAutomorphismKeys(
+    const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec) const {
+    auto evalKeyMapAuto = std::make_shared<std::map<usint, EvalKey<Element>>>();
+
+    std::vector<EvalKey<Element>> evalKeyVec(evalKeyMapVec.size());
+    for (const auto& entry : *evalKeyMapVec[0]) {
+        evalKeyVec[0] = entry.second;
+        bool found    = true;
+        for (size_t i = 1; i < evalKeyMapVec.size() && found; i++) {
+            auto it = evalKeyMapVec[i]->find(entry.first);
+            found   = (it != evalKeyMapVec[i]->end());
+            if (found)
+                evalKeyVec[i] = it->second;
+        }
+        if (found)
+            (*evalKeyMapAuto)[entry.first] = MultiAddEvalKeys(evalKeyVec);
+    }
+
+    return evalKeyMapAuto;
+}
+
+template <class Element>
+std::shared_ptr<std::map<usint, EvalKey<Element>>> MultipartyBase<Element>::MultiAddEvalSumKeys(
+    const std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>>& evalKeyMapVec) const {
+    return MultiAddEvalAutomorphismKeys(evalKeyMapVec);
+}
+
+template <class Element>
+void MultipartyBase<Element>::MultiAddPubKeysInPlace(PublicKey<Element>& publicKeySum,
+                                                     PublicKey<Element> publicKey) const {
+    if (!publicKeySum) {
+        publicKeySum = std::make_shared<PublicKeyImpl<Element>>(publicKey->GetCryptoContext());
+        publicKeySum->SetPublicElements(publicKey->GetPublicElements());
+        return;
+    }
+
+    AddElementsInPlace(&publicKeySum->GetPublicElements()[0], 1, {&publicKey->GetPublicElements()[0]});
+}
+
+template <class Element>
+void MultipartyBase<Element>::MultiAddEvalKeysInPlace(EvalKey<Element>& evalKeySum, EvalKey<Element> evalKey) const {
+    if (!evalKeySum) {
+        evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(evalKey->GetCryptoContext());
+        evalKeySum->SetAVector(evalKey->GetAVector());
+        evalKeySum->SetBVector(evalKey->GetBVector());
+        return;
+    }
+
+    std::vector<Element>& b        = evalKeySum->GetBVector();
+    const std::vector<Element>& bi = evalKey->GetBVector();
+    if (bi.size() != b.size())
+        OPENFHE_THROW(config_error, "Evaluation keys have different numbers of elements");
+    AddElementsInPlace(b.data(), b.size(), {bi.data()});
+}
+
+template <class Element>
+void MultipartyBase<Element>::MultiAddEvalMultKeysInPlace(EvalKey<Element>& evalKeySum,
+                                                          EvalKey<Element> evalKey) const {
+    if (!evalKeySum) {
+        evalKeySum = std::make_shared<EvalKeyRelinImpl<Element>>(evalKey->GetCryptoContext());
+        evalKeySum->SetAVector(evalKey->GetAVector());
+        evalKeySum->SetBVector(evalKey->GetBVector());
+        return;
+    }
+
+    std::vector<Element>& a        = evalKeySum->GetAVector();
+    std::vector<Element>& b        = evalKeySum->GetBVector();
+    const std::vector<Element>& ai = evalKey->GetAVector();
+    const std::vector<Element>& bi = evalKey->GetBVector();
+    if (ai.size() != a.size() || bi.size() != b.size())
+        OPENFHE_THROW(config_error, "Evaluation keys have different numbers of elements");
+    AddElementsInPlace(a.data(), a.size(), {ai.data()});
+    AddElementsInPlace(b.data(), b.size(), {bi.data()});
+}
+
+template <class Element>
+void MultipartyBase<Element>::MultiAddEvalAutomorphismKeysInPlace(
+    std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+    const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap) const {
+    if (!evalKeyMapSum) {
+        evalKeyMapSum = std::make_shared<std::map<usint, EvalKey<Element>>>();
+        for (const auto& entry : *evalKeyMap)
+            MultiAddEvalKeysInPlace((*evalKeyMapSum)[entry.first], entry.second);
+        return;
+    }
+
+    for (auto it = evalKeyMapSum->begin(); it != evalKeyMapSum->end();) {
+        auto it2 = evalKeyMap->find(it->first);
+        if (it2 == evalKeyMap->end()) {
+            it = evalKeyMapSum->erase(it);
+            continue;
+        }
+        MultiAddEvalKeysInPlace(it->second, it2->second);
+        ++it;
+    }
+}
+
+template <class Element>
+void MultipartyBase<Element>::MultiAddEvalSumKeysInPlace(
+    std::shared_ptr<std::map<usint, EvalKey<Element>>>& evalKeyMapSum,
+    const std::shared_ptr<std::map<usint, EvalKey<Element>>> evalKeyMap) const {
+    MultiAddEvalAutomorphismKeysInPlace(evalKeyMapSum, evalKeyMap);
+}
+
+template <class Element>
+void MultipartyBase<Element>::AddElementsInPlace(Element* sum, size_t size,
+                                                 const std::vector<const Element*>& summands) {
+    if (size == 0 || summands.empty())
+        return;
+
+    const size_t numTowers = sum[0].GetNumOfElements();
+    for (size_t i = 0; i < size; i++) {
+        if (sum[i].GetNumOfElements() != numTowers)
+            OPENFHE_THROW(config_error, "Elements being added have different numbers of towers");
+        for (const Element* summand : summands) {
+            if (summand[i].GetNumOfElements() != numTowers)
+                OPENFHE_THROW(config_error, "Elements being added have different numbers of towers");
+        }
+    }
+
+    // each tower of the sum is owned by one thread, which streams the
+    // matching tower of every summand through it
+    const size_t count = size * numTowers;
+#pragma omp parallel for
+    for (size_t k = 0; k < count; k++) {
+        const size_t i = k / numTowers;
+        const size_t j = k % numTowers;
+        auto& tower    = sum[i].ElementAtIndex(j);
+        for (const Element* summand : summands)
+            tower += summand[i].GetElementAtIndex(j);
+    }
+}
+
+template <class Element>
+Element MultipartyBase<Element>::FusePartialDecryptions(const std::vector<Ciphertext<Element>>& ciphertextVec) {
+    Element b = ciphertextVec[0]->GetElements()[0];
+
+    std::vector<const Element*> summands;
+    summands.reserve(ciphertextVec.size() - 1);
+    for (size_t i = 1; i < ciphertextVec.size(); i++)
+        summands.push_back(&ciphertextVec[i]->GetElements()[0]);
+    AddElementsInPlace(&b, 1, summands);
+
+    return b;
+}
+
 }  // namespace lbcrypto
 
 // the code below is from base-multiparty-impl.cpp
@@ -35,6 +35,8 @@
 
 #include "schemebase/base-scheme.h"
 
+#include <exception>
+
 namespace lbcrypto {
 
 template <class Element>
@@ -66,6 +68,33 @@ Ciphertext<Element> PREBase<Element>::ReEncrypt(ConstCiphertext<Element> ciphert
     return result;
 }
 
+template <class Element>
+std::vector<Ciphertext<Element>> PREBase<Element>::ReEncrypt(const std::vector<Ciphertext<Element>>& ciphertextVec,
+                                                             const EvalKey<Element> evalKey,
+                                                             const PublicKey<Element> publicKey) const {
+    std::vector<Ciphertext<Element>> result(ciphertextVec.size());
+
+    // the ciphertexts are independent, so the batch rather than the towers of a
+    // single ciphertext is split across the threads; the per-tower loops inside
+    // the key switch then run without nested fork/join overhead
+    std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic) if (ciphertextVec.size() > 1)
+    for (size_t i = 0; i < ciphertextVec.size(); i++) {
+        try {
+            result[i] = ReEncrypt(ciphertextVec[i], evalKey, publicKey);
+        }
+        catch (...) {
+#pragma omp critical
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    return result;
+}
+
 }  // namespace lbcrypto
 
 // the code below is from base-pre-impl.cpp
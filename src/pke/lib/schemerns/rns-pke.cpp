@@ -105,6 +105,20 @@ DecryptResult PKERNS::Decrypt(ConstCiphertext<DCRTPoly> ciphertext, const Privat
     return DecryptResult(plaintext->GetLength());
 }
 
+DecryptResult PKERNS::Decrypt(ConstCiphertext<DCRTPoly> ciphertext, const PrivateKey<DCRTPoly> privateKey,
+                              DCRTPoly* plaintext) const {
+    const std::vector<DCRTPoly>& cv = ciphertext->GetElements();
+    DCRTPoly b                      = DecryptCore(cv, privateKey);
+
+    if (b.GetParams()->GetParams().size() == 0)
+        OPENFHE_THROW(math_error, "Decryption failure: No towers left; consider increasing the depth.");
+
+    b.SetFormat(Format::COEFFICIENT);
+    *plaintext = std::move(b);
+
+    return DecryptResult(plaintext->GetLength());
+}
+
 std::shared_ptr<std::vector<DCRTPoly>> PKERNS::EncryptZeroCore(const PrivateKey<DCRTPoly> privateKey,
                                                                const std::shared_ptr<ParmType> params) const {
     const auto cryptoParams = std::dynamic_pointer_cast<CryptoParametersRNS>(privateKey->GetCryptoParameters());
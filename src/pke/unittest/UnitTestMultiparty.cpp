@@ -49,6 +49,7 @@ enum TEST_CASE_TYPE {
     BFVRNS_TEST,
     BGVRNS_TEST,
     BFVRNS_TEST_EXTRA,
+    AGGREGATION_TEST,
 };
 
 static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
@@ -66,6 +67,9 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case BFVRNS_TEST_EXTRA:
             typeName = "BFVRNS_TEST_EXTRA";
             break;
+        case AGGREGATION_TEST:
+            typeName = "AGGREGATION_TEST";
+            break;
         default:
             typeName = "UNKNOWN";
             break;
@@ -271,6 +275,11 @@ static std::vector<TEST_CASE_UTGENERAL_MULTIPARTY> testCases = {
     { BFVRNS_TEST_EXTRA, "14", {BFVRNS_SCHEME, DFLT, DFLT,  60,       20,   DFLT,    UNIFORM_TERNARY, DFLT,          DFLT,     DFLT,         DFLT,   DFLT,         DFLT,    16,    DFLT,   DFLT,      DFLT, HPSPOVERQ,        EXTENDED, DFLT},   false,    0},
     { BFVRNS_TEST_EXTRA, "15", {BFVRNS_SCHEME, DFLT, DFLT,  60,       20,   DFLT,    GAUSSIAN,        DFLT,          DFLT,     DFLT,         DFLT,   DFLT,         DFLT,    4,     DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, EXTENDED, DFLT},   false,    0},
     { BFVRNS_TEST_EXTRA, "16", {BFVRNS_SCHEME, DFLT, DFLT,  60,       20,   DFLT,    UNIFORM_TERNARY, DFLT,          DFLT,     DFLT,         DFLT,   DFLT,         DFLT,    16,    DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, EXTENDED, DFLT},   false,    0},
+    // ==========================================
+    // TestType,  Descr, Scheme,          RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist,      MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,    LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech,  PREMode, Star, Slots
+    { AGGREGATION_TEST, "01", {CKKSRNS_SCHEME, 2048, 2,       50,       3,     BATCH,   DFLT,            DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,   DFLT,    DFLT,  DFLT,   0,         0,    DFLT,     DFLT,     DFLT},   false,    0},
+    { AGGREGATION_TEST, "02", {BFVRNS_SCHEME,  DFLT, DFLT,    60,       20,    DFLT,    UNIFORM_TERNARY, DFLT,          DFLT,     DFLT,         DFLT,   DFLT,        DFLT,    65537, DFLT,   DFLT,      DFLT, HPS,      STANDARD, DFLT},   false,    0},
+    { AGGREGATION_TEST, "03", {BGVRNS_SCHEME,  256,  2,       DFLT,     3,     BATCH,   UNIFORM_TERNARY, 1,             60,       HEStd_NotSet, BV,     FIXEDMANUAL, DFLT,    65537, DFLT,   DFLT,      DFLT, DFLT,     DFLT,     DFLT},   false,    0},
 };
 // clang-format on
 //===========================================================================================================
@@ -699,6 +708,150 @@ protected:
             EXPECT_TRUE(0 == 1) << failmsg;
         }
     }
+
+    // checks that the n-ary and streaming aggregation APIs give the same keys as the pairwise ones
+    void UnitTestMultipartyAggregation(const TEST_CASE_UTGENERAL_MULTIPARTY& testData,
+                                       const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            const size_t numParties      = 5;
+            const std::string keyId      = "aggregated";
+            std::vector<int32_t> indices = {1, 2};
+
+            std::vector<KeyPair<Element>> kps{cc->KeyGen()};
+            for (size_t i = 1; i < numParties; i++)
+                kps.push_back(cc->MultipartyKeyGen(kps[0].publicKey, false, true));
+
+            auto evalKey0 = cc->KeySwitchGen(kps[0].secretKey, kps[0].secretKey);
+            cc->EvalAtIndexKeyGen(kps[0].secretKey, indices);
+            auto evalAutoKeys0 = std::make_shared<std::map<usint, EvalKey<Element>>>(
+                cc->GetEvalAutomorphismKeyMap(kps[0].secretKey->GetKeyTag()));
+
+            std::vector<PublicKey<Element>> publicKeys;
+            std::vector<EvalKey<Element>> evalKeys{evalKey0};
+            std::vector<std::shared_ptr<std::map<usint, EvalKey<Element>>>> evalAutoKeys{evalAutoKeys0};
+            for (size_t i = 0; i < numParties; i++) {
+                publicKeys.push_back(kps[i].publicKey);
+                if (i > 0) {
+                    evalKeys.push_back(cc->MultiKeySwitchGen(kps[i].secretKey, kps[i].secretKey, evalKey0));
+                    evalAutoKeys.push_back(cc->MultiEvalAtIndexKeyGen(kps[i].secretKey, evalAutoKeys0, indices));
+                }
+            }
+
+            // public keys
+            auto publicKeyFold = publicKeys[0];
+            for (size_t i = 1; i < numParties; i++)
+                publicKeyFold = cc->MultiAddPubKeys(publicKeyFold, publicKeys[i], keyId);
+            auto publicKeyJoin = cc->MultiAddPubKeys(publicKeys, keyId);
+            PublicKey<Element> publicKeyStream;
+            for (const auto& publicKey : publicKeys)
+                cc->MultiAddPubKeysInPlace(publicKeyStream, publicKey, keyId);
+            EXPECT_TRUE(*publicKeyFold == *publicKeyJoin) << failmsg << " n-ary public key sum differs";
+            EXPECT_TRUE(*publicKeyFold == *publicKeyStream) << failmsg << " streamed public key sum differs";
+
+            // relinearization keys
+            auto evalKeyFold = evalKeys[0];
+            for (size_t i = 1; i < numParties; i++)
+                evalKeyFold = cc->MultiAddEvalKeys(evalKeyFold, evalKeys[i], keyId);
+            auto evalKeyJoin = cc->MultiAddEvalKeys(evalKeys, keyId);
+            EvalKey<Element> evalKeyStream;
+            for (const auto& evalKey : evalKeys)
+                cc->MultiAddEvalKeysInPlace(evalKeyStream, evalKey, keyId);
+            EXPECT_TRUE(*evalKeyFold == *evalKeyJoin) << failmsg << " n-ary evaluation key sum differs";
+            EXPECT_TRUE(*evalKeyFold == *evalKeyStream) << failmsg << " streamed evaluation key sum differs";
+
+            std::vector<EvalKey<Element>> evalMultKeys;
+            for (size_t i = 0; i < numParties; i++)
+                evalMultKeys.push_back(cc->MultiMultEvalKey(kps[i].secretKey, evalKeyJoin));
+            auto evalMultKeyFold = evalMultKeys[0];
+            for (size_t i = 1; i < numParties; i++)
+                evalMultKeyFold = cc->MultiAddEvalMultKeys(evalMultKeyFold, evalMultKeys[i], keyId);
+            auto evalMultKeyJoin = cc->MultiAddEvalMultKeys(evalMultKeys, keyId);
+            EvalKey<Element> evalMultKeyStream;
+            for (const auto& evalMultKey : evalMultKeys)
+                cc->MultiAddEvalMultKeysInPlace(evalMultKeyStream, evalMultKey, keyId);
+            EXPECT_TRUE(*evalMultKeyFold == *evalMultKeyJoin) << failmsg << " n-ary mult key sum differs";
+            EXPECT_TRUE(*evalMultKeyFold == *evalMultKeyStream) << failmsg << " streamed mult key sum differs";
+
+            // automorphism keys; the streamed sum must not modify the shares
+            auto evalAutoKeysFold = evalAutoKeys[0];
+            for (size_t i = 1; i < numParties; i++)
+                evalAutoKeysFold = cc->MultiAddEvalAutomorphismKeys(evalAutoKeysFold, evalAutoKeys[i], keyId);
+            auto evalAutoKeysJoin = cc->MultiAddEvalAutomorphismKeys(evalAutoKeys, keyId);
+            auto evalSumKeysJoin  = cc->MultiAddEvalSumKeys(evalAutoKeys, keyId);
+            std::shared_ptr<std::map<usint, EvalKey<Element>>> evalAutoKeysStream;
+            for (const auto& evalAutoKeyMap : evalAutoKeys)
+                cc->MultiAddEvalAutomorphismKeysInPlace(evalAutoKeysStream, evalAutoKeyMap, keyId);
+            auto evalAutoKeysAgain = cc->MultiAddEvalAutomorphismKeys(evalAutoKeys, keyId);
+
+            ASSERT_EQ(evalAutoKeysFold->size(), indices.size()) << failmsg;
+            ASSERT_EQ(evalAutoKeysJoin->size(), indices.size()) << failmsg;
+            ASSERT_EQ(evalSumKeysJoin->size(), indices.size()) << failmsg;
+            ASSERT_EQ(evalAutoKeysStream->size(), indices.size()) << failmsg;
+            for (const auto& entry : *evalAutoKeysFold) {
+                EXPECT_TRUE(*entry.second == *evalAutoKeysJoin->at(entry.first))
+                    << failmsg << " n-ary automorphism key sum differs";
+                EXPECT_TRUE(*entry.second == *evalSumKeysJoin->at(entry.first))
+                    << failmsg << " n-ary summation key sum differs";
+                EXPECT_TRUE(*entry.second == *evalAutoKeysStream->at(entry.first))
+                    << failmsg << " streamed automorphism key sum differs";
+                EXPECT_TRUE(*entry.second == *evalAutoKeysAgain->at(entry.first))
+                    << failmsg << " streamed sum modified a share";
+            }
+
+            // decryption with the joined keys
+            std::vector<PrivateKey<Element>> secretKeys;
+            for (const auto& kp : kps)
+                secretKeys.push_back(kp.secretKey);
+            KeyPair<Element> kpMultiparty = cc->MultipartyKeyGen(secretKeys);
+            ASSERT_TRUE(kpMultiparty.good()) << failmsg << " kpMultiparty generation failed";
+
+            std::vector<int64_t> vectorOfInts{1, 2, 3, 4, 5, 6, 5, 4, 3, 2, 1, 0};
+            std::vector<double> vectorOfDoubles(vectorOfInts.begin(), vectorOfInts.end());
+            Plaintext plaintext = (CKKSRNS_SCHEME == testData.params.schemeId) ?
+                                      cc->MakeCKKSPackedPlaintext(vectorOfDoubles) :
+                                      cc->MakePackedPlaintext(vectorOfInts);
+            auto ciphertext = cc->Encrypt(publicKeyJoin, plaintext);
+
+            std::vector<Ciphertext<Element>> partialCiphertextVec{
+                cc->MultipartyDecryptLead({ciphertext}, kps[0].secretKey)[0]};
+            for (size_t i = 1; i < numParties; i++)
+                partialCiphertextVec.push_back(cc->MultipartyDecryptMain({ciphertext}, kps[i].secretKey)[0]);
+
+            Plaintext plaintextMultiparty;
+            cc->MultipartyDecryptFusion(partialCiphertextVec, &plaintextMultiparty);
+            plaintextMultiparty->SetLength(vectorOfInts.size());
+
+            Plaintext plaintextJoint;
+            cc->Decrypt(kpMultiparty.secretKey, ciphertext, &plaintextJoint);
+            plaintextJoint->SetLength(vectorOfInts.size());
+
+            if (CKKSRNS_SCHEME == testData.params.schemeId) {
+                checkEquality(vectorOfDoubles, plaintextMultiparty->GetRealPackedValue(), 0.0001,
+                              failmsg + " Multiparty decryption with the n-ary public key failed");
+                checkEquality(vectorOfDoubles, plaintextJoint->GetRealPackedValue(), 0.0001,
+                              failmsg + " Decryption with the joint secret key failed");
+            }
+            else {
+                checkEquality(vectorOfInts, plaintextMultiparty->GetPackedValue(), EPSILON,
+                              failmsg + " Multiparty decryption with the n-ary public key failed");
+                checkEquality(vectorOfInts, plaintextJoint->GetPackedValue(), EPSILON,
+                              failmsg + " Decryption with the joint secret key failed");
+            }
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
 };
 //===========================================================================================================
 TEST_P(UTGENERAL_MULTIPARTY, Multiparty) {
@@ -706,6 +859,8 @@ TEST_P(UTGENERAL_MULTIPARTY, Multiparty) {
     auto test = GetParam();
     if (test.testCaseType == BFVRNS_TEST_EXTRA)
         UnitTestMultiparty(test, test.buildTestName());
+    else if (test.testCaseType == AGGREGATION_TEST)
+        UnitTestMultipartyAggregation(test, test.buildTestName());
     else
         UnitTest_MultiParty(test, test.buildTestName());
 }
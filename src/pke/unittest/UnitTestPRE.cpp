@@ -212,6 +212,27 @@ protected:
             result                            = cc->Decrypt(newKp.secretKey, reCiphertext7, &plaintextIntNew2);
             EXPECT_EQ(plaintextIntNew2->GetCoefPackedValue(), plaintextInt->GetCoefPackedValue())
                 << failmsg << " HRA-secure ReEncrypt integer plaintext";
+
+            std::vector<Plaintext> plaintexts{plaintextShort, plaintextFull, plaintextInt, plaintextShort, plaintextInt};
+            std::vector<Ciphertext<Element>> ciphertexts;
+            for (const auto& plaintext : plaintexts)
+                ciphertexts.push_back(cc->Encrypt(kp.publicKey, plaintext));
+
+            for (const auto& recipientKey : {PublicKey<Element>(), kp.publicKey}) {
+                std::string mode = recipientKey ? " HRA-secure" : "";
+                auto reCiphertexts = cc->ReEncrypt(ciphertexts, evalKey, recipientKey);
+                ASSERT_EQ(reCiphertexts.size(), ciphertexts.size()) << failmsg << mode << " batched ReEncrypt size";
+                for (size_t i = 0; i < reCiphertexts.size(); i++) {
+                    Plaintext plaintextNew;
+                    cc->Decrypt(newKp.secretKey, reCiphertexts[i], &plaintextNew);
+                    if (plaintexts[i] == plaintextInt)
+                        EXPECT_EQ(plaintextNew->GetCoefPackedValue(), plaintexts[i]->GetCoefPackedValue())
+                            << failmsg << mode << " batched ReEncrypt integer plaintext at index " << i;
+                    else
+                        EXPECT_EQ(plaintextNew->GetStringValue(), plaintexts[i]->GetStringValue())
+                            << failmsg << mode << " batched ReEncrypt string plaintext at index " << i;
+                }
+            }
         }
         catch (std::exception& e) {
             std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
@@ -51,8 +51,10 @@ enum TEST_CASE_TYPE {
     ADD_PACKED = 0,
     MULT_COEF_PACKED,
     MULT_PACKED,
+    MULT_PACKED_PRECOMP,
     EVALATINDEX,
     EVALMERGE,
+    EVALMATMULT,
     EVALSUM,
     METADATA,
     EVALSUM_ALL,
@@ -72,12 +74,18 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case MULT_PACKED:
             typeName = "MULT_PACKED";
             break;
+        case MULT_PACKED_PRECOMP:
+            typeName = "MULT_PACKED_PRECOMP";
+            break;
         case EVALATINDEX:
             typeName = "EVALATINDEX";
             break;
         case EVALMERGE:
             typeName = "EVALMERGE";
             break;
+        case EVALMATMULT:
+            typeName = "EVALMATMULT";
+            break;
         case EVALSUM:
             typeName = "EVALSUM";
             break;
@@ -266,6 +274,16 @@ static std::vector<TEST_CASE_UTGENERAL_SHE> testCases = {
     { MULT_PACKED, "39", {BFVRNS_SCHEME, DFLT, DFLT,      60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         HYBRID, DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, EXTENDED,  DFLT}, },
     { MULT_PACKED, "40", {BFVRNS_SCHEME, DFLT, DFLT,      60,       20,       BATCH,   GAUSSIAN,         DFLT,          DFLT,     DFLT,         HYBRID, DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, EXTENDED,  DFLT}, },
     // ==========================================
+    // TestType,           Descr, Scheme,        RDim, MultDepth, SModSize, DSize,    BatchSz, SecKeyDist,       MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod,   StdDev, EvalAddCt, KSCt, MultTech,         EncTech,   PREMode
+    { MULT_PACKED_PRECOMP, "01", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         BV,     DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPS,              STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "02", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         BV,     DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, BEHZ,             STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "03", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         BV,     DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQ,        STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "04", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         BV,     DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "05", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         HYBRID, DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPS,              STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "06", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         HYBRID, DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, BEHZ,             STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "07", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         HYBRID, DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQ,        STANDARD,  DFLT}, },
+    { MULT_PACKED_PRECOMP, "08", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         HYBRID, DFLT,            DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, STANDARD,  DFLT}, },
+    // ==========================================
     // TestType,   Descr, Scheme,        RDim, MultDepth, SModSize, DSize,    BatchSz, SecKeyDist,       MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod,   StdDev, EvalAddCt, KSCt, MultTech,         EncTech,   PREMode
     { EVALATINDEX, "01", {BGVRNS_SCHEME, 256,  2,         DFLT,     BV_DSIZE, BATCH,   UNIFORM_TERNARY,  1,             60,       HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, DFLT,             STANDARD,  DFLT}, },
     { EVALATINDEX, "02", {BGVRNS_SCHEME, 256,  2,         DFLT,     BV_DSIZE, BATCH,   UNIFORM_TERNARY,  1,             60,       HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, DFLT,             STANDARD,  DFLT}, },
@@ -335,6 +353,12 @@ static std::vector<TEST_CASE_UTGENERAL_SHE> testCases = {
     { EVALMERGE,  "24", {BFVRNS_SCHEME, DFLT, DFLT,      60,       20,       BATCH,   GAUSSIAN,         DFLT,          DFLT,     DFLT,         DFLT,   FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPSPOVERQLEVELED, EXTENDED,  DFLT}, },
     // ==========================================
     // TestType,   Descr, Scheme,       RDim, MultDepth, SModSize, DSize,    BatchSz, SecKeyDist,       MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod,   StdDev, EvalAddCt, KSCt, MultTech,         EncTech,   PREMode
+    { EVALMATMULT, "01", {BGVRNS_SCHEME, 256,  3,         DFLT,     BV_DSIZE, BATCH,   UNIFORM_TERNARY,  1,             60,       HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, DFLT,             STANDARD,  DFLT}, },
+    { EVALMATMULT, "02", {BGVRNS_SCHEME, 256,  3,         DFLT,     BV_DSIZE, BATCH,   UNIFORM_TERNARY,  1,             60,       HEStd_NotSet, BV,     FLEXIBLEAUTO,    DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, DFLT,             STANDARD,  DFLT}, },
+    { EVALMATMULT, "03", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         DFLT,   FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPS,              STANDARD,  DFLT}, },
+    { EVALMATMULT, "04", {BFVRNS_SCHEME, DFLT, 3,         60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         DFLT,   FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, BEHZ,             STANDARD,  DFLT}, },
+    // ==========================================
+    // TestType,   Descr, Scheme,       RDim, MultDepth, SModSize, DSize,    BatchSz, SecKeyDist,       MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod,   StdDev, EvalAddCt, KSCt, MultTech,         EncTech,   PREMode
     { EVALSUM,    "01", {BFVRNS_SCHEME, DFLT, DFLT,      60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         DFLT,   FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPS,              STANDARD,  DFLT}, },
     { EVALSUM,    "02", {BFVRNS_SCHEME, DFLT, DFLT,      60,       20,       BATCH,   GAUSSIAN,         DFLT,          DFLT,     DFLT,         DFLT,   FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, HPS,              STANDARD,  DFLT}, },
     { EVALSUM,    "03", {BFVRNS_SCHEME, DFLT, DFLT,      60,       20,       BATCH,   UNIFORM_TERNARY,  DFLT,          DFLT,     DFLT,         DFLT,   FIXEDMANUAL,     DFLT,    PTM_LRG, DFLT,   DFLT,      DFLT, BEHZ,             STANDARD,  DFLT}, },
@@ -635,6 +659,76 @@ protected:
         }
     }
 
+    void UnitTest_Mult_Packed_Precomp(const TEST_CASE_UTGENERAL_SHE& testData,
+                                      const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            std::vector<int64_t> vectorOfInts1 = {1, 0, 3, 1, 0, 1, 2, 1};
+            std::vector<int64_t> vectorOfInts2 = {2, 1, 3, 2, 2, 1, 3, 1};
+            std::vector<int64_t> vectorOfInts3 = {3, 2, 1, 0, 1, 2, 3, 4};
+
+            std::vector<int64_t> vectorOfIntsMult12  = {2, 0, 9, 2, 0, 1, 6, 1};
+            std::vector<int64_t> vectorOfIntsMult13  = {3, 0, 3, 0, 0, 2, 6, 4};
+            std::vector<int64_t> vectorOfIntsMult123 = {6, 0, 9, 0, 0, 2, 18, 4};
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultKeyGen(kp.secretKey);
+
+            Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(vectorOfInts1));
+            Ciphertext<Element> ciphertext2 = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(vectorOfInts2));
+            Ciphertext<Element> ciphertext3 = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(vectorOfInts3));
+
+            // the same prepared operand is reused across several products
+            auto precomp1 = cc->EvalMultPrecompute(ciphertext1);
+            auto precomp2 = cc->EvalMultPrecompute(ciphertext2);
+
+            Ciphertext<Element> cResult;
+            Plaintext results;
+
+            cResult = cc->EvalMult(ciphertext1, ciphertext2, precomp1, nullptr);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(vectorOfIntsMult12.size());
+            EXPECT_EQ(vectorOfIntsMult12, results->GetPackedValue()) << failmsg << " EvalMult with first precomp fails";
+
+            cResult = cc->EvalMult(ciphertext3, ciphertext1, nullptr, precomp1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(vectorOfIntsMult13.size());
+            EXPECT_EQ(vectorOfIntsMult13, results->GetPackedValue()) << failmsg << " EvalMult with second precomp fails";
+
+            cResult = cc->EvalMult(ciphertext1, ciphertext2, precomp1, precomp2);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(vectorOfIntsMult12.size());
+            EXPECT_EQ(vectorOfIntsMult12, results->GetPackedValue()) << failmsg << " EvalMult with both precomps fails";
+
+            // a deeper product: the prepared operand is at a different level than the other one
+            Ciphertext<Element> ciphertext23 = cc->EvalMult(ciphertext2, ciphertext3);
+            cResult                          = cc->EvalMult(ciphertext23, ciphertext1, nullptr, precomp1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(vectorOfIntsMult123.size());
+            EXPECT_EQ(vectorOfIntsMult123, results->GetPackedValue())
+                << failmsg << " EvalMult with precomp at a different depth fails";
+
+            auto precomp23 = cc->EvalMultPrecompute(ciphertext23);
+            cResult        = cc->EvalMult(ciphertext23, ciphertext1, precomp23, precomp1);
+            cc->Decrypt(kp.secretKey, cResult, &results);
+            results->SetLength(vectorOfIntsMult123.size());
+            EXPECT_EQ(vectorOfIntsMult123, results->GetPackedValue())
+                << failmsg << " EvalMult with precomps at different depths fails";
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+
     void UnitTest_EvalAtIndex(const TEST_CASE_UTGENERAL_SHE& testData, const std::string& failmsg = std::string()) {
         try {
             CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
@@ -750,6 +844,83 @@ protected:
         }
     }
 
+    void UnitTest_EvalMatMult(const TEST_CASE_UTGENERAL_SHE& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            const uint32_t d = 4;
+            const uint32_t n = d * d;
+
+            // 8 x 8 matrices split into a 2 x 2 grid of 4 x 4 blocks packed row-major
+            const uint32_t size = 2 * d;
+            std::vector<std::vector<int64_t>> A(size, std::vector<int64_t>(size));
+            std::vector<std::vector<int64_t>> B(size, std::vector<int64_t>(size));
+            for (uint32_t i = 0; i < size; i++) {
+                for (uint32_t j = 0; j < size; j++) {
+                    A[i][j] = (i + 2 * j) % 5;
+                    B[i][j] = static_cast<int64_t>((3 * i + j) % 7) - 3;
+                }
+            }
+            // BFV/BGV expect the packed blocks to be replicated across all slots
+            const uint32_t N = cc->GetRingDimension();
+            auto block       = [&](const std::vector<std::vector<int64_t>>& M, uint32_t bi, uint32_t bj) {
+                std::vector<int64_t> v(N);
+                for (uint32_t l = 0; l < N; l++)
+                    v[l] = M[bi * d + (l % n) / d][bj * d + l % d];
+                return v;
+            };
+            auto product = [&](uint32_t bi, uint32_t bj, uint32_t kmax) {
+                std::vector<int64_t> v(n);
+                for (uint32_t l = 0; l < n; l++) {
+                    for (uint32_t k = 0; k < kmax; k++)
+                        v[l] += A[bi * d + l / d][k] * B[k][bj * d + l % d];
+                }
+                return v;
+            };
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultKeyGen(kp.secretKey);
+            cc->EvalMatMultSetup(d);
+            cc->EvalMatMultKeyGen(kp.secretKey, d);
+
+            std::vector<std::vector<Ciphertext<Element>>> cA(2, std::vector<Ciphertext<Element>>(2));
+            std::vector<std::vector<Ciphertext<Element>>> cB(2, std::vector<Ciphertext<Element>>(2));
+            for (uint32_t i = 0; i < 2; i++) {
+                for (uint32_t j = 0; j < 2; j++) {
+                    cA[i][j] = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(block(A, i, j)));
+                    cB[i][j] = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(block(B, i, j)));
+                }
+            }
+
+            // the top-left blocks alone form a 4 x 4 product
+            Plaintext results;
+            cc->Decrypt(kp.secretKey, cc->EvalMatMult(cA[0][0], cB[0][0], d), &results);
+            results->SetLength(n);
+            EXPECT_EQ(product(0, 0, d), results->GetPackedValue()) << failmsg << " EvalMatMult fails";
+
+            auto cC = cc->EvalMatMultBlocks(cA, cB, d);
+            for (uint32_t i = 0; i < 2; i++) {
+                for (uint32_t j = 0; j < 2; j++) {
+                    cc->Decrypt(kp.secretKey, cC[i][j], &results);
+                    results->SetLength(n);
+                    EXPECT_EQ(product(i, j, size), results->GetPackedValue())
+                        << failmsg << " EvalMatMultBlocks fails for block " << i << "," << j;
+                }
+            }
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+
     void UnitTest_EvalSum(const TEST_CASE_UTGENERAL_SHE& testData, const std::string& failmsg = std::string()) {
         try {
             CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
@@ -1078,12 +1249,18 @@ TEST_P(UTGENERAL_SHE, SHE) {
         case MULT_PACKED:
             UnitTest_Mult_Packed(test, test.buildTestName());
             break;
+        case MULT_PACKED_PRECOMP:
+            UnitTest_Mult_Packed_Precomp(test, test.buildTestName());
+            break;
         case EVALATINDEX:
             UnitTest_EvalAtIndex(test, test.buildTestName());
             break;
         case EVALMERGE:
             UnitTest_EvalMerge(test, test.buildTestName());
             break;
+        case EVALMATMULT:
+            UnitTest_EvalMatMult(test, test.buildTestName());
+            break;
         case EVALSUM:
             UnitTest_EvalSum(test, test.buildTestName());
             break;
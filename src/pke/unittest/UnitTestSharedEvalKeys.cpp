@@ -0,0 +1,198 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+
+#include "scheme/bfvrns/cryptocontext-bfvrns.h"
+#include "gen-cryptocontext.h"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "cryptocontext.h"
+
+#include "encoding/encodings.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace lbcrypto;
+
+#if defined(__unix__) || defined(__APPLE__)
+static CryptoContext<DCRTPoly> MakeSharedKeysCC(uint32_t multDepth) {
+    CCParams<CryptoContextBFVRNS> parameters;
+    parameters.SetPlaintextModulus(65537);
+    parameters.SetMultiplicativeDepth(multDepth);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    cc->Enable(ADVANCEDSHE);
+    return cc;
+}
+
+    #ifdef __linux__
+// whether addr lies in a mapping of the shared-memory segment name
+static bool InSharedSegment(const void* addr, const std::string& name) {
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        if (line.find("/dev/shm" + name) == std::string::npos)
+            continue;
+        std::istringstream range(line);
+        uintptr_t begin = 0, end = 0;
+        char dash;
+        range >> std::hex >> begin >> dash >> end;
+        if (reinterpret_cast<uintptr_t>(addr) >= begin && reinterpret_cast<uintptr_t>(addr) < end)
+            return true;
+    }
+    return false;
+}
+    #endif
+
+TEST(UTSharedEvalKeys, PublishAndAttach) {
+    CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+
+    const std::string name = "/openfhe-ut-keys-" + std::to_string(getpid());
+    CryptoContext<DCRTPoly> cc = MakeSharedKeysCC(2);
+
+    KeyPair<DCRTPoly> kp = cc->KeyGen();
+    cc->EvalMultKeyGen(kp.secretKey);
+    cc->EvalSumKeyGen(kp.secretKey);
+    cc->EvalRotateKeyGen(kp.secretKey, {1, 2, -1});
+
+    auto multKeys = CryptoContextImpl<DCRTPoly>::GetAllEvalMultKeys();
+    auto sumKeys  = CryptoContextImpl<DCRTPoly>::GetAllEvalSumKeys();
+    auto autoKeys = CryptoContextImpl<DCRTPoly>::GetAllEvalAutomorphismKeys();
+
+    ASSERT_TRUE(CryptoContextImpl<DCRTPoly>::PublishEvalKeysToSharedMemory(name, cc));
+
+    // an existing segment is only replaced on request, and only the owner can read it by default
+    EXPECT_THROW(CryptoContextImpl<DCRTPoly>::PublishEvalKeysToSharedMemory(name, cc), config_error);
+    ASSERT_TRUE(CryptoContextImpl<DCRTPoly>::PublishEvalKeysToSharedMemory(name, cc, true));
+    {
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        ASSERT_GE(fd, 0);
+        struct stat st;
+        ASSERT_EQ(fstat(fd, &st), 0);
+        close(fd);
+        EXPECT_EQ(st.st_mode & 0777, 0600U) << "the segment is readable by other users";
+    }
+
+    CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+    EXPECT_FALSE(CryptoContextImpl<DCRTPoly>::PublishEvalKeysToSharedMemory(name + "-none", cc))
+        << "publishing a context without keys succeeds";
+
+    ASSERT_TRUE(CryptoContextImpl<DCRTPoly>::AttachEvalKeysFromSharedMemory(name, cc));
+
+    const auto& newMultKeys = CryptoContextImpl<DCRTPoly>::GetAllEvalMultKeys();
+    ASSERT_EQ(newMultKeys.size(), multKeys.size());
+    for (const auto& k : multKeys) {
+        ASSERT_EQ(newMultKeys.at(k.first).size(), k.second.size());
+        for (size_t i = 0; i < k.second.size(); i++)
+            EXPECT_TRUE(*newMultKeys.at(k.first)[i] == *k.second[i]) << "mult key mismatch";
+    }
+    for (const auto& keyMaps : {std::make_pair(sumKeys, CryptoContextImpl<DCRTPoly>::GetAllEvalSumKeys()),
+                                std::make_pair(autoKeys, CryptoContextImpl<DCRTPoly>::GetAllEvalAutomorphismKeys())}) {
+        ASSERT_EQ(keyMaps.second.size(), keyMaps.first.size());
+        for (const auto& k : keyMaps.first) {
+            const auto& newKeys = *keyMaps.second.at(k.first);
+            ASSERT_EQ(newKeys.size(), k.second->size());
+            for (const auto& key : *k.second)
+                EXPECT_TRUE(*newKeys.at(key.first) == *key.second) << "automorphism key mismatch";
+        }
+    }
+
+    std::vector<int64_t> vals = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto ciphertext           = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(vals));
+    Plaintext result;
+    cc->Decrypt(kp.secretKey, cc->EvalRotate(cc->EvalMult(ciphertext, ciphertext), 1), &result);
+    result->SetLength(vals.size() - 1);
+    std::vector<int64_t> expected;
+    for (size_t i = 1; i < vals.size(); i++)
+        expected.push_back(vals[i] * vals[i]);
+    EXPECT_EQ(result->GetPackedValue(), expected) << "EvalMult and EvalRotate with attached keys fail";
+
+    #ifdef __linux__
+    // the attached keys use the limbs in the segment instead of copies
+    const auto& limbs = newMultKeys.begin()->second[0]->GetBVector()[0].GetElementAtIndex(0).GetValues();
+    EXPECT_TRUE(InSharedSegment(&limbs[0], name)) << "the attached keys do not use the segment";
+    #endif
+
+    // a context with different moduli cannot use the keys
+    EXPECT_THROW(CryptoContextImpl<DCRTPoly>::AttachEvalKeysFromSharedMemory(name, MakeSharedKeysCC(4)), config_error);
+
+    // counts read from a corrupted segment are rejected before anything is allocated for them
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    struct stat st;
+    ASSERT_EQ(fstat(fd, &st), 0);
+    void* data = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(data, MAP_FAILED);
+    uint64_t* segment        = static_cast<uint64_t*>(data);
+    const uint64_t keysWord  = 6 + segment[3] * segment[5];
+    const uint64_t firstKey  = segment[keysWord + 1];
+    const uint64_t countWord = firstKey + 3 + (segment[firstKey + 2] + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    for (uint64_t word : {keysWord, countWord}) {
+        const uint64_t saved = segment[word];
+        segment[word]        = uint64_t(1) << 60;
+        EXPECT_THROW(CryptoContextImpl<DCRTPoly>::AttachEvalKeysFromSharedMemory(name, cc), deserialize_error);
+        segment[word] = saved;
+    }
+    munmap(data, st.st_size);
+    EXPECT_TRUE(CryptoContextImpl<DCRTPoly>::AttachEvalKeysFromSharedMemory(name, cc));
+
+    CryptoContextImpl<DCRTPoly>::RemoveEvalKeysFromSharedMemory(name);
+    EXPECT_THROW(CryptoContextImpl<DCRTPoly>::AttachEvalKeysFromSharedMemory(name, cc), config_error);
+
+    // the attached keys keep their mapping after the segment is removed
+    cc->Decrypt(kp.secretKey, cc->EvalRotate(cc->EvalMult(ciphertext, ciphertext), 1), &result);
+    result->SetLength(vals.size() - 1);
+    EXPECT_EQ(result->GetPackedValue(), expected) << "attached keys fail after the segment is removed";
+
+    CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+}
+#endif
@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <thread>
 #include <vector>
 #include "UnitTestUtils.h"
 #include "gtest/gtest.h"
@@ -198,3 +199,95 @@ TEST_F(UTBFVRNS_AUTOMORPHISM, Test_BFVrns_Automorphism_PowerOf2_INVALID_INDEX) {
         EXPECT_EQ(1, 1);
     }
 }
+
+TEST_F(UTBFVRNS_AUTOMORPHISM, Test_BFVrns_Rotation_ConcurrentKeyInstall) {
+    PackedEncoding::Destroy();
+
+    CCParams<CryptoContextBFVRNS> parameters;
+    parameters.SetPlaintextModulus(65537);
+    parameters.SetScalingModSize(60);
+    parameters.SetSecurityLevel(HEStd_NotSet);
+    parameters.SetRingDim(1024);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    KeyPair<DCRTPoly> kp  = cc->KeyGen();
+    KeyPair<DCRTPoly> kp2 = cc->KeyGen();
+    cc->EvalRotateKeyGen(kp.secretKey, {1});
+
+    Ciphertext<DCRTPoly> ciphertext = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(vector8));
+
+    // keys of another tag and additional keys of the same tag are installed and
+    // cleared while other threads rotate with the existing key
+    std::thread writer([&]() {
+        for (int32_t i = 2; i < 8; i++) {
+            cc->EvalRotateKeyGen(kp.secretKey, {i});
+            cc->EvalRotateKeyGen(kp2.secretKey, {1, i});
+            cc->EvalMultKeyGen(kp2.secretKey);
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys(kp2.secretKey->GetKeyTag());
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys(kp2.secretKey->GetKeyTag());
+        }
+    });
+
+    std::vector<std::vector<int64_t>> results(4);
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < results.size(); t++) {
+        readers.emplace_back([&, t]() {
+            for (int i = 0; i < 4; i++) {
+                Plaintext result;
+                cc->Decrypt(kp.secretKey, cc->EvalRotate(ciphertext, 1), &result);
+                result->SetLength(vector8.size() - 1);
+                results[t] = result->GetPackedValue();
+            }
+        });
+    }
+
+    writer.join();
+    for (auto& reader : readers)
+        reader.join();
+
+    for (const auto& result : results)
+        EXPECT_EQ(result, std::vector<int64_t>(vector8.begin() + 1, vector8.end()));
+    EXPECT_EQ(cc->GetEvalAutomorphismKeyMapPtr(kp.secretKey->GetKeyTag())->size(), 7U);
+
+    CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+    CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+}
+
+TEST_F(UTBFVRNS_AUTOMORPHISM, Test_BFVrns_Rotation_NumaReplicatedKeys) {
+    PackedEncoding::Destroy();
+
+    CCParams<CryptoContextBFVRNS> parameters;
+    parameters.SetPlaintextModulus(65537);
+    parameters.SetScalingModSize(60);
+    parameters.SetSecurityLevel(HEStd_NotSet);
+    parameters.SetRingDim(1024);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    KeyPair<DCRTPoly> kp = cc->KeyGen();
+    cc->EvalRotateKeyGen(kp.secretKey, {1});
+    CryptoContextImpl<DCRTPoly>::ReplicateEvalAutomorphismKeysPerNumaNode(kp.secretKey->GetKeyTag());
+    EXPECT_THROW(CryptoContextImpl<DCRTPoly>::ReplicateEvalAutomorphismKeysPerNumaNode("none"), not_available_error);
+
+    Ciphertext<DCRTPoly> ciphertext = cc->Encrypt(kp.publicKey, cc->MakePackedPlaintext(vector8));
+    Plaintext result;
+    cc->Decrypt(kp.secretKey, cc->EvalRotate(ciphertext, 1), &result);
+    result->SetLength(vector8.size() - 1);
+    EXPECT_EQ(result->GetPackedValue(), std::vector<int64_t>(vector8.begin() + 1, vector8.end()));
+
+    // keys added after the replication are used instead of the stale copies
+    cc->EvalRotateKeyGen(kp.secretKey, {2});
+    cc->Decrypt(kp.secretKey, cc->EvalRotate(ciphertext, 2), &result);
+    result->SetLength(vector8.size() - 2);
+    EXPECT_EQ(result->GetPackedValue(), std::vector<int64_t>(vector8.begin() + 2, vector8.end()));
+
+    CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeyReplicas();
+    CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+}
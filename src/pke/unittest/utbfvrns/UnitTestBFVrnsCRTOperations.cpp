@@ -292,6 +292,47 @@ TEST_F(UTBFVRNS_CRT, BFVrns_SwitchCRTBasis) {
     EXPECT_EQ(A0, B0) << "SwitchCRTBasis produced incorrect results";
 }
 
+TEST_F(UTBFVRNS_CRT, BFVrns_ScaleAndRoundSwitchCRTBasis) {
+    CCParams<CryptoContextBFVRNS> parameters;
+    usint ptm = 1 << 15;
+    parameters.SetPlaintextModulus(ptm);
+    parameters.SetMultiplicativeDepth(3);
+    parameters.SetScalingModSize(60);
+    parameters.SetMultiplicationTechnique(HPS);
+
+    CryptoContext<DCRTPoly> cryptoContext = GenCryptoContext(parameters);
+
+    const std::shared_ptr<ILDCRTParams<BigInteger>> paramsQ = cryptoContext->GetCryptoParameters()->GetElementParams();
+
+    const auto cryptoParamsBFVrns =
+        std::dynamic_pointer_cast<CryptoParametersBFVRNS>(cryptoContext->GetCryptoParameters());
+
+    const std::shared_ptr<ILDCRTParams<BigInteger>> paramsR = cryptoParamsBFVrns->GetParamsRl();
+
+    const std::shared_ptr<ILDCRTParams<BigInteger>> paramsQR = cryptoParamsBFVrns->GetParamsQlRl();
+
+    typename DCRTPoly::DugType dug;
+
+    const DCRTPoly c(dug, paramsQR, Format::COEFFICIENT);
+
+    DCRTPoly expected =
+        c.ScaleAndRound(paramsR, cryptoParamsBFVrns->GettRSHatInvModsDivsModr(),
+                        cryptoParamsBFVrns->GettRSHatInvModsDivsFrac(), cryptoParamsBFVrns->GetModrBarrettMu());
+    expected = expected.SwitchCRTBasis(paramsQ, cryptoParamsBFVrns->GetRlHatInvModr(),
+                                       cryptoParamsBFVrns->GetRlHatInvModrPrecon(), cryptoParamsBFVrns->GetRlHatModq(),
+                                       cryptoParamsBFVrns->GetalphaRlModq(), cryptoParamsBFVrns->GetModqBarrettMu(),
+                                       cryptoParamsBFVrns->GetrInv());
+
+    DCRTPoly fused = c.ScaleAndRoundSwitchCRTBasis(
+        paramsR, paramsQ, cryptoParamsBFVrns->GettRSHatInvModsDivsModr(),
+        cryptoParamsBFVrns->GettRSHatInvModsDivsFrac(), cryptoParamsBFVrns->GetModrBarrettMu(),
+        cryptoParamsBFVrns->GetRlHatInvModr(), cryptoParamsBFVrns->GetRlHatInvModrPrecon(),
+        cryptoParamsBFVrns->GetRlHatModq(), cryptoParamsBFVrns->GetalphaRlModq(), cryptoParamsBFVrns->GetModqBarrettMu(),
+        cryptoParamsBFVrns->GetrInv());
+
+    EXPECT_EQ(expected, fused) << "ScaleAndRoundSwitchCRTBasis does not match ScaleAndRound followed by SwitchCRTBasis";
+}
+
 // TESTING POLYNOMIAL MULTIPLICATION - ONE TERM IS CONSTANT POLYNOMIAL
 TEST_F(UTBFVRNS_CRT, BFVrns_Mult_by_Constant) {
     CCParams<CryptoContextBFVRNS> parameters;
@@ -550,3 +591,86 @@ TEST_F(UTBFVRNS_CRT, BFVrns_Mult_by_Gaussian) {
     // EXPECT_TRUE((result >= 1) && (result <= 3)) <<  "Results of multiprecision
     // and CRT multiplication after scaling + rounding do not match";
 }
+
+// Checks EXTENDED encryption of plaintexts over Q: small coefficients (x or
+// Q - x), for which only the r tower of Qr is computed, coefficients that
+// look small in the first two towers only, and uniformly random coefficients,
+// for which encryption falls back to CRT interpolation
+TEST_F(UTBFVRNS_CRT, BFVrns_EncryptExtended) {
+    CCParams<CryptoContextBFVRNS> parameters;
+    usint ptm = 65537;
+    parameters.SetPlaintextModulus(ptm);
+    parameters.SetMultiplicativeDepth(4);
+    parameters.SetScalingModSize(60);
+    parameters.SetEncryptionTechnique(EXTENDED);
+
+    CryptoContext<DCRTPoly> cryptoContext = GenCryptoContext(parameters);
+    cryptoContext->Enable(PKE);
+
+    const auto cryptoParams =
+        std::dynamic_pointer_cast<CryptoParametersBFVRNS>(cryptoContext->GetCryptoParameters());
+    const auto paramsQ  = cryptoParams->GetElementParams();
+    const auto paramsQr = cryptoParams->GetParamsQr();
+    ASSERT_GE(paramsQ->GetParams().size(), 3U) << "x + k * q0 * q1 is only distinguishable from x with three towers";
+
+    const BigInteger Q  = paramsQ->GetModulus();
+    const BigInteger Qr = paramsQr->GetModulus();
+    const BigInteger t(ptm);
+    const usint n = paramsQ->GetRingDimension();
+    const BigInteger q0(paramsQ->GetParams()[0]->GetModulus());
+    const BigInteger q1(paramsQ->GetParams()[1]->GetModulus());
+    auto paramsLarge = std::make_shared<ILParams>(paramsQ->GetCyclotomicOrder(), Q, BigInteger(1));
+
+    KeyPair<DCRTPoly> kp = cryptoContext->KeyGen();
+
+    // encrypts the coefficients with both keys and compares the decryptions with those of the
+    // plaintext lifted to Qr by CRT interpolation
+    auto check = [&](const BigVector& values, const std::string& failmsg) {
+        Poly poly(paramsLarge, Format::COEFFICIENT);
+        poly.SetValues(values, Format::COEFFICIENT);
+        DCRTPoly ptxt(poly, paramsQ);
+
+        // Encrypt scales the plaintext over Qr by Qr / t tower by tower, and decryption rounds
+        // t / Qr times the scaled value; for coefficients that are not small this value is not
+        // close to an integer, so the decryption may be off by one
+        DCRTPoly scaled(poly, paramsQr);
+        scaled.TimesQovert(paramsQr, cryptoParams->GettInvModqr(), ptm, cryptoParams->GetNegQrModt(),
+                           cryptoParams->GetNegQrModtPrecon());
+        Poly encoded = scaled.CRTInterpolate();
+        std::vector<uint64_t> expected(n);
+        for (usint j = 0; j < n; j++)
+            expected[j] = ((encoded[j] * t * BigInteger(2) + Qr) / (Qr * BigInteger(2))).Mod(t).ConvertToInt();
+
+        for (auto ciphertext : {cryptoContext->GetScheme()->Encrypt(ptxt, kp.publicKey),
+                                cryptoContext->GetScheme()->Encrypt(ptxt, kp.secretKey)}) {
+            ASSERT_EQ(ciphertext->GetElements()[0].GetNumOfElements(), paramsQ->GetParams().size())
+                << failmsg << ": ciphertext is in the wrong basis";
+
+            NativePoly result;
+            cryptoContext->GetScheme()->Decrypt(ciphertext, kp.secretKey, &result);
+            for (usint j = 0; j < n; j++) {
+                uint64_t diff = (result[j].ConvertToInt() + ptm - expected[j]) % ptm;
+                EXPECT_TRUE(diff <= 1 || diff == ptm - 1) << failmsg << ": coefficient " << j << " is wrong";
+            }
+        }
+    };
+
+    // small coefficients x and Q - x, including the largest x the first tower identifies
+    BigVector values(n, Q);
+    for (usint j = 0; j < n; j++) {
+        BigInteger x(uint64_t(j) * 97 % ptm);
+        values[j] = (j % 2) ? Q.ModSub(x, Q) : x;
+    }
+    values[0] = q0 - BigInteger(1);
+    values[1] = Q - values[0];
+    check(values, "small plaintext");
+
+    // x + k * q0 * q1 agrees with x in the first two towers but not in the others
+    values[n / 2]     = BigInteger(5) + BigInteger(3) * q0 * q1;
+    values[n / 2 + 1] = Q - values[n / 2];
+    check(values, "plaintext small in two towers");
+
+    typename Poly::DugType dug;
+    dug.SetModulus(Q);
+    check(dug.GenerateVector(n), "random plaintext");
+}
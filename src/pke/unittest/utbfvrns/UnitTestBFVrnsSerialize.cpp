@@ -69,3 +69,93 @@ TEST_F(UTBFVRNS_SER, BFVRNS_SERIAL) {
 
     UnitTestContext<DCRTPoly>(cc);
 }
+
+TEST_F(UTBFVRNS_SER, BFVRNS_CONTEXT_SNAPSHOT) {
+    CCParams<CryptoContextBFVRNS> parameters;
+    parameters.SetPlaintextModulus(65537);
+    parameters.SetMultiplicativeDepth(2);
+    parameters.SetSecurityLevel(HEStd_NotSet);
+    parameters.SetRingDim(1024);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    // the tables PrecomputeCRTTables() and the NTT computed for the original context
+    using FTT         = ChineseRemainderTransformFTT<NativeVector>;
+    const auto params = std::dynamic_pointer_cast<CryptoParametersRNS>(cc->GetCryptoParameters());
+    const auto elementParams = params->GetElementParams();
+    std::vector<NativeVector> nttTables;
+    for (const auto& p : elementParams->GetParams())
+        nttTables.push_back(FTT::m_rootOfUnityReverseTableByModulus.at(p->GetModulus()));
+    DCRTPoly::DugType dug;
+    DCRTPoly poly(dug, elementParams, Format::COEFFICIENT);
+    DCRTPoly polyNTT = poly;
+    polyNTT.SwitchFormat();
+
+    std::stringstream snapshot;
+    Serial::SerializeContextSnapshot(cc, snapshot);
+
+    // drop the contexts and all transform caches so that everything has to come from the snapshot
+    CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+    FTT().Reset();
+    ChineseRemainderTransformArb<NativeVector>().Reset();
+    ASSERT_TRUE(FTT::m_rootOfUnityReverseTableByModulus.empty()) << "NTT tables were not cleared";
+
+    CryptoContext<DCRTPoly> newcc;
+    Serial::DeserializeContextSnapshot(newcc, snapshot);
+    ASSERT_TRUE(newcc) << "Context snapshot deserialization failed";
+    EXPECT_TRUE(PrecomputeCRTTablesAfterDeserializaton()) << "the global CRT flag was changed";
+    const auto newParams = std::dynamic_pointer_cast<CryptoParametersRNS>(newcc->GetCryptoParameters());
+    ASSERT_NE(params, newParams) << "the snapshot did not create new crypto parameters";
+    EXPECT_EQ(*params, *newParams) << "Crypto parameter mismatch";
+
+    EXPECT_EQ(params->GettInvModq(), newParams->GettInvModq()) << "CRT tables mismatch";
+    EXPECT_EQ(params->GettQHatInvModqDivqModt(), newParams->GettQHatInvModqDivqModt()) << "CRT tables mismatch";
+    EXPECT_EQ(params->GetModqBarrettMu(), newParams->GetModqBarrettMu()) << "CRT tables mismatch";
+    EXPECT_EQ(params->GetPInvModq(), newParams->GetPInvModq()) << "CRT tables mismatch";
+    std::stringstream tables;
+    std::stringstream newTables;
+    {
+        cereal::PortableBinaryOutputArchive archive(tables);
+        params->SavePrecomputations(archive);
+        cereal::PortableBinaryOutputArchive newArchive(newTables);
+        newParams->SavePrecomputations(newArchive);
+    }
+    EXPECT_EQ(tables.str(), newTables.str()) << "CRT tables mismatch";
+
+    // the restored NTT tables are used as is and match the ones computed for the original context
+    const auto& newElementParams = newParams->GetElementParams()->GetParams();
+    ASSERT_EQ(newElementParams.size(), nttTables.size()) << "tower count mismatch";
+    for (size_t i = 0; i < nttTables.size(); i++) {
+        auto it = FTT::m_rootOfUnityReverseTableByModulus.find(newElementParams[i]->GetModulus());
+        ASSERT_TRUE(it != FTT::m_rootOfUnityReverseTableByModulus.end()) << "NTT table " << i << " not restored";
+        EXPECT_EQ(it->second, nttTables[i]) << "NTT table " << i << " mismatch";
+    }
+    DCRTPoly restored(newParams->GetElementParams(), Format::COEFFICIENT);
+    for (size_t i = 0; i < nttTables.size(); i++)
+        restored.SetElementAtIndex(i, poly.GetElementAtIndex(i));
+    restored.SwitchFormat();
+    for (size_t i = 0; i < nttTables.size(); i++)
+        EXPECT_EQ(restored.GetElementAtIndex(i).GetValues(), polyNTT.GetElementAtIndex(i).GetValues())
+            << "NTT with the restored tables fails";
+    restored.SwitchFormat();
+    for (size_t i = 0; i < nttTables.size(); i++)
+        EXPECT_EQ(restored.GetElementAtIndex(i).GetValues(), poly.GetElementAtIndex(i).GetValues())
+            << "inverse NTT with the restored tables fails";
+
+    KeyPair<DCRTPoly> kp = newcc->KeyGen();
+    newcc->EvalMultKeyGen(kp.secretKey);
+
+    std::vector<int64_t> a = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<int64_t> b = {3, 1, 4, 1, 5, 9, 2, 6};
+    auto ct1               = newcc->Encrypt(kp.publicKey, newcc->MakePackedPlaintext(a));
+    auto ct2               = newcc->Encrypt(kp.publicKey, newcc->MakePackedPlaintext(b));
+
+    Plaintext result;
+    newcc->Decrypt(kp.secretKey, newcc->EvalMult(ct1, ct2), &result);
+    result->SetLength(a.size());
+    for (size_t i = 0; i < a.size(); i++)
+        EXPECT_EQ(result->GetPackedValue()[i], a[i] * b[i]) << "EvalMult with a restored context fails";
+}
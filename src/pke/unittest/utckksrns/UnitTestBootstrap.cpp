@@ -39,6 +39,8 @@
 #include "utils/demangle.h"
 #include "scheme/ckksrns/ckksrns-utils.h"
 
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <vector>
 #include "gtest/gtest.h"
@@ -53,6 +55,8 @@ enum TEST_CASE_TYPE {
     BOOTSTRAP_EDGE,
     BOOTSTRAP_SPARSE,
     BOOTSTRAP_KEY_SWITCH,
+    BOOTSTRAP_PACKED,
+    BOOTSTRAP_CACHED,
 };
 
 static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
@@ -70,6 +74,12 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case BOOTSTRAP_KEY_SWITCH:
             typeName = "BOOTSTRAP_KEY_SWITCH";
             break;
+        case BOOTSTRAP_PACKED:
+            typeName = "BOOTSTRAP_PACKED";
+            break;
+        case BOOTSTRAP_CACHED:
+            typeName = "BOOTSTRAP_CACHED";
+            break;
         default:
             typeName = "UNKNOWN";
             break;
@@ -232,6 +242,23 @@ static std::vector<TEST_CASE_UTCKKSRNS_BOOT> testCases = {
     { BOOTSTRAP_KEY_SWITCH, "06", {CKKSRNS_SCHEME,  2048, MULT_DEPTH, SMODSIZE,     DFLT,  8,       UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 2 },  { 0, 0 } },
     { BOOTSTRAP_KEY_SWITCH, "07", {CKKSRNS_SCHEME,  2048, MULT_DEPTH, SMODSIZE,     DFLT,  8,       UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 2 },  { 0, 0 } },
     { BOOTSTRAP_KEY_SWITCH, "08", {CKKSRNS_SCHEME,  2048, MULT_DEPTH, SMODSIZE,     DFLT,  8,       UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 2 },  { 0, 0 } },
+#endif
+    // ==========================================
+    // TestType,        Descr, Scheme,          RDim, MultDepth,  SModSize,     DSize, BatchSz, SecKeyDist,      MaxRelinSkDeg, FModSize,  SecLvl,       KSTech, ScalTech,        LDigits,      PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, LvlBudget, Dim1,     Slots
+    { BOOTSTRAP_PACKED, "01", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FIXEDAUTO,       NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_PACKED, "02", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    SPARSE_TERNARY,  DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FIXEDMANUAL,     NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_PACKED, "03", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FIXEDAUTO,       NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 1, 1 },  { 0, 0 }, 8 },
+    { BOOTSTRAP_PACKED, "04", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    SPARSE_TERNARY,  DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FIXEDMANUAL,     NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 1, 1 },  { 0, 0 }, 8 },
+#if NATIVEINT != 128
+    { BOOTSTRAP_PACKED, "05", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_PACKED, "06", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    SPARSE_TERNARY,  DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 1, 1 },  { 0, 0 }, 8 },
+#endif
+    // ==========================================
+    // TestType,        Descr, Scheme,          RDim, MultDepth,  SModSize,     DSize, BatchSz, SecKeyDist,      MaxRelinSkDeg, FModSize,  SecLvl,       KSTech, ScalTech,        LDigits,      PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode, LvlBudget, Dim1,     Slots
+    { BOOTSTRAP_CACHED, "01", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FIXEDAUTO,       NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 3 },  { 0, 0 }, RDIM/2 },
+    { BOOTSTRAP_CACHED, "02", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    SPARSE_TERNARY,  DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FIXEDMANUAL,     NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 1, 1 },  { 0, 0 }, 8 },
+#if NATIVEINT != 128
+    { BOOTSTRAP_CACHED, "03", {CKKSRNS_SCHEME,  RDIM, MULT_DEPTH, SMODSIZE,     DFLT,  DFLT,    UNIFORM_TERNARY, DFLT,          FMODSIZE,  HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    NUM_LRG_DIGS, DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT},   { 3, 3 },  { 0, 0 }, 8 },
 #endif
     // ==========================================
 };
@@ -258,10 +285,31 @@ protected:
             cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots);
 
             auto keyPair = cc->KeyGen();
+            // a level-reduced rotation key generated first must be replaced by
+            // the full-level key bootstrapping needs for the same index
+            auto bootKeys             = cc->GetScheme()->EvalBootstrapKeyGen(keyPair.secretKey, testData.slots);
+            int32_t rotation          = 1;
+            const int32_t maxRotation = cc->GetRingDimension() / 2;
+            while (rotation < maxRotation && !bootKeys->count(cc->FindAutomorphismIndex(rotation)))
+                rotation++;
+            ASSERT_LT(rotation, maxRotation) << failmsg << " bootstrapping needs no rotation keys";
+            const usint autoIndex = cc->FindAutomorphismIndex(rotation);
+            cc->EvalAtIndexKeyGen(keyPair.secretKey, {rotation}, {MULT_DEPTH - 2});
+            auto towers = [&](usint index) {
+                auto keyMap = cc->GetEvalAutomorphismKeyMapPtr(keyPair.secretKey->GetKeyTag());
+                return keyMap->at(index)->GetBVector()[0].GetNumOfElements();
+            };
+            const size_t reducedTowers = towers(autoIndex);
+
             cc->EvalBootstrapKeyGen(keyPair.secretKey, testData.slots);
             cc->EvalAtIndexKeyGen(keyPair.secretKey, {6});
             cc->EvalMultKeyGen(keyPair.secretKey);
 
+            // the conjugation key is only generated by EvalBootstrapKeyGen, at full level
+            const size_t fullTowers = towers(2 * cc->GetRingDimension() - 1);
+            EXPECT_LT(reducedTowers, fullTowers) << failmsg << " the rotation key was not reduced";
+            EXPECT_EQ(towers(autoIndex), fullTowers) << failmsg << " the reduced rotation key was kept";
+
             std::vector<std::complex<double>> input(
                 Fill({0.111111, 0.222222, 0.333333, 0.444444, 0.555555, 0.666666, 0.777777, 0.888888}, testData.slots));
             size_t encodedLength = input.size();
@@ -300,6 +348,171 @@ protected:
         }
     }
 
+    void UnitTest_Bootstrap_Packed(const TEST_CASE_UTCKKSRNS_BOOT& testData,
+                                   const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots);
+
+            auto keyPair = cc->KeyGen();
+            cc->EvalBootstrapKeyGen(keyPair.secretKey, testData.slots);
+            cc->EvalMultKeyGen(keyPair.secretKey);
+
+            // an odd number of ciphertexts so that the last one is bootstrapped on its own
+            std::vector<std::vector<std::complex<double>>> inputs = {
+                Fill({0.111111, 0.222222, 0.333333, 0.444444, 0.555555, 0.666666, 0.777777, 0.888888}, testData.slots),
+                Fill({-0.5, 0.25, -0.125, 0.0625, 0.9, -0.9, 0.3, -0.3}, testData.slots),
+                Fill({0.7, 0.6, 0.5, 0.4, 0.3, 0.2, 0.1, 0.0}, testData.slots)};
+
+            std::vector<Ciphertext<Element>> ciphertexts;
+            for (const auto& input : inputs) {
+                Plaintext plaintext = cc->MakeCKKSPackedPlaintext(input, 1, MULT_DEPTH - 1, nullptr, testData.slots);
+                ciphertexts.push_back(cc->Encrypt(keyPair.publicKey, plaintext));
+            }
+
+            auto ciphertextsAfter = cc->EvalBootstrap(ciphertexts);
+            EXPECT_EQ(ciphertextsAfter.size(), inputs.size()) << failmsg;
+
+            for (size_t i = 0; i < inputs.size(); i++) {
+                Plaintext result;
+                cc->Decrypt(keyPair.secretKey, ciphertextsAfter[i], &result);
+                result->SetLength(inputs[i].size());
+                checkEquality(result->GetCKKSPackedValue(), inputs[i], eps,
+                              failmsg + " Packed bootstrapping fails for ciphertext " + std::to_string(i));
+            }
+
+            // invalid batches must throw rather than terminate the program from inside the parallel region
+            EXPECT_THROW(cc->EvalBootstrap(std::vector<Ciphertext<Element>>()), config_error) << failmsg;
+
+            // the pairs must be encrypted under the same key
+            auto keyPairOther = cc->KeyGen();
+            Plaintext plaintext =
+                cc->MakeCKKSPackedPlaintext(inputs[0], 1, MULT_DEPTH - 1, nullptr, testData.slots);
+            std::vector<Ciphertext<Element>> mixed = {ciphertexts[0], ciphertexts[1], ciphertexts[2],
+                                                      cc->Encrypt(keyPairOther.publicKey, plaintext)};
+            EXPECT_THROW(cc->EvalBootstrap(mixed), config_error) << failmsg;
+
+            // a packed pair cannot be split without the conjugation key
+            cc->GetEvalAutomorphismKeyMap(keyPair.secretKey->GetKeyTag()).erase(2 * cc->GetRingDimension() - 1);
+            EXPECT_THROW(cc->EvalBootstrap(ciphertexts), config_error) << failmsg;
+
+            // halving the packed result needs a first modulus larger than the scaling factor
+            // (the FLEXIBLEAUTO modes cannot be set up with equal moduli sizes)
+            if (testData.params.scalTech == FIXEDMANUAL || testData.params.scalTech == FIXEDAUTO) {
+                UnitTestCCParams paramsNoSpareBit(testData.params);
+                paramsNoSpareBit.firstModSize = paramsNoSpareBit.scalingModSize;
+                CryptoContext<Element> ccNoSpareBit(UnitTestGenerateContext(paramsNoSpareBit));
+                ccNoSpareBit->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots);
+                auto keyPairNoSpareBit = ccNoSpareBit->KeyGen();
+                ccNoSpareBit->EvalBootstrapKeyGen(keyPairNoSpareBit.secretKey, testData.slots);
+                Plaintext plaintextNoSpareBit =
+                    ccNoSpareBit->MakeCKKSPackedPlaintext(inputs[0], 1, MULT_DEPTH - 1, nullptr, testData.slots);
+                auto ciphertextNoSpareBit = ccNoSpareBit->Encrypt(keyPairNoSpareBit.publicKey, plaintextNoSpareBit);
+                EXPECT_THROW(ccNoSpareBit->EvalBootstrap(std::vector<Ciphertext<Element>>(2, ciphertextNoSpareBit)),
+                             config_error)
+                    << failmsg;
+            }
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+
+    void UnitTest_Bootstrap_Cached(const TEST_CASE_UTCKKSRNS_BOOT& testData,
+                                   const std::string& failmsg = std::string()) {
+        std::filesystem::path cacheDir =
+            std::filesystem::temp_directory_path() / ("openfhe-boot-cache-" + testData.description);
+        try {
+            std::filesystem::remove_all(cacheDir);
+            std::filesystem::create_directories(cacheDir);
+
+            auto cacheEntries = [&cacheDir]() {
+                std::vector<std::filesystem::path> entries;
+                for (const auto& entry : std::filesystem::directory_iterator(cacheDir))
+                    entries.push_back(entry.path());
+                return entries;
+            };
+
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            // the first call computes the precomputations and stores them
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, cacheDir.string());
+            auto entries = cacheEntries();
+            ASSERT_EQ(entries.size(), 1u) << failmsg << " Precomputations were not cached";
+            const auto entry     = entries[0];
+            const auto writeTime = std::filesystem::last_write_time(entry);
+
+            // the second call loads them: nothing is reported and the entry is not rewritten
+            testing::internal::CaptureStderr();
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, cacheDir.string());
+            EXPECT_EQ(testing::internal::GetCapturedStderr(), "") << failmsg << " Cached precomputations were not loaded";
+            EXPECT_EQ(cacheEntries().size(), 1u) << failmsg;
+            EXPECT_TRUE(std::filesystem::last_write_time(entry) == writeTime)
+                << failmsg << " Cached precomputations were recomputed";
+
+            // other moduli give another entry even with the same level budget, dim1 and slots
+            UnitTestCCParams paramsOther(testData.params);
+            paramsOther.scalingModSize -= 1;
+            CryptoContext<Element> ccOther(UnitTestGenerateContext(paramsOther));
+            ccOther->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, cacheDir.string());
+            EXPECT_EQ(cacheEntries().size(), 2u) << failmsg << " Different parameters share a cache entry";
+
+            // a damaged entry is reported and recomputed
+            {
+                std::ofstream damaged(entry, std::ios::out | std::ios::binary | std::ios::trunc);
+                damaged << "not a cache entry";
+            }
+            testing::internal::CaptureStderr();
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, cacheDir.string());
+            EXPECT_NE(testing::internal::GetCapturedStderr().find("Warning"), std::string::npos)
+                << failmsg << " A damaged cache entry was not reported";
+
+            // the recomputed entry is loaded again and used below
+            testing::internal::CaptureStderr();
+            cc->EvalBootstrapSetup(testData.levelBudget, testData.dim1, testData.slots, cacheDir.string());
+            EXPECT_EQ(testing::internal::GetCapturedStderr(), "") << failmsg << " Cached precomputations were not loaded";
+
+            auto keyPair = cc->KeyGen();
+            cc->EvalBootstrapKeyGen(keyPair.secretKey, testData.slots);
+            cc->EvalMultKeyGen(keyPair.secretKey);
+
+            std::vector<std::complex<double>> input(
+                Fill({0.111111, 0.222222, 0.333333, 0.444444, 0.555555, 0.666666, 0.777777, 0.888888}, testData.slots));
+            Plaintext plaintext = cc->MakeCKKSPackedPlaintext(input, 1, MULT_DEPTH - 1, nullptr, testData.slots);
+            auto ciphertext     = cc->Encrypt(keyPair.publicKey, plaintext);
+
+            auto ciphertextAfter = cc->EvalBootstrap(ciphertext);
+
+            Plaintext result;
+            cc->Decrypt(keyPair.secretKey, ciphertextAfter, &result);
+            result->SetLength(input.size());
+            checkEquality(result->GetCKKSPackedValue(), input, eps,
+                          failmsg + " Bootstrapping with cached precomputations fails");
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        std::error_code ec;
+        std::filesystem::remove_all(cacheDir, ec);
+    }
+
     void UnitTest_Bootstrap_KeySwitching(const TEST_CASE_UTCKKSRNS_BOOT& testData,
                                          const std::string& failmsg = std::string()) {
         try {
@@ -404,6 +617,12 @@ TEST_P(UTCKKSRNS_BOOT, CKKSRNS) {
         case BOOTSTRAP_KEY_SWITCH:
             UnitTest_Bootstrap_KeySwitching(test, test.buildTestName());
             break;
+        case BOOTSTRAP_PACKED:
+            UnitTest_Bootstrap_Packed(test, test.buildTestName());
+            break;
+        case BOOTSTRAP_CACHED:
+            UnitTest_Bootstrap_Cached(test, test.buildTestName());
+            break;
         default:
             break;
     }
@@ -57,6 +57,8 @@ enum TEST_CASE_TYPE {
     EVAL_FAST_ROTATION,
     EVALATINDEX,
     EVALMERGE,
+    EVAL_MAT_MULT,
+    EVALATINDEX_LEVELED,
     EVAL_LINEAR_WSUM,
     RE_ENCRYPTION,
     EVAL_POLY,
@@ -92,6 +94,12 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case EVALMERGE:
             typeName = "EVALMERGE";
             break;
+        case EVAL_MAT_MULT:
+            typeName = "EVAL_MAT_MULT";
+            break;
+        case EVALATINDEX_LEVELED:
+            typeName = "EVALATINDEX_LEVELED";
+            break;
         case EVAL_LINEAR_WSUM:
             typeName = "EVAL_LINEAR_WSUM";
             break;
@@ -454,6 +462,20 @@ static std::vector<TEST_CASE_UTCKKSRNS> testCases = {
     { EVALMERGE, "07", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
     { EVALMERGE, "08", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
 #endif
+    // ==========================================
+    // TestType,    Descr, Scheme,         RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode
+    { EVAL_MAT_MULT, "01", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, 16,      DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+    { EVAL_MAT_MULT, "02", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, 16,      DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+    { EVAL_MAT_MULT, "03", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, 16,      DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+#if NATIVEINT != 128
+    { EVAL_MAT_MULT, "04", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, 16,      DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+#endif
+    // ==========================================
+    // TestType,          Descr, Scheme,         RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode
+    { EVALATINDEX_LEVELED, "01", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+    { EVALATINDEX_LEVELED, "02", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+    { EVALATINDEX_LEVELED, "03", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDMANUAL,     3,       DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
+    { EVALATINDEX_LEVELED, "04", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
     // ==========================================
     // TestType,       Descr, Scheme,          RDim, MultDepth, SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech, EncTech, PREMode
     { EVAL_LINEAR_WSUM, "01", {CKKSRNS_SCHEME, RING_DIM, 7,     SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,     DFLT,    DFLT}, },
@@ -832,6 +854,13 @@ protected:
             approximationErrors.emplace_back(
                 CalculateApproximationError<T>(plaintextMult->GetCKKSPackedValue(), results->GetCKKSPackedValue()));
 
+            // multi-tower results are decoded from RNS form, but the full Poly is still available
+            if (cResult->GetElements()[0].GetNumOfElements() > 1) {
+                Poly decrypted;
+                cc->GetScheme()->Decrypt(cResult, kp.secretKey, &decrypted);
+                EXPECT_EQ(decrypted, results->GetElement<Poly>()) << failmsg << " GetElement<Poly>() fails";
+            }
+
             // Testing operator*
             cResult = ciphertext1 * ciphertext2;
             cc->Decrypt(kp.secretKey, cResult, &results);
@@ -1547,6 +1576,71 @@ protected:
         }
     }
 
+    void UnitTest_EvalAtIndexLeveled(const TEST_CASE_UTCKKSRNS& testData,
+                                     const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            const uint32_t level = 4;
+            uint32_t slots       = (BATCH != 0) ? BATCH : cc->GetRingDimension() / 2;
+
+            // vIntsLeftShift2 = { 3,4,5,6,7,8,0,0 } if slots > 8;
+            // vIntsLeftShift2 = { 3,4,5,6,7,8,1,2 } if slots = 8;
+            std::vector<std::complex<double>> vIntsLeftShift2(VECTOR_SIZE);
+            for (usint i = 0; i < VECTOR_SIZE; i++) {
+                if ((i + 2) % slots < VECTOR_SIZE) {
+                    vIntsLeftShift2[i] = vectorOfInts1_8[(i + 2) % slots];
+                }
+                else {
+                    vIntsLeftShift2[i] = 0;
+                }
+            }
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultKeyGen(kp.secretKey);
+            // the key for +2 only keeps the limbs needed at "level", the key for -2 is a full key
+            cc->EvalRotateKeyGen(kp.secretKey, {2, -2}, {level, 0});
+
+            const auto& keyMap       = cc->GetEvalAutomorphismKeyMap(kp.secretKey->GetKeyTag());
+            const auto& truncatedKey = keyMap.at(cc->FindAutomorphismIndex(2));
+            const auto& fullKey      = keyMap.at(cc->FindAutomorphismIndex(-2));
+            EXPECT_EQ(fullKey->GetBVector()[0].GetNumOfElements() - level,
+                      truncatedKey->GetBVector()[0].GetNumOfElements())
+                << failmsg << " the rotation key was not truncated";
+            EXPECT_LE(truncatedKey->GetBVector().size(), fullKey->GetBVector().size()) << failmsg;
+
+            // the truncated key works at its level and deeper
+            for (uint32_t l = level; l <= level + 1; l++) {
+                Plaintext plaintext1            = cc->MakeCKKSPackedPlaintext(vectorOfInts1_8, 1, l);
+                Plaintext pOnes                 = cc->MakeCKKSPackedPlaintext(vectorOfInts1s, 1, l);
+                Ciphertext<Element> ciphertext1 = cc->Encrypt(kp.publicKey, plaintext1);
+                ciphertext1 *= cc->Encrypt(kp.publicKey, pOnes);
+
+                Ciphertext<Element> cResult = cc->EvalAtIndex(ciphertext1, 2);
+                Plaintext results;
+                cc->Decrypt(kp.secretKey, cResult, &results);
+                results->SetLength(vIntsLeftShift2.size());
+                checkEquality(vIntsLeftShift2, results->GetCKKSPackedValue(), eps,
+                              failmsg + " EvalAtIndex(+2) with a truncated key fails at level " + std::to_string(l));
+            }
+
+            // but not for ciphertexts with more limbs than the key
+            Ciphertext<Element> ciphertextTop = cc->Encrypt(kp.publicKey, cc->MakeCKKSPackedPlaintext(vectorOfInts1_8));
+            EXPECT_THROW(cc->EvalAtIndex(ciphertextTop, 2), config_error) << failmsg;
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+
     void UnitTest_EvalMerge(const TEST_CASE_UTCKKSRNS& testData, const std::string& failmsg = std::string()) {
         // TODO (dsuponit) error from pke/include/schemebase/base-scheme.h:1500 EvalMerge operation has not been enabled"
         try {
@@ -1626,6 +1720,84 @@ protected:
         }
     }
 
+    void UnitTest_EvalMatMult(const TEST_CASE_UTCKKSRNS& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            const uint32_t d = 4;
+            const uint32_t n = d * d;
+
+            // 8 x 8 matrices split into a 2 x 2 grid of 4 x 4 blocks packed row-major
+            const uint32_t size = 2 * d;
+            std::vector<std::vector<double>> A(size, std::vector<double>(size));
+            std::vector<std::vector<double>> B(size, std::vector<double>(size));
+            for (uint32_t i = 0; i < size; i++) {
+                for (uint32_t j = 0; j < size; j++) {
+                    A[i][j] = static_cast<double>((i + 2 * j) % 5) / 4;
+                    B[i][j] = static_cast<double>((3 * i + j) % 7) / 8 - 0.25;
+                }
+            }
+            auto block = [&](const std::vector<std::vector<double>>& M, uint32_t bi, uint32_t bj) {
+                std::vector<std::complex<double>> v(n);
+                for (uint32_t l = 0; l < n; l++)
+                    v[l] = M[bi * d + l / d][bj * d + l % d];
+                return v;
+            };
+            auto product = [&](uint32_t bi, uint32_t bj, uint32_t kmax) {
+                std::vector<std::complex<double>> v(n);
+                for (uint32_t l = 0; l < n; l++) {
+                    double sum = 0;
+                    for (uint32_t k = 0; k < kmax; k++)
+                        sum += A[bi * d + l / d][k] * B[k][bj * d + l % d];
+                    v[l] = sum;
+                }
+                return v;
+            };
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultKeyGen(kp.secretKey);
+            cc->EvalMatMultSetup(d);
+            cc->EvalMatMultKeyGen(kp.secretKey, d);
+
+            std::vector<std::vector<Ciphertext<Element>>> cA(2, std::vector<Ciphertext<Element>>(2));
+            std::vector<std::vector<Ciphertext<Element>>> cB(2, std::vector<Ciphertext<Element>>(2));
+            for (uint32_t i = 0; i < 2; i++) {
+                for (uint32_t j = 0; j < 2; j++) {
+                    cA[i][j] = cc->Encrypt(kp.publicKey, cc->MakeCKKSPackedPlaintext(block(A, i, j)));
+                    cB[i][j] = cc->Encrypt(kp.publicKey, cc->MakeCKKSPackedPlaintext(block(B, i, j)));
+                }
+            }
+
+            // the top-left blocks alone form a 4 x 4 product
+            Plaintext results;
+            cc->Decrypt(kp.secretKey, cc->EvalMatMult(cA[0][0], cB[0][0], d), &results);
+            results->SetLength(n);
+            checkEquality(product(0, 0, d), results->GetCKKSPackedValue(), epsHigh, failmsg + " EvalMatMult fails");
+
+            auto cC = cc->EvalMatMultBlocks(cA, cB, d);
+            for (uint32_t i = 0; i < 2; i++) {
+                for (uint32_t j = 0; j < 2; j++) {
+                    cc->Decrypt(kp.secretKey, cC[i][j], &results);
+                    results->SetLength(n);
+                    checkEquality(product(i, j, size), results->GetCKKSPackedValue(), epsHigh,
+                                  failmsg + " EvalMatMultBlocks fails for block " + std::to_string(i) + "," +
+                                      std::to_string(j));
+                }
+            }
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+
     void UnitTest_EvalLinearWSum(const TEST_CASE_UTCKKSRNS& testData, const std::string& failmsg = std::string()) {
         try {
             CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
@@ -2062,6 +2234,12 @@ TEST_P(UTCKKSRNS, CKKSRNS) {
         case EVALMERGE:
             UnitTest_EvalMerge(test, test.buildTestName());
             break;
+        case EVAL_MAT_MULT:
+            UnitTest_EvalMatMult(test, test.buildTestName());
+            break;
+        case EVALATINDEX_LEVELED:
+            UnitTest_EvalAtIndexLeveled(test, test.buildTestName());
+            break;
         case EVAL_LINEAR_WSUM:
             UnitTest_EvalLinearWSum(test, test.buildTestName());
             break;
@@ -34,6 +34,8 @@
 #include "UnitTestCCParams.h"
 #include "UnitTestCryptoContext.h"
 
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <vector>
 #include "gtest/gtest.h"
@@ -52,6 +54,8 @@ enum TEST_CASE_TYPE {
     CONTEXT_WITH_SERTYPE = 0,
     KEYS_AND_CIPHERTEXTS,
     NO_CRT_TABLES,
+    RAW_CIPHERTEXT,
+    CHUNKED_EVAL_KEYS,
 };
 
 static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
@@ -66,6 +70,12 @@ static std::ostream& operator<<(std::ostream& os, const TEST_CASE_TYPE& type) {
         case NO_CRT_TABLES:
             typeName = "NO_CRT_TABLES";
             break;
+        case RAW_CIPHERTEXT:
+            typeName = "RAW_CIPHERTEXT";
+            break;
+        case CHUNKED_EVAL_KEYS:
+            typeName = "CHUNKED_EVAL_KEYS";
+            break;
         default:
             typeName = "UNKNOWN";
             break;
@@ -168,6 +178,18 @@ static std::vector<TEST_CASE_UTCKKSRNS_SER> testCases = {
     { NO_CRT_TABLES, "08", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, 0,     BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
 #endif
     // ==========================================
+    // TestType,     Descr, Scheme,         RDim,     MultDepth,  SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech,  EncTech, PREMode
+    { RAW_CIPHERTEXT, "01", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
+    { RAW_CIPHERTEXT, "02", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
+#if NATIVEINT != 128
+    { RAW_CIPHERTEXT, "03", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FLEXIBLEAUTO,    DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
+    { RAW_CIPHERTEXT, "04", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FLEXIBLEAUTOEXT, DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
+#endif
+    // ==========================================
+    // TestType,        Descr, Scheme,         RDim,     MultDepth,  SModSize, DSize, BatchSz, SecKeyDist, MaxRelinSkDeg, FModSize, SecLvl,       KSTech, ScalTech,        LDigits, PtMod, StdDev, EvalAddCt, KSCt, MultTech,  EncTech, PREMode
+    { CHUNKED_EVAL_KEYS, "01", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, BV,     FIXEDMANUAL,     DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
+    { CHUNKED_EVAL_KEYS, "02", {CKKSRNS_SCHEME, RING_DIM, MULT_DEPTH, SMODSIZE, DSIZE, BATCH,   DFLT,       DFLT,          DFLT,     HEStd_NotSet, HYBRID, FIXEDAUTO,       DFLT,    DFLT,  DFLT,   DFLT,      DFLT, DFLT,      DFLT,    DFLT}, },
+    // ==========================================
 };
 // clang-format on
 //===========================================================================================================
@@ -461,6 +483,213 @@ protected:
         TestDecryptionSerNoCRTTables(testData, SerType::JSON, "json");
         TestDecryptionSerNoCRTTables(testData, SerType::BINARY, "binary");
     }
+    void UnitTestRawCiphertext(const TEST_CASE_UTCKKSRNS_SER& testData, const std::string& failmsg = std::string()) {
+        try {
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            KeyPair<Element> kp = cc->KeyGen();
+            cc->EvalMultKeyGen(kp.secretKey);
+
+            std::vector<std::complex<double>> vals = {1.0, 3.0, 5.0, 7.0, 9.0, 2.0, 4.0, 6.0, 8.0, 11.0};
+            std::vector<std::complex<double>> valsSq(vals.size());
+            for (size_t i = 0; i < vals.size(); i++)
+                valsSq[i] = vals[i] * vals[i];
+
+            Plaintext plaintext             = cc->MakeCKKSPackedPlaintext(vals);
+            Ciphertext<DCRTPoly> ciphertext = cc->Encrypt(kp.publicKey, plaintext);
+            // a ciphertext with fewer towers than the context parameters
+            Ciphertext<DCRTPoly> ciphertextSq = cc->Compress(cc->EvalMult(ciphertext, ciphertext), 2);
+
+            std::stringstream s;
+            Serial::SerializeRaw(ciphertext, s);
+            Serial::SerializeRaw(ciphertextSq, s);
+
+            Ciphertext<DCRTPoly> newC;
+            Ciphertext<DCRTPoly> newCSq;
+            Serial::DeserializeRaw(newC, s, cc);
+            Serial::DeserializeRaw(newCSq, s, cc);
+
+            EXPECT_EQ(*ciphertext, *newC) << failmsg << " Ciphertext mismatch";
+            EXPECT_EQ(*ciphertextSq, *newCSq) << failmsg << " Ciphertext mismatch (reduced level)";
+            EXPECT_EQ(newC->GetElements()[0].GetParams(), cc->GetElementParams())
+                << failmsg << " Element parameters are not shared with the context";
+
+            Plaintext result;
+            cc->Decrypt(kp.secretKey, newC, &result);
+            result->SetLength(vals.size());
+            checkEquality(vals, result->GetCKKSPackedValue(), eps, failmsg + " Decryption failed");
+
+            cc->Decrypt(kp.secretKey, newCSq, &result);
+            result->SetLength(vals.size());
+            checkEquality(valsSq, result->GetCKKSPackedValue(), eps, failmsg + " Decryption failed (reduced level)");
+
+            // a different context must reject the ciphertext
+            UnitTestCCParams otherParams = testData.params;
+            otherParams.scalingModSize   = SMODSIZE - 1;
+            CryptoContext<Element> otherCC(UnitTestGenerateContext(otherParams));
+            std::stringstream s2;
+            Serial::SerializeRaw(ciphertext, s2);
+            Ciphertext<DCRTPoly> otherC;
+            EXPECT_THROW(Serial::DeserializeRaw(otherC, s2, otherCC), deserialize_error)
+                << failmsg << " Ciphertext accepted by an incompatible context";
+
+            // corrupted headers and short reads are rejected before anything is allocated
+            std::stringstream s3;
+            Serial::SerializeRaw(ciphertext, s3);
+            const std::string raw = s3.str();
+            auto corrupted        = [&](size_t offset, const auto& value) {
+                std::string bytes = raw;
+                std::memcpy(&bytes[offset], &value, sizeof(value));
+                return bytes;
+            };
+            for (const auto& bytes :
+                 {corrupted(offsetof(Serial::RawCiphertextHeader, keyTagSize), uint64_t(1) << 60),
+                  corrupted(offsetof(Serial::RawCiphertextHeader, numElements), uint32_t(1) << 30),
+                  corrupted(offsetof(Serial::RawCiphertextHeader, numElements), uint32_t(0)),
+                  corrupted(offsetof(Serial::RawCiphertextHeader, format), uint32_t(7)),
+                  raw.substr(0, sizeof(Serial::RawCiphertextHeader) + 1), raw.substr(0, raw.size() - 1)}) {
+                std::stringstream bad(bytes);
+                Ciphertext<DCRTPoly> badC;
+                EXPECT_THROW(Serial::DeserializeRaw(badC, bad, cc), deserialize_error)
+                    << failmsg << " Corrupted raw ciphertext accepted";
+            }
+
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+            CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+    template <typename ST>
+    void TestChunkedEvalKeys(const TEST_CASE_UTCKKSRNS_SER& testData, const ST& sertype,
+                             const std::string& failmsg = std::string()) {
+        try {
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+            CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+
+            CryptoContext<Element> cc(UnitTestGenerateContext(testData.params));
+
+            KeyPair<Element> kp  = cc->KeyGen();
+            KeyPair<Element> kp2 = cc->KeyGen();
+            for (const auto& sk : {kp.secretKey, kp2.secretKey}) {
+                cc->EvalMultKeyGen(sk);
+                cc->EvalSumKeyGen(sk);
+                cc->EvalRotateKeyGen(sk, {1, 2, -1});
+            }
+
+            auto multKeys = CryptoContextImpl<DCRTPoly>::GetAllEvalMultKeys();
+            auto sumKeys  = CryptoContextImpl<DCRTPoly>::GetAllEvalSumKeys();
+            auto autoKeys = CryptoContextImpl<DCRTPoly>::GetAllEvalAutomorphismKeys();
+
+            std::stringstream multSer, sumSer, autoSer, autoSerOne;
+            EXPECT_TRUE(CryptoContextImpl<DCRTPoly>::SerializeEvalMultKeyChunked(multSer, sertype))
+                << failmsg << " eval mult key ser fails";
+            EXPECT_TRUE(CryptoContextImpl<DCRTPoly>::SerializeEvalSumKeyChunked(sumSer, sertype))
+                << failmsg << " eval sum key ser fails";
+            EXPECT_TRUE(CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKeyChunked(autoSer, sertype))
+                << failmsg << " eval automorphism key ser fails";
+            EXPECT_TRUE(CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKeyChunked(autoSerOne, sertype,
+                                                                                         kp.secretKey->GetKeyTag()))
+                << failmsg << " single eval automorphism key ser fails";
+            std::stringstream none;
+            EXPECT_FALSE(CryptoContextImpl<DCRTPoly>::SerializeEvalAutomorphismKeyChunked(none, sertype, "none"))
+                << failmsg << " ser of an unknown id succeeds";
+
+            // the index starts with the magic, the version and the number of chunks, followed by the
+            // key tag size of the first chunk; corrupted values must fail without a huge allocation
+            const std::string chunked = multSer.str();
+            auto corrupted            = [&](size_t offset, uint64_t value) {
+                std::string bytes = chunked;
+                std::memcpy(&bytes[offset], &value, sizeof(value));
+                return bytes;
+            };
+            for (const auto& bytes : {corrupted(16, uint64_t(1) << 60), corrupted(24, uint64_t(1) << 60),
+                                      chunked.substr(0, chunked.size() - 1)}) {
+                std::stringstream badChunks(bytes);
+                EXPECT_THROW(CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKeyChunked(badChunks, sertype),
+                             deserialize_error)
+                    << failmsg << " corrupted file accepted";
+            }
+
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+
+            CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKeyChunked(autoSerOne, sertype);
+            EXPECT_EQ(CryptoContextImpl<DCRTPoly>::GetAllEvalAutomorphismKeys().size(), 1U)
+                << failmsg << " one-key deser, keys";
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+
+            CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKeyChunked(multSer, sertype);
+            CryptoContextImpl<DCRTPoly>::DeserializeEvalSumKeyChunked(sumSer, sertype);
+            CryptoContextImpl<DCRTPoly>::DeserializeEvalAutomorphismKeyChunked(autoSer, sertype);
+            EXPECT_EQ(CryptoContextFactory<DCRTPoly>::GetContextCount(), 1) << failmsg << " all-key deser, context";
+            EXPECT_TRUE(PrecomputeCRTTablesAfterDeserializaton()) << failmsg << " the global CRT flag was changed";
+
+            const auto& newMultKeys = CryptoContextImpl<DCRTPoly>::GetAllEvalMultKeys();
+            ASSERT_EQ(newMultKeys.size(), multKeys.size()) << failmsg << " all-key deser, mult keys";
+            for (const auto& k : multKeys) {
+                ASSERT_EQ(newMultKeys.at(k.first).size(), k.second.size()) << failmsg << " mult key count mismatch";
+                for (size_t i = 0; i < k.second.size(); i++)
+                    EXPECT_TRUE(*newMultKeys.at(k.first)[i] == *k.second[i]) << failmsg << " mult key mismatch";
+            }
+
+            for (const auto& keyMaps : {std::make_pair(sumKeys, CryptoContextImpl<DCRTPoly>::GetAllEvalSumKeys()),
+                                        std::make_pair(autoKeys,
+                                                       CryptoContextImpl<DCRTPoly>::GetAllEvalAutomorphismKeys())}) {
+                ASSERT_EQ(keyMaps.second.size(), keyMaps.first.size()) << failmsg << " all-key deser, keys";
+                for (const auto& k : keyMaps.first) {
+                    const auto& newKeys = *keyMaps.second.at(k.first);
+                    ASSERT_EQ(newKeys.size(), k.second->size()) << failmsg << " key count mismatch";
+                    for (const auto& key : *k.second)
+                        EXPECT_TRUE(*newKeys.at(key.first) == *key.second) << failmsg << " key mismatch";
+                }
+            }
+
+            std::vector<std::complex<double>> vals = {1.0, 3.0, 5.0, 7.0, 9.0, 2.0, 4.0, 6.0, 8.0, 11.0};
+            Ciphertext<DCRTPoly> ciphertext        = cc->Encrypt(kp.publicKey, cc->MakeCKKSPackedPlaintext(vals));
+            Plaintext result;
+            cc->Decrypt(kp.secretKey, cc->EvalRotate(ciphertext, 1), &result);
+            result->SetLength(vals.size() - 1);
+            checkEquality(std::vector<std::complex<double>>(vals.begin() + 1, vals.end()),
+                          result->GetCKKSPackedValue(), eps, failmsg + " Rotation with deserialized keys fails");
+
+            std::stringstream bad("not a chunked key file");
+            EXPECT_THROW(CryptoContextImpl<DCRTPoly>::DeserializeEvalMultKeyChunked(bad, sertype), deserialize_error)
+                << failmsg << " invalid file accepted";
+
+            CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalSumKeys();
+            CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+            CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+        }
+        catch (std::exception& e) {
+            std::cerr << "Exception thrown from " << __func__ << "(): " << e.what() << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+        catch (...) {
+            std::string name(demangle(__cxxabiv1::__cxa_current_exception_type()->name()));
+            std::cerr << "Unknown exception of type \"" << name << "\" thrown from " << __func__ << "()" << std::endl;
+            // make it fail
+            EXPECT_TRUE(0 == 1) << failmsg;
+        }
+    }
+    void UnitTestChunkedEvalKeys(const TEST_CASE_UTCKKSRNS_SER& testData, const std::string& failmsg = std::string()) {
+        TestChunkedEvalKeys(testData, SerType::JSON, "json");
+        TestChunkedEvalKeys(testData, SerType::BINARY, "binary");
+    }
 };
 //===========================================================================================================
 TEST_P(UTCKKSRNS_SER, CKKSSer) {
@@ -473,6 +702,10 @@ TEST_P(UTCKKSRNS_SER, CKKSSer) {
         UnitTestKeysAndCiphertexts(test, test.buildTestName());
     else if (test.testCaseType == NO_CRT_TABLES)
         UnitTestDecryptionSerNoCRTTables(test, test.buildTestName());
+    else if (test.testCaseType == RAW_CIPHERTEXT)
+        UnitTestRawCiphertext(test, test.buildTestName());
+    else if (test.testCaseType == CHUNKED_EVAL_KEYS)
+        UnitTestChunkedEvalKeys(test, test.buildTestName());
 }
 
 INSTANTIATE_TEST_SUITE_P(UnitTests, UTCKKSRNS_SER, ::testing::ValuesIn(testCases), testName);